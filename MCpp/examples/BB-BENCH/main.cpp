@@ -0,0 +1,184 @@
+const unsigned int MAXNODE = 100000;	// <-- select maximal number of nodes
+const double RELTOL = 1e-5;		// <-- select relative tolerance on the gap
+#undef USE_PROFIL	// <-- specify to use PROFIL for interval arithmetic
+#undef USE_FILIB	// <-- specify to use FILIB++ for interval arithmetic
+
+////////////////////////////////////////////////////////////////////////
+// Comparison of the lower bounding strategies of mc::FFBranchBound, in
+// terms of number of nodes and CPU time, on a set of small standard
+// global optimization test problems with known global minima
+////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <iomanip>
+#include <limits>
+
+#ifdef USE_PROFIL
+  #include "mcprofil.hpp"
+  typedef INTERVAL I;
+#else
+  #ifdef USE_FILIB
+    #include "mcfilib.hpp"
+    typedef filib::interval<double> I;
+  #else
+    #include "interval.hpp"
+    typedef mc::Interval I;
+  #endif
+#endif
+
+#include "ffbranchbound.hpp"
+typedef mc::FFBranchBound<I> BB;
+
+using namespace std;
+using namespace mc;
+
+////////////////////////////////////////////////////////////////////////
+
+const unsigned int NPROB = 9;
+const char* PROB[NPROB] = {
+  "Six-hump camel",
+  "Three-hump camel",
+  "Branin",
+  "Goldstein-Price",
+  "Rosenbrock",
+  "Hartmann 3",
+  "Colville",
+  "Floudas 4.10",
+  "Rosenbrock in disk"
+};
+const unsigned int NVAR[NPROB] = { 2, 2, 2, 2, 2, 3, 4, 2, 2 };
+const unsigned int NCTR[NPROB] = { 0, 0, 0, 0, 0, 0, 0, 2, 1 };
+const double XL[NPROB][4] = { {-3.,-2.}, {-5.,-5.}, {-5.,0.}, {-2.,-2.}, {-2.,-2.},
+  {0.,0.,0.}, {-10.,-10.,-10.,-10.}, {0.,0.}, {-1.5,-1.5} };
+const double XU[NPROB][4] = { { 3., 2.}, { 5., 5.}, {10.,15.}, { 2., 2.}, { 2., 2.},
+  {1.,1.,1.}, { 10., 10., 10., 10.}, {3.,4.}, { 1.5, 1.5} };
+const double CU[NPROB][2] = { {}, {}, {}, {}, {}, {}, {}, {2.,36.}, {2.} };
+const double FOPT[NPROB] = { -1.0316284535, 0., 0.397887358, 3., 0.,
+  -3.86278214782, 0., -5.50801327, 0. };
+
+template <class T>
+T myobj
+( const unsigned int iprob, const T*x )
+{
+  switch( iprob ){
+  case 0:
+    return 4.*sqr(x[0]) - 2.1*pow(x[0],4) + pow(x[0],6)/3. + x[0]*x[1]
+           - 4.*sqr(x[1]) + 4.*pow(x[1],4);
+  case 1:
+    return 2.*sqr(x[0]) - 1.05*pow(x[0],4) + pow(x[0],6)/6. + x[0]*x[1] + sqr(x[1]);
+  case 2:{
+    const double pi = 4.*std::atan(1.);
+    return sqr( x[1] - 5.1/(4.*pi*pi)*sqr(x[0]) + 5./pi*x[0] - 6. )
+           + 10.*(1.-1./(8.*pi))*cos(x[0]) + 10.; }
+  case 3:
+    return ( 1. + sqr(x[0]+x[1]+1.) * ( 19. - 14.*x[0] + 3.*sqr(x[0]) - 14.*x[1]
+               + 6.*x[0]*x[1] + 3.*sqr(x[1]) ) )
+         * ( 30. + sqr(2.*x[0]-3.*x[1]) * ( 18. - 32.*x[0] + 12.*sqr(x[0]) + 48.*x[1]
+               - 36.*x[0]*x[1] + 27.*sqr(x[1]) ) );
+  case 4:
+    return sqr(1.-x[0]) + 100.*sqr(x[1]-sqr(x[0]));
+  case 5:{
+    const double a[4] = { 1., 1.2, 3., 3.2 };
+    const double A[4][3] = { {3.,10.,30.}, {0.1,10.,35.}, {3.,10.,30.}, {0.1,10.,35.} };
+    const double P[4][3] = { {0.3689,0.1170,0.2673}, {0.4699,0.4387,0.7470},
+                             {0.1091,0.8732,0.5547}, {0.0381,0.5743,0.8828} };
+    T f = 0.;
+    for( unsigned int i=0; i<4; i++ ){
+      T s = 0.;
+      for( unsigned int j=0; j<3; j++ ) s += A[i][j]*sqr(x[j]-P[i][j]);
+      f -= a[i]*exp(-s);
+    }
+    return f; }
+  case 6:
+    return 100.*sqr(sqr(x[0])-x[1]) + sqr(x[0]-1.) + sqr(x[2]-1.) + 90.*sqr(sqr(x[2])-x[3])
+           + 10.1*(sqr(x[1]-1.)+sqr(x[3]-1.)) + 19.8*(x[1]-1.)*(x[3]-1.);
+  case 7:
+    return -x[0] - x[1];
+  case 8: default:
+    return sqr(1.-x[0]) + 100.*sqr(x[1]-sqr(x[0]));
+  }
+}
+
+template <class T>
+T myctr
+( const unsigned int iprob, const unsigned int ictr, const T*x )
+{
+  switch( iprob ){
+  case 7:
+    if( !ictr ) return x[1] - 2.*pow(x[0],4) + 8.*pow(x[0],3) - 8.*sqr(x[0]);
+    return x[1] - 4.*pow(x[0],4) + 32.*pow(x[0],3) - 88.*sqr(x[0]) + 96.*x[0];
+  case 8: default:
+    return sqr(x[0]) + sqr(x[1]);
+  }
+}
+
+const unsigned int NSTRAT = 3;
+const BB::Options::BOUNDER STRAT[NSTRAT] = {
+  BB::Options::INTERVAL, BB::Options::MCCORMICK, BB::Options::TAYLOR
+};
+const char* STRATNAME[NSTRAT] = {
+  "INTERVAL", "MCCORMICK", "TAYLOR"
+};
+const char* STATNAME[4] = {
+  "OPTIMAL", "INFEASIBLE", "INTERRUPTED", "UNRESOLVED"
+};
+
+////////////////////////////////////////////////////////////////////////
+int main()
+////////////////////////////////////////////////////////////////////////
+{
+
+  try{
+
+    const double INF = std::numeric_limits<double>::infinity();
+    for( unsigned int iprob=0; iprob<NPROB; iprob++ ){
+
+      // Record the objective and constraint functions
+      FFGraph DAG;
+      FFVar X[4], F, G[2];
+      I IX[4], IC[2];
+      for( unsigned int i=0; i<NVAR[iprob]; i++ ){
+        X[i] = DAG.var();
+        IX[i] = I( XL[iprob][i], XU[iprob][i] );
+      }
+      F = myobj( iprob, X );
+      for( unsigned int j=0; j<NCTR[iprob]; j++ ){
+        G[j] = myctr( iprob, j, X );
+        IC[j] = I( -INF, CU[iprob][j] );
+      }
+      BB solver( DAG, F, NCTR[iprob], G, NVAR[iprob], X );
+      solver.options.MAXNODE = MAXNODE;
+      solver.options.RELTOL = RELTOL;
+
+      std::cout << "\n" << PROB[iprob] << ": f* = " << std::setprecision(10) << FOPT[iprob] << std::endl
+                << std::setw(14) << std::left << "  Bounder" << std::right
+                << std::setw(13) << "Status" << std::setw(10) << "Nodes"
+                << std::setw(16) << "Upper" << std::setw(16) << "Lower"
+                << std::setw(12) << "CPU [ms]" << std::endl;
+
+      for( unsigned int is=0; is<NSTRAT; is++ ){
+        solver.options.LBOUND = STRAT[is];
+        const double tstart = mc::time();
+        const BB::STATUS status = solver.solve( IX, IC );
+        const double tcpu = mc::time() - tstart;
+        std::cout << "  " << std::setw(12) << std::left << STRATNAME[is] << std::right
+                  << std::setw(13) << STATNAME[status] << std::setw(10) << solver.nnode()
+                  << std::scientific << std::setprecision(6)
+                  << std::setw(16) << solver.upper() << std::setw(16) << solver.lower()
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(12) << tcpu*1e3 << std::endl;
+        std::cout.unsetf( std::ios_base::floatfield );
+      }
+    }
+  }
+
+  catch( FFGraph::Exceptions &eObj ){
+    cerr << "Error " << eObj.ierr()
+         << " in factorable function:" << endl
+	 << eObj.what() << endl
+         << "Aborts." << endl;
+    return eObj.ierr();
+  }
+
+  return 0;
+}
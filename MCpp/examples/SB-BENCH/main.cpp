@@ -0,0 +1,140 @@
+const int NREP = 1000;	// <-- select number of repeated bound computations for timing
+#undef USE_PROFIL	// <-- specify to use PROFIL for interval arithmetic
+#undef USE_FILIB	// <-- specify to use FILIB++ for interval arithmetic
+
+////////////////////////////////////////////////////////////////////////
+// Comparison of the spectral bounders for interval Hessian matrices in
+// mc::Specbnd::spectral_bound, in terms of bound width and CPU time, on
+// the test functions of specbnd_test.hpp
+////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <iomanip>
+
+#ifdef USE_PROFIL
+  #include "mcprofil.hpp"
+  typedef INTERVAL I;
+#else
+  #ifdef USE_FILIB
+    #include "mcfilib.hpp"
+    typedef filib::interval<double> I;
+  #else
+    #include "interval.hpp"
+    typedef mc::Interval I;
+  #endif
+#endif
+
+#include "specbnd.hpp"
+typedef mc::Specbnd<I> SB;
+
+#include "mcfadbad.hpp"
+typedef fadbad::F<I> FI;
+typedef fadbad::F<FI> FFI;
+
+using namespace std;
+using namespace mc;
+
+////////////////////////////////////////////////////////////////////////
+
+const unsigned int NFUNC = 5;
+const char* FUNC[NFUNC] = {
+  "exp(x1-2*x2^2+3*x3^3)",
+  "-1/((x1-4)^2+(x2-4)^2+0.1)-...",
+  "1+x1*sin(2*x1+3*x2)-cos(3*x1-5*x2)",
+  "tan(x1*x2)+asin(x1)*acos(x2)",
+  "sqrt(x1^2+x2^2)"
+};
+const unsigned int NVAR[NFUNC] = { 3, 2, 2, 2, 2 };
+const double XL[NFUNC][3] = { {-0.3,-0.1,-0.4}, {-2.,1.}, {-.5,-.5}, {-.5,-.5}, {.5,.5} };
+const double XU[NFUNC][3] = { { 0.2, 0.6, 0.5}, { 0.,3.}, { .5, .5}, { .5, .5}, {2.,2.} };
+
+template <class T>
+T myfunc
+( const unsigned int ifunc, const T*x )
+{
+  switch( ifunc ){
+  case 0:
+    return exp( x[0] - 2*pow(x[1],2) + 3*pow(x[2],3) );
+  case 1:
+    return -1./(pow(x[0]-4.,2)+pow(x[1]-4.,2)+0.1)
+           -1./(pow(x[0]-1.,2)+pow(x[1]-1.,2)+0.2)
+           -1./(pow(x[0]-8.,2)+pow(x[1]-8.,2)+0.2);
+  case 2:
+    return 1.+x[0]*sin(2.*x[0]+3.*x[1])-cos(3.*x[0]-5.*x[1]);
+  case 3:
+    return tan(x[0]*x[1]) + asin(x[0])*acos(x[1]);
+  case 4: default:
+    return sqrt(pow(x[0],2)+pow(x[1],2));
+  }
+}
+
+const unsigned int NSTRAT = 5;
+const SB::Options::HESSBND_STRATEGY STRAT[NSTRAT] = {
+  SB::Options::GERSHGORIN, SB::Options::GERSHGORIN_SCALED,
+  SB::Options::ROHN, SB::Options::EMATRIX, SB::Options::HERTZROHN
+};
+const char* STRATNAME[NSTRAT] = {
+  "GERSHGORIN", "GERSHGORIN_SCALED", "ROHN", "EMATRIX", "HERTZROHN"
+};
+
+////////////////////////////////////////////////////////////////////////
+int main()
+////////////////////////////////////////////////////////////////////////
+{  
+
+  try{ 
+
+    for( unsigned int ifunc=0; ifunc<NFUNC; ifunc++ ){
+
+      // Interval Hessian matrix (forward-forward)
+      FFI FFX[3];
+      for( unsigned int i=0; i<NVAR[ifunc]; i++ ){
+        FI FX = I(XL[ifunc][i],XU[ifunc][i]); FX.diff(i,NVAR[ifunc]);
+        FFX[i] = FX; FFX[i].diff(i,NVAR[ifunc]);
+      }
+      FFI FFF = myfunc( ifunc, FFX );
+
+      std::cout << "\nf(x) = " << FUNC[ifunc] << std::endl
+                << std::setw(20) << std::left << "  Bounder" << std::right
+                << std::setw(14) << "Lower" << std::setw(14) << "Upper"
+                << std::setw(14) << "Width" << std::setw(14) << "CPU [us]"
+                << std::endl;
+      std::cout << std::scientific << std::setprecision(5);
+
+      for( unsigned int is=0; is<NSTRAT; is++ ){
+        SB::options.HESSBND = STRAT[is];
+        std::pair<double,double> spbnd;
+        const double tstart = mc::time();
+        for( int irep=0; irep<NREP; irep++ )
+          spbnd = SB::spectral_bound( FFF );
+        const double tcpu = ( mc::time() - tstart ) / NREP;
+        std::cout << "  " << std::setw(18) << std::left << STRATNAME[is] << std::right
+                  << std::setw(14) << spbnd.first << std::setw(14) << spbnd.second
+                  << std::setw(14) << spbnd.second-spbnd.first
+                  << std::setw(14) << tcpu*1e6 << std::endl;
+      }
+      std::cout.unsetf( std::ios_base::floatfield );
+    }
+  }
+
+#ifndef USE_PROFIL
+#ifndef USE_FILIB
+  catch( I::Exceptions &eObj ){
+    cerr << "Error " << eObj.ierr()
+         << " in natural interval extension:" << endl
+	 << eObj.what() << endl
+         << "Aborts." << endl;
+    return eObj.ierr();
+  }
+#endif
+#endif
+  catch( SB::Exceptions &eObj ){
+    cerr << "Error " << eObj.ierr()
+         << " in spectral bound:" << endl
+	 << eObj.what() << endl
+         << "Aborts." << endl;
+    return eObj.ierr();
+  }
+
+  return 0;
+}
@@ -50,7 +50,7 @@ public:
 		RecycleBin(){}
 		std::vector<U>* popRecycle(const unsigned int n)
 		{
-			if (m_recycle.empty()) return new std::vector<U>(n);
+			if (m_recycle.empty()) return new std::vector<U>(n,Op<U>::myZero());
 			std::vector<U>* elm=m_recycle.top();
 			m_recycle.pop();
 			USER_ASSERT(elm->size()==n,"Size mismatch "<<elm->size()<<"!="<<n)
@@ -165,9 +165,8 @@ public:
 		}
 		else
 		{
-			static U zero;
-			zero=Op<U>::myZero();
-			return zero;
+			// Reset at each call, since the caller may modify it
+			return scratchZero<U>();
 		}
 	}
 	const U& operator[](const unsigned int i) const 
@@ -179,8 +178,8 @@ public:
 		}
 		else
 		{
-			static U zero;
-			zero=Op<U>::myZero();
+			// Initialized once and never assigned, so that it may be read from several threads
+			static const U zero(Op<U>::myZero());
 			return zero;
 		}
 	}
@@ -74,6 +74,36 @@ namespace fadbad
 		static bool myGt(const T& x, const T& y) { return x>y; }
 		static bool myGe(const T& x, const T& y) { return x>=y; }
 	};
+
+	// Zero of type T private to the calling thread and reset at each call,
+	// returned by reference by the mutable accessors of derivatives that are
+	// not stored, so that writing to it does not affect any other variable.
+	// Before C++11, the thread-local storage classes only apply to plain
+	// data, so the zero is allocated on first use in each thread and never
+	// freed. Define MC__SINGLE_THREAD to use a single zero for all threads.
+	template <typename T> T& scratchZero()
+	{
+#if defined(MC__SINGLE_THREAD)
+		static T zero(Op<T>::myZero());
+		zero=Op<T>::myZero();
+		return zero;
+#elif __cplusplus >= 201103L
+		static thread_local T zero(Op<T>::myZero());
+		zero=Op<T>::myZero();
+		return zero;
+#else
+	#if defined(__GNUC__)
+		static __thread T* zero=0;
+	#elif defined(_MSC_VER)
+		static __declspec(thread) T* zero=0;
+	#else
+		#error "FADBAD++: no thread-local storage class known for this compiler, define MC__SINGLE_THREAD to use FADBAD++ from a single thread only"
+	#endif
+		if (!zero) zero=new T(Op<T>::myZero());
+		else *zero=Op<T>::myZero();
+		return *zero;
+#endif
+	}
 } //namespace fadbad
 
 // Name for backward AD type:
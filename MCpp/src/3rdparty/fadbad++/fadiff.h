@@ -82,17 +82,16 @@ public:
 	{
 		USER_ASSERT(i<N,"Index "<<i<<" out of bounds [0,"<<N<<"]")
 		if (m_depend) return m_diff[i];
-		static T zero;
-		zero=Op<T>::myZero();
+		// Initialized once and never assigned, so that it may be read from several threads
+		static const T zero(Op<T>::myZero());
 		return zero;
 	}
 	T& d(const unsigned int i)
 	{
 		USER_ASSERT(i<N,"Index "<<i<<" out of bounds [0,"<<N<<"]")
 		if (m_depend) return m_diff[i];
-		static T zero;
-		zero=Op<T>::myZero();
-		return zero;
+		// Reset at each call, since the caller may modify it
+		return scratchZero<T>();
 	}
 
 	T& diff(unsigned int idx)
@@ -179,16 +178,13 @@ public:
 	const T& deriv(const unsigned int i) const
 	{
 		if (i<m_size) return m_diff[i];
-		static T zero;
-		zero=Op<T>::myZero();
+		static const T zero(Op<T>::myZero());
 		return zero;
 	}
 	T& d(const unsigned int i)
 	{
 		if (i<m_size) return m_diff[i];
-		static T zero;
-		zero=Op<T>::myZero();
-		return zero;
+		return scratchZero<T>();
 	}
 
 	T& diff(unsigned int idx, unsigned int N)
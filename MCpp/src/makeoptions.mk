@@ -9,8 +9,9 @@ LIB_FILIB = -L$(PATH_FILIB)/lib -lprim
 INC_FILIB = -I$(PATH_FILIB)/include/
 FLAGS_FILIB = -frounding-math -ffloat-store
 
-LIB_LAPACK = -llapack
+LIB_LAPACK = -llapack -lblas
 LIB_CPPUNIT = -lcppunit
+LIB_PTHREAD = -lpthread
 
 # COMPILATION <<-- CHANGE AS APPROPRIATE -->>
 
@@ -19,10 +20,14 @@ OPTIM = -O3
 DEBUG = -g
 WARN  = -Wall
 
+# OpenMP for the parallel evaluations in mc::FFProgram and mc::Specbnd (leave empty to disable)
+OPENMP = -fopenmp
+#OPENMP = -qopenmp
+
 CC = gcc
 CPP = g++
 #CPP = icpc
-FLAGS_CPP = $(DEBUG) $(OPTIM) $(WARN) $(FLAGS_FILIB)
+FLAGS_CPP = $(DEBUG) $(OPTIM) $(WARN) $(FLAGS_FILIB) $(OPENMP)
 
 LINK = $(CPP)
-FLAGS_LINK = 
+FLAGS_LINK = $(OPENMP)
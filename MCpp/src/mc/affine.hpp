@@ -0,0 +1,919 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_AFFINE Affine Arithmetic for Factorable Functions
+\author Beno&icirc;t Chachuat
+
+Interval arithmetic overestimates the range of a factorable function as soon as a variable appears more than once in its expression, the so-called dependency problem; e.g., the interval extension of \f$x-x\f$ on \f$x\in[0,1]\f$ is \f$[-1,1]\f$ rather than \f$\{0\}\f$. Taylor models (see \ref page_TAYLOR) mitigate this problem, yet at a cost that grows combinatorially with the number of variables and the order of the expansion. Affine arithmetic (Comba & Stolfi, 1993; de Figueiredo & Stolfi, 2004) keeps track of first-order dependencies only, at a cost that grows linearly with the number of variables. A quantity \f$x\f$ is represented by an affine form
+\f[ \hat{x} = x_0 + \sum_{i} x_i\,\varepsilon_i, \f]
+where the noise symbols \f$\varepsilon_i\in[-1,1]\f$ are shared by all the affine forms that depend on them. A new noise symbol is created for each independent variable, as well as for the approximation error of each nonlinear operation, so that the affine forms are sparse. The range of \f$\hat{x}\f$ is \f$[x_0-r_x,x_0+r_x]\f$ with \f$r_x=\sum_i|x_i|\f$.
+
+The class mc::Affine implements affine arithmetic for factorable functions, with the following features:
+- The affine forms are stored as sparse vectors of coefficients, sorted by increasing noise-symbol indices, so that the linear operations are performed by merging these vectors.
+- The product \f$\hat{x}\hat{y}\f$ accounts for the squares of the noise symbols that are shared by \f$\hat{x}\f$ and \f$\hat{y}\f$.
+- The convex or concave univariate functions, such as <tt>exp</tt>, <tt>log</tt>, <tt>sqrt</tt>, <tt>inv</tt> or <tt>sqr</tt>, are approximated by their Chebyshev (min-max) linear approximation, and the other univariate functions, such as <tt>sin</tt>, <tt>cos</tt> or <tt>atan</tt>, by their mean-value linearization at the center of the range, whichever of the latter or a constant approximation is tighter.
+- An interval bound, computed in interval arithmetic with mc::Interval, is propagated along with the affine form, and the range of the affine form is intersected with it. Hence, the bounds of mc::Affine are never looser than those of mc::Interval.
+- When the number of noise symbols in an affine form exceeds the option mc::Affine::Options::MAXSYM, the noise symbols with the smallest coefficients are condensed into a single new noise symbol.
+.
+
+The class mc::Affine can be used as the template parameter of the classes mc::McCormick, mc::TModel and mc::Specbnd of MC++, for which a specialization of mc::Op is provided, as well as of the types of FADBAD++ through the header file <tt>mcfadbad.hpp</tt>. Like mc::Interval, mc::Affine is <B>not a verified implementation</B>, as round-off errors are not accounted for.
+
+
+\section sec_AFFINE_use How do I compute affine bounds on the range of a factorable function?
+
+Suppose we want to calculate bounds on the range of the real-valued function \f$f(x,y)=x(1-y)+y(1-x)\f$ for \f$(x,y)\in [0,1]^2\f$. The relevant header file is:
+
+\code
+      #include "affine.hpp"
+      typedef mc::Affine AF;
+\endcode
+
+The variables are defined from their ranges, which creates a new noise symbol for each of them:
+
+\code
+      AF X( 0., 1. );
+      AF Y( 0., 1. );
+\endcode
+
+The bounds on the range of \f$f\f$ are then calculated and displayed as
+
+\code
+      AF F = X*(1.-Y)+Y*(1.-X);
+      std::cout << "F bounds: " << F << std::endl;
+\endcode
+
+The lower and upper bounds are retrieved as <tt>F.l()</tt> and <tt>F.u()</tt>, while the center and the number of noise symbols of the affine form are retrieved as <tt>F.center()</tt> and <tt>F.nsym()</tt>.
+
+The noise symbols are numbered by a counter shared by all the threads and incremented atomically (see mc::SharedCounter in <tt>mcfunc.hpp</tt>), so affine forms created in different threads may be combined.
+
+
+\section sec_AFFINE_opt What are the options in mc::Affine and how are they set?
+
+The class mc::Affine has a public static member called mc::Affine::options that can be used to set/modify the options; e.g.,
+
+\code
+      mc::Affine::options.MAXSYM = 20;
+\endcode
+
+The available options are the following:
+
+<TABLE border="1">
+<CAPTION><EM>Options in mc::Affine::Options: name, type and description</EM></CAPTION>
+     <TR><TH><b>Name</b>  <TD><b>Type</b><TD><b>Default</b>
+         <TD><b>Description</b>
+     <TR><TH><tt>MAXSYM</tt> <TD><tt>unsigned int</tt> <TD>64
+         <TD>Maximal number of noise symbols in an affine form, above which the noise symbols with the smallest coefficients are condensed; no condensation if 0.
+     <TR><TH><tt>DISPLAY_DIGITS</tt> <TD><tt>unsigned int</tt> <TD>5
+         <TD>Number of digits in output stream
+</TABLE>
+
+
+\section sec_AFFINE_err What errors can I encounter when using mc::Affine?
+
+Errors are managed based on the exception handling mechanism of the C++ language. The errors are the same as those of mc::Interval, and an object of type mc::Interval::Exceptions is thrown as soon as an error occurs in the interval bound of an affine form; e.g., when the inverse is taken of an affine form whose range contains zero.
+
+
+\section sec_AFFINE_refs References
+
+- Comba, J.L.D., and J. Stolfi, <A href="http://www.ic.unicamp.br/~stolfi/EXPORT/papers/by-tag/com-sto-93-aa.pdf">Affine arithmetic and its applications to computer graphics</A>, <I>Proceedings of the VI Brazilian Symposium on Computer Graphics and Image Processing (SIBGRAPI'93)</I>, 9-18, 1993.
+- de Figueiredo, L.H., and J. Stolfi, <A href="http://dx.doi.org/10.1023/B:NUMA.0000049462.70970.b6">Affine arithmetic: Concepts and applications</A>, <I>Numerical Algorithms</I>, <b>37</b>(1-4):147-158, 2004.
+.
+
+*/
+
+#ifndef MC__AFFINE_HPP
+#define MC__AFFINE_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <limits>
+
+#include "mcfunc.hpp"
+#include "interval.hpp"
+
+namespace mc
+{
+
+//! @brief C++ class for affine arithmetic bounding of factorable functions
+////////////////////////////////////////////////////////////////////////
+//! mc::Affine is a C++ class for bounding factorable functions on a box
+//! using affine arithmetic. The affine forms are stored as sparse
+//! vectors of coefficients of noise symbols, along with an interval
+//! bound propagated in mc::Interval arithmetic.
+////////////////////////////////////////////////////////////////////////
+class Affine
+////////////////////////////////////////////////////////////////////////
+{
+  // friends of class Affine for operator overloading
+  friend Affine operator-
+    ( const Affine& );
+  friend Affine operator+
+    ( const Affine&, const Affine& );
+  friend Affine operator+
+    ( const double, const Affine& );
+  friend Affine operator-
+    ( const Affine&, const Affine& );
+  friend Affine operator*
+    ( const Affine&, const Affine& );
+  friend Affine operator*
+    ( const double, const Affine& );
+  friend Affine operator/
+    ( const Affine&, const double );
+  friend std::ostream& operator<<
+    ( std::ostream&, const Affine& );
+
+  // friends of class Affine for function overloading
+  friend Affine inv
+    ( const Affine& );
+  friend Affine sqr
+    ( const Affine& );
+  friend Affine exp
+    ( const Affine& );
+  friend Affine log
+    ( const Affine& );
+  friend Affine xlog
+    ( const Affine& );
+  friend Affine sqrt
+    ( const Affine& );
+  friend Affine fabs
+    ( const Affine& );
+  friend Affine pow
+    ( const Affine&, const int );
+  friend Affine cos
+    ( const Affine& );
+  friend Affine sin
+    ( const Affine& );
+  friend Affine tan
+    ( const Affine& );
+  friend Affine acos
+    ( const Affine& );
+  friend Affine asin
+    ( const Affine& );
+  friend Affine atan
+    ( const Affine& );
+  friend Affine erf
+    ( const Affine& );
+  friend Affine erfc
+    ( const Affine& );
+  friend Affine min
+    ( const Affine&, const Affine& );
+  friend Affine max
+    ( const Affine&, const Affine& );
+  friend bool inter
+    ( Affine&, const Affine&, const Affine& );
+
+public:
+
+  //! @brief Exceptions of mc::Affine, the same as those of mc::Interval
+  typedef Interval::Exceptions Exceptions;
+
+  //! @brief Options of mc::Affine
+  static struct Options
+  {
+    //! @brief Constructor
+    Options():
+      MAXSYM(64), DISPLAY_DIGITS(5)
+      {}
+    //! @brief Maximal number of noise symbols in an affine form, above which the smallest ones are condensed (no condensation if 0)
+    unsigned int MAXSYM;
+    //! @brief Number of digits displayed with << operator (default=5)
+    unsigned int DISPLAY_DIGITS;
+  } options;
+
+  //! @brief Default constructor (needed for arrays of mc::Affine elements)
+  Affine()
+    {}
+  //! @brief Constructor for a constant value <a>c</a>
+  Affine
+    ( const double c ):
+    _c(c), _I(c)
+    {}
+  //! @brief Constructor for a variable that belongs to the interval [<a>l</a>,<a>u</a>], with a new noise symbol
+  Affine
+    ( const double l, const double u ):
+    _I(l,u)
+    { _c = mid(_I); _addsym( 0.5*diam(_I) ); }
+  //! @brief Constructor for a variable that belongs to the interval <a>I</a>, with a new noise symbol
+  Affine
+    ( const Interval&I ):
+    _c(mid(I)), _I(I)
+    { _addsym( 0.5*diam(_I) ); }
+
+  Affine& operator=
+    ( const double c )
+    { return *this = Affine( c ); }
+  Affine& operator+=
+    ( const double c )
+    { _c += c; _I += c; return *this; }
+  Affine& operator+=
+    ( const Affine&x )
+    { return *this = *this + x; }
+  Affine& operator-=
+    ( const double c )
+    { _c -= c; _I -= c; return *this; }
+  Affine& operator-=
+    ( const Affine&x )
+    { return *this = *this - x; }
+  Affine& operator*=
+    ( const double c )
+    { return *this = c * *this; }
+  Affine& operator*=
+    ( const Affine&x )
+    { return *this = *this * x; }
+  Affine& operator/=
+    ( const double c )
+    { return *this = *this / c; }
+  Affine& operator/=
+    ( const Affine&x )
+    { return *this = *this * inv( x ); }
+
+  //! @brief Lower bound
+  double l() const
+    { return _I.l(); }
+  //! @brief Upper bound
+  double u() const
+    { return _I.u(); }
+  //! @brief Interval bound
+  const Interval& I() const
+    { return _I; }
+  //! @brief Center of the affine form
+  double center() const
+    { return _c; }
+  //! @brief Sum of the magnitudes of the coefficients of the noise symbols
+  double radius() const;
+  //! @brief Number of noise symbols in the affine form
+  unsigned int nsym() const
+    { return _a.size(); }
+
+private:
+
+  //! @brief Type of the sparse vector of noise-symbol indices and coefficients
+  typedef std::vector< std::pair<unsigned long,double> > t_coef;
+
+  //! @brief Center
+  double _c;
+  //! @brief Noise-symbol indices and coefficients, by increasing indices
+  t_coef _a;
+  //! @brief Interval bound
+  Interval _I;
+
+  //! @brief Counter of the noise symbols, shared by all the threads
+  static SharedCounter _next;
+
+  //! @brief Append a new noise symbol with coefficient <a>d</a>, if positive
+  void _addsym
+    ( const double d )
+    { if( d > 0. ) _a.push_back( std::make_pair( _next.next(), d ) ); }
+
+  //! @brief Condense the noise symbols in excess of mc::Affine::Options::MAXSYM, then intersect the interval bound <a>I</a> with the range of the affine form
+  Affine& _finalize
+    ( const Interval&I );
+
+  //! @brief Affine form <a>alpha</a>*<a>x</a>+<a>zeta</a>&plusmn;<a>delta</a> with interval bound <a>F</a>
+  static Affine _linear
+    ( const Affine&x, const double alpha, const double zeta,
+      const double delta, const Interval&F );
+
+  //! @brief Chebyshev linear approximation of a convex or concave function <a>f</a> on [<a>a</a>,<a>b</a>], given <a>f</a> at the end-points and at the point <a>xi</a> where its slope equals that of the secant, with interval bound <a>F</a>
+  static Affine _chebyshev
+    ( const Affine&x, const double a, const double fa, const double b,
+      const double fb, const double xi, const double fxi, const Interval&F );
+
+  //! @brief Slope of the secant to <a>f</a> on [<a>a</a>,<a>b</a>], given <a>f</a> at the end-points
+  static double _secant
+    ( const double a, const double fa, const double b, const double fb )
+    { return b > a? ( fb - fa ) / ( b - a ): 0.; }
+
+  //! @brief Mean-value linearization of a function <a>f</a> on the range of <a>x</a>, given <a>f</a> and its derivative at the center and the derivative bound <a>DF</a>, or constant approximation if tighter, with interval bound <a>F</a>
+  static Affine _meanvalue
+    ( const Affine&x, const double fc, const double dfc, const Interval&DF,
+      const Interval&F );
+};
+
+////////////////////////////////////////////////////////////////////////
+
+Affine::Options Affine::options;
+
+SharedCounter Affine::_next;
+
+inline double
+Affine::radius() const
+{
+  double r = 0.;
+  for( t_coef::const_iterator it=_a.begin(); it!=_a.end(); ++it )
+    r += std::fabs( it->second );
+  return r;
+}
+
+inline Affine&
+Affine::_finalize
+( const Interval&I )
+{
+  if( options.MAXSYM && _a.size() > options.MAXSYM ){
+    // Keep the MAXSYM-1 largest coefficients, and lump the others into a new noise symbol
+    const unsigned int nkeep = options.MAXSYM-1;
+    double thres = std::numeric_limits<double>::infinity();
+    if( nkeep ){
+      std::vector<double> mag( _a.size() );
+      for( unsigned int i=0; i<_a.size(); i++ ) mag[i] = std::fabs( _a[i].second );
+      std::nth_element( mag.begin(), mag.begin()+nkeep-1, mag.end(), std::greater<double>() );
+      thres = mag[nkeep-1];
+    }
+    // Coefficients equal to the threshold are kept until there are MAXSYM-1 of them
+    unsigned int nabove = 0;
+    for( t_coef::const_iterator it=_a.begin(); it!=_a.end(); ++it )
+      if( std::fabs( it->second ) > thres ) nabove++;
+    unsigned int nties = nkeep - nabove;
+    t_coef a; a.reserve( options.MAXSYM );
+    double d = 0.;
+    for( t_coef::const_iterator it=_a.begin(); it!=_a.end(); ++it ){
+      const double m = std::fabs( it->second );
+      if( m > thres || ( m == thres && nties && nties-- ) ) a.push_back( *it );
+      else d += m;
+    }
+    _a.swap( a );
+    _addsym( d );
+  }
+
+  const double r = radius();
+  if( !inter( _I, I, Interval( _c-r, _c+r ) ) ) _I = I;
+  return *this;
+}
+
+inline Affine
+Affine::_linear
+( const Affine&x, const double alpha, const double zeta,
+  const double delta, const Interval&F )
+{
+  Affine y( alpha*x._c + zeta );
+  if( alpha != 0. ){
+    y._a.reserve( x._a.size()+1 );
+    for( t_coef::const_iterator it=x._a.begin(); it!=x._a.end(); ++it )
+      y._a.push_back( std::make_pair( it->first, alpha*it->second ) );
+  }
+  y._addsym( delta );
+  return y._finalize( F );
+}
+
+inline Affine
+Affine::_chebyshev
+( const Affine&x, const double a, const double fa, const double b,
+  const double fb, const double xi, const double fxi, const Interval&F )
+{
+  // Secant slope, and the intercepts of the parallels through the end-points and the tangency point
+  const double alpha = _secant( a, fa, b, fb );
+  const double xic = std::min( b, std::max( a, xi ) );
+  const double da = fa - alpha*a, dxi = fxi - alpha*xic;
+  return _linear( x, alpha, 0.5*(da+dxi), 0.5*std::fabs(da-dxi), F );
+}
+
+inline Affine
+Affine::_meanvalue
+( const Affine&x, const double fc, const double dfc, const Interval&DF,
+  const Interval&F )
+{
+  const double c = mid( x._I );
+  const double delta = abs( ( DF - dfc ) * ( x._I - c ) );
+  if( std::fabs(dfc)*x.radius() + delta < 0.5*diam(F) )
+    return _linear( x, dfc, fc - dfc*c, delta, F );
+  return _linear( x, 0., mid(F), 0.5*diam(F), F );
+}
+
+inline Affine
+operator+
+( const Affine&x )
+{
+  return x;
+}
+
+inline Affine
+operator-
+( const Affine&x )
+{
+  Affine y( -x._c );
+  y._a = x._a;
+  for( Affine::t_coef::iterator it=y._a.begin(); it!=y._a.end(); ++it )
+    it->second = -it->second;
+  y._I = -x._I;
+  return y;
+}
+
+inline Affine
+operator+
+( const double c, const Affine&x )
+{
+  Affine y( x );
+  return y += c;
+}
+
+inline Affine
+operator+
+( const Affine&x, const double c )
+{
+  return c + x;
+}
+
+inline Affine
+operator+
+( const Affine&x1, const Affine&x2 )
+{
+  // Merge of the sorted noise symbols
+  Affine x3( x1._c + x2._c );
+  x3._a.reserve( x1._a.size() + x2._a.size() );
+  Affine::t_coef::const_iterator it1 = x1._a.begin(), it2 = x2._a.begin();
+  while( it1 != x1._a.end() || it2 != x2._a.end() ){
+    if( it2 == x2._a.end() || ( it1 != x1._a.end() && it1->first < it2->first ) )
+      x3._a.push_back( *it1++ );
+    else if( it1 == x1._a.end() || it2->first < it1->first )
+      x3._a.push_back( *it2++ );
+    else{
+      const double a = it1->second + it2->second;
+      if( a != 0. ) x3._a.push_back( std::make_pair( it1->first, a ) );
+      ++it1; ++it2;
+    }
+  }
+  return x3._finalize( x1._I + x2._I );
+}
+
+inline Affine
+operator-
+( const double c, const Affine&x )
+{
+  return c + (-x);
+}
+
+inline Affine
+operator-
+( const Affine&x, const double c )
+{
+  return (-c) + x;
+}
+
+inline Affine
+operator-
+( const Affine&x1, const Affine&x2 )
+{
+  return x1 + (-x2);
+}
+
+inline Affine
+operator*
+( const double c, const Affine&x )
+{
+  if( c == 0. ) return Affine( 0. );
+  Affine y( c*x._c );
+  y._a = x._a;
+  for( Affine::t_coef::iterator it=y._a.begin(); it!=y._a.end(); ++it )
+    it->second *= c;
+  y._I = c*x._I;
+  return y;
+}
+
+inline Affine
+operator*
+( const Affine&x, const double c )
+{
+  return c * x;
+}
+
+inline Affine
+operator*
+( const Affine&x1, const Affine&x2 )
+{
+  // The products of shared noise symbols a_i*b_i*eps_i^2 lie in [min(0,a_i*b_i),max(0,a_i*b_i)]
+  Affine x3( x1._c * x2._c );
+  x3._a.reserve( x1._a.size() + x2._a.size() + 1 );
+  double sq = 0., sqabs = 0.;
+  Affine::t_coef::const_iterator it1 = x1._a.begin(), it2 = x2._a.begin();
+  while( it1 != x1._a.end() || it2 != x2._a.end() ){
+    if( it2 == x2._a.end() || ( it1 != x1._a.end() && it1->first < it2->first ) ){
+      x3._a.push_back( std::make_pair( it1->first, x2._c*it1->second ) ); ++it1;
+    }
+    else if( it1 == x1._a.end() || it2->first < it1->first ){
+      x3._a.push_back( std::make_pair( it2->first, x1._c*it2->second ) ); ++it2;
+    }
+    else{
+      const double a = x2._c*it1->second + x1._c*it2->second, p = it1->second*it2->second;
+      if( a != 0. ) x3._a.push_back( std::make_pair( it1->first, a ) );
+      sq += p; sqabs += std::fabs( p );
+      ++it1; ++it2;
+    }
+  }
+  x3._c += 0.5*sq;
+  x3._addsym( x1.radius()*x2.radius() - 0.5*sqabs );
+  return x3._finalize( x1._I * x2._I );
+}
+
+inline Affine
+operator/
+( const Affine&x, const double c )
+{
+  if( c == 0. ) throw Interval::Exceptions( Interval::Exceptions::DIV );
+  Affine y( x._c/c );
+  y._a = x._a;
+  for( Affine::t_coef::iterator it=y._a.begin(); it!=y._a.end(); ++it )
+    it->second /= c;
+  y._I = x._I/c;
+  return y;
+}
+
+inline Affine
+operator/
+( const double c, const Affine&x )
+{
+  return c * inv( x );
+}
+
+inline Affine
+operator/
+( const Affine&x1, const Affine&x2 )
+{
+  return x1 * inv( x2 );
+}
+
+inline std::ostream&
+operator<<
+( std::ostream&out, const Affine&x )
+{
+  out << std::right << std::scientific << std::setprecision(Affine::options.DISPLAY_DIGITS);
+  out << "[ "  << std::setw(Affine::options.DISPLAY_DIGITS+7) << x.l()
+      << " : " << std::setw(Affine::options.DISPLAY_DIGITS+7) << x.u() << " ]"
+      << "  (center: " << x.center() << ", noise symbols: " << x.nsym() << ")";
+  return out;
+}
+
+inline double
+diam
+( const Affine&x )
+{
+  return diam( x.I() );
+}
+
+inline double
+mid
+( const Affine&x )
+{
+  return mid( x.I() );
+}
+
+inline double
+abs
+( const Affine&x )
+{
+  return abs( x.I() );
+}
+
+inline Affine
+inv
+( const Affine&x )
+{
+  const Interval F = inv( x._I );
+  const double a = x.l(), b = x.u(), xi = (a>0? 1.: -1.)*std::sqrt(a*b);
+  return Affine::_chebyshev( x, a, 1./a, b, 1./b, xi, 1./xi, F );
+}
+
+inline Affine
+sqr
+( const Affine&x )
+{
+  const double a = x.l(), b = x.u(), xi = 0.5*(a+b);
+  return Affine::_chebyshev( x, a, a*a, b, b*b, xi, xi*xi, sqr( x._I ) );
+}
+
+inline Affine
+exp
+( const Affine&x )
+{
+  const double a = x.l(), b = x.u(), fa = std::exp(a), fb = std::exp(b);
+  const double alpha = Affine::_secant( a, fa, b, fb ), xi = alpha>0.? std::log(alpha): a;
+  return Affine::_chebyshev( x, a, fa, b, fb, xi, std::exp(xi), exp( x._I ) );
+}
+
+inline Affine
+arh
+( const Affine&x, const double a )
+{
+  return exp( -a/x );
+}
+
+inline Affine
+log
+( const Affine&x )
+{
+  const Interval F = log( x._I );
+  const double a = x.l(), b = x.u(), fa = std::log(a), fb = std::log(b);
+  const double alpha = Affine::_secant( a, fa, b, fb ), xi = alpha>0.? 1./alpha: a;
+  return Affine::_chebyshev( x, a, fa, b, fb, xi, std::log(xi), F );
+}
+
+inline Affine
+xlog
+( const Affine&x )
+{
+  const Interval F = xlog( x._I );
+  const double a = x.l(), b = x.u(), fa = mc::xlog(a), fb = mc::xlog(b);
+  const double xi = std::exp( Affine::_secant( a, fa, b, fb ) - 1. );
+  return Affine::_chebyshev( x, a, fa, b, fb, xi, mc::xlog(xi), F );
+}
+
+inline Affine
+sqrt
+( const Affine&x )
+{
+  const Interval F = sqrt( x._I );
+  const double a = x.l(), b = x.u(), fa = std::sqrt(a), fb = std::sqrt(b);
+  const double alpha = Affine::_secant( a, fa, b, fb ), xi = alpha>0.? 0.25/(alpha*alpha): a;
+  return Affine::_chebyshev( x, a, fa, b, fb, xi, std::sqrt(xi), F );
+}
+
+inline Affine
+fabs
+( const Affine&x )
+{
+  if( x.l() >= 0. ) return x;
+  if( x.u() <= 0. ) return -x;
+  return Affine::_chebyshev( x, x.l(), -x.l(), x.u(), x.u(), 0., 0., fabs( x._I ) );
+}
+
+inline Affine
+pow
+( const Affine&x, const int n )
+{
+  if( n == 0 ) return 1.;
+  if( n == 1 ) return x;
+  if( n == 2 ) return sqr( x );
+  if( n < 0 ) return inv( pow( x, -n ) );
+
+  // Convex for even n, and for odd n with a range of constant sign
+  const Interval F = pow( x._I, n );
+  const double a = x.l(), b = x.u(), fa = std::pow(a,n), fb = std::pow(b,n);
+  if( n%2 && a < 0. && b > 0. ){
+    const double c = mid( x._I );
+    return Affine::_meanvalue( x, std::pow(c,n), n*std::pow(c,n-1), n*pow(x._I,n-1), F );
+  }
+  const double alpha = Affine::_secant( a, fa, b, fb );
+  const double xi = ( n%2? ( b<=0.? -1.: 1. ): ( alpha<0.? -1.: 1. ) )
+                  * std::pow( std::fabs(alpha)/n, 1./(n-1) );
+  return Affine::_chebyshev( x, a, fa, b, fb, xi, std::pow(xi,n), F );
+}
+
+inline Affine
+pow
+( const Affine&x, const double a )
+{
+  return exp( a * log( x ) );
+}
+
+inline Affine
+pow
+( const Affine&x1, const Affine&x2 )
+{
+  return exp( x2 * log( x1 ) );
+}
+
+inline Affine
+monomial
+( const unsigned int n, const Affine*x, const int*k )
+{
+  if( n == 0 ){
+    return 1.;
+  }
+  if( n == 1 ){
+    return pow( x[0], k[0] );
+  }
+  return pow( x[0], k[0] ) * monomial( n-1, x+1, k+1 );
+}
+
+inline Affine
+cos
+( const Affine&x )
+{
+  const double c = mid( x.I() );
+  return Affine::_meanvalue( x, std::cos(c), -std::sin(c), -sin( x._I ), cos( x._I ) );
+}
+
+inline Affine
+sin
+( const Affine&x )
+{
+  const double c = mid( x.I() );
+  return Affine::_meanvalue( x, std::sin(c), std::cos(c), cos( x._I ), sin( x._I ) );
+}
+
+inline Affine
+tan
+( const Affine&x )
+{
+  const Interval F = tan( x._I );
+  const double c = mid( x.I() ), tc = std::tan(c);
+  return Affine::_meanvalue( x, tc, 1.+tc*tc, 1.+sqr(F), F );
+}
+
+inline Affine
+acos
+( const Affine&x )
+{
+  const Interval F = acos( x._I );
+  if( x.l() <= -1. || x.u() >= 1. )
+    return Affine::_linear( x, 0., mid(F), 0.5*diam(F), F );
+  const double c = mid( x.I() );
+  return Affine::_meanvalue( x, std::acos(c), -1./std::sqrt(1.-c*c),
+                             -inv(sqrt(1.-sqr(x._I))), F );
+}
+
+inline Affine
+asin
+( const Affine&x )
+{
+  const Interval F = asin( x._I );
+  if( x.l() <= -1. || x.u() >= 1. )
+    return Affine::_linear( x, 0., mid(F), 0.5*diam(F), F );
+  const double c = mid( x.I() );
+  return Affine::_meanvalue( x, std::asin(c), 1./std::sqrt(1.-c*c),
+                             inv(sqrt(1.-sqr(x._I))), F );
+}
+
+inline Affine
+atan
+( const Affine&x )
+{
+  const double c = mid( x.I() );
+  return Affine::_meanvalue( x, std::atan(c), 1./(1.+c*c), inv(1.+sqr(x._I)), atan( x._I ) );
+}
+
+inline Affine
+erf
+( const Affine&x )
+{
+  const double c = mid( x.I() );
+  return Affine::_meanvalue( x, ::erf(c), 2./std::sqrt(PI)*std::exp(-c*c),
+                             2./std::sqrt(PI)*exp(-sqr(x._I)), erf( x._I ) );
+}
+
+inline Affine
+erfc
+( const Affine&x )
+{
+  const double c = mid( x.I() );
+  return Affine::_meanvalue( x, ::erfc(c), -2./std::sqrt(PI)*std::exp(-c*c),
+                             -2./std::sqrt(PI)*exp(-sqr(x._I)), erfc( x._I ) );
+}
+
+inline Affine
+hull
+( const Affine&x1, const Affine&x2 )
+{
+  return Affine( hull( x1.I(), x2.I() ) );
+}
+
+inline Affine
+min
+( const Affine&x1, const Affine&x2 )
+{
+  if( x1.u() <= x2.l() ) return x1;
+  if( x2.u() <= x1.l() ) return x2;
+  Affine x3 = 0.5*( x1 + x2 - fabs( x1 - x2 ) );
+  inter( x3._I, x3._I, min( x1._I, x2._I ) );
+  return x3;
+}
+
+inline Affine
+max
+( const Affine&x1, const Affine&x2 )
+{
+  if( x1.u() <= x2.l() ) return x2;
+  if( x2.u() <= x1.l() ) return x1;
+  Affine x3 = 0.5*( x1 + x2 + fabs( x1 - x2 ) );
+  inter( x3._I, x3._I, max( x1._I, x2._I ) );
+  return x3;
+}
+
+inline Affine
+min
+( const unsigned int n, const Affine*x )
+{
+  Affine x2( n==0 || !x ? 0.: x[0] );
+  for( unsigned int i=1; i<n; i++ ) x2 = min( x2, x[i] );
+  return x2;
+}
+
+inline Affine
+max
+( const unsigned int n, const Affine*x )
+{
+  Affine x2( n==0 || !x ? 0.: x[0] );
+  for( unsigned int i=1; i<n; i++ ) x2 = max( x2, x[i] );
+  return x2;
+}
+
+inline bool
+inter
+( Affine&xIy, const Affine&x, const Affine&y )
+{
+  // The affine form of the narrowest operand is kept, with the intersection as interval bound
+  Interval I;
+  if( !inter( I, x._I, y._I ) ) return false;
+  xIy = diam( x._I ) <= diam( y._I )? x: y;
+  xIy._I = I;
+  return true;
+}
+
+inline bool
+operator==
+( const Affine&x1, const Affine&x2 )
+{
+  return x1.I() == x2.I();
+}
+
+inline bool
+operator!=
+( const Affine&x1, const Affine&x2 )
+{
+  return x1.I() != x2.I();
+}
+
+inline bool
+operator<=
+( const Affine&x1, const Affine&x2 )
+{
+  return x1.I() <= x2.I();
+}
+
+inline bool
+operator>=
+( const Affine&x1, const Affine&x2 )
+{
+  return x1.I() >= x2.I();
+}
+
+inline bool
+operator<
+( const Affine&x1, const Affine&x2 )
+{
+  return x1.I() < x2.I();
+}
+
+inline bool
+operator>
+( const Affine&x1, const Affine&x2 )
+{
+  return x1.I() > x2.I();
+}
+
+} // namespace mc
+
+#include "mcop.hpp"
+
+namespace mc
+{
+
+//! @brief Specialization of the structure mc::Op to allow usage of the type mc::Affine as a template parameter in the classes mc::McCormick, mc::TModel, mc::TVar, and mc::Specbnd
+template <> struct Op<mc::Affine>
+{
+  typedef mc::Affine T;
+  static T point( const double c ) { return T(c); }
+  static T zeroone() { return T(0.,1.); }
+  static void I(T& x, const T&y) { x = y; }
+  static double l(const T& x) { return x.l(); }
+  static double u(const T& x) { return x.u(); }
+  static double abs (const T& x) { return mc::abs(x);  }
+  static double mid (const T& x) { return mc::mid(x);  }
+  static double diam(const T& x) { return mc::diam(x); }
+  static T inv (const T& x) { return mc::inv(x);  }
+  static T sqr (const T& x) { return mc::sqr(x);  }
+  static T sqrt(const T& x) { return mc::sqrt(x); }
+  static T log (const T& x) { return mc::log(x);  }
+  static T xlog(const T& x) { return mc::xlog(x); }
+  static T fabs(const T& x) { return mc::fabs(x); }
+  static T exp (const T& x) { return mc::exp(x);  }
+  static T sin (const T& x) { return mc::sin(x);  }
+  static T cos (const T& x) { return mc::cos(x);  }
+  static T tan (const T& x) { return mc::tan(x);  }
+  static T asin(const T& x) { return mc::asin(x); }
+  static T acos(const T& x) { return mc::acos(x); }
+  static T atan(const T& x) { return mc::atan(x); }
+  static T erf (const T& x) { return mc::erf(x);  }
+  static T erfc(const T& x) { return mc::erfc(x); }
+  static T hull(const T& x, const T& y) { return mc::hull(x,y); }
+  static T min (const T& x, const T& y) { return mc::min(x,y);  }
+  static T max (const T& x, const T& y) { return mc::max(x,y);  }
+  static T arh (const T& x, const double k) { return mc::arh(x,k); }
+  template <typename X, typename Y> static T pow(const X& x, const Y& y) { return mc::pow(x,y); }
+  static T monomial (const unsigned int n, const T* x, const int* k) { return mc::monomial(n,x,k); }
+  static bool inter(T& xIy, const T& x, const T& y) { return mc::inter(xIy,x,y); }
+  static bool eq(const T& x, const T& y) { return x==y; }
+  static bool ne(const T& x, const T& y) { return x!=y; }
+  static bool lt(const T& x, const T& y) { return x<y;  }
+  static bool le(const T& x, const T& y) { return x<=y; }
+  static bool gt(const T& x, const T& y) { return x>y;  }
+  static bool ge(const T& x, const T& y) { return x>=y; }
+};
+
+} // namespace mc
+
+#endif
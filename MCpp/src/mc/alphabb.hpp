@@ -0,0 +1,366 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_ALPHABB alphaBB Convex Underestimators of Factorable Functions
+\author Beno&icirc;t Chachuat
+
+Given a twice-continuously differentiable function \f$f:\mathbb{R}^n\to\mathbb{R}\f$ on a box \f$X:=[x^{\rm L},x^{\rm U}]\f$, the \f$\alpha\f$BB method [Adjiman <I>et al.</I>, 1998] constructs a convex underestimator of \f$f\f$ on \f$X\f$ as
+\f[
+  \breve{f}(x) = f(x) - \sum_{i=1}^n \alpha_i\,(x_i-x^{\rm L}_i)(x^{\rm U}_i-x_i),
+\f]
+where the nonnegative parameters \f$\alpha_i\f$ are large enough to overcome the nonconvexity of \f$f\f$ on \f$X\f$. The class mc::AlphaBB computes these parameters from spectral bounds on the Hessian matrix of \f$f\f$ as provided by mc::Specbnd (see \ref page_SPECBND), and it evaluates the resulting underestimator and its gradient at any point in \f$X\f$.
+
+The parameters \f$\alpha_i\f$ are computed once per box, when mc::AlphaBB::set is called, and are reused for every subsequent evaluation of the underestimator in that box. The following strategies are available:
+- mc::AlphaBB::Options::SPECBND: uniform \f$\alpha_i=\max\{0,-\frac{1}{2}\lambda^{\rm L}\}\f$, with the lower spectral bound \f$\lambda^{\rm L}\f$ computed using eigenvalue arithmetic with mc::Specbnd.
+- mc::AlphaBB::Options::HESSBND: uniform \f$\alpha_i=\max\{0,-\frac{1}{2}\lambda^{\rm L}\}\f$, with \f$\lambda^{\rm L}\f$ computed from an interval Hessian matrix with mc::Specbnd::spectral_bound, using the strategy selected in mc::Specbnd::Options::HESSBND.
+- mc::AlphaBB::Options::SCALED_GERSHGORIN: nonuniform \f$\alpha_i=\max\{0,-\frac{1}{2}(h^{\rm L}_{ii}-\sum_{j\neq i}|h_{ij}|\frac{d_j}{d_i})\}\f$, with \f$d=x^{\rm U}-x^{\rm L}\f$ [Adjiman <I>et al.</I>, 1998], also computed from an interval Hessian matrix.
+.
+
+
+\section sec_ALPHABB_use How do I construct an alphaBB underestimator of a factorable function?
+
+The function must be provided as a functor whose call operator is templated on the variable type, so that it can be evaluated in eigenvalue arithmetic, in interval forward-forward AD, and in real reverse AD. For example, consider the function \f$f(x_1,x_2)=x_1\sin(x_2)\f$ on the box \f$[-1,2]\times[0,3]\f$:
+
+\code
+      #include "interval.hpp"
+      #include "mcfadbad.hpp"
+      #include "alphabb.hpp"
+      typedef mc::Interval I;
+
+      struct myfunc{
+        template <typename U> U operator()( const U*x ) const
+          { return x[0]*sin(x[1]); }
+      };
+      typedef mc::AlphaBB<I,myfunc> ABB;
+\endcode
+
+The underestimator is constructed and its parameters computed as:
+
+\code
+      ABB F( myfunc(), 2 );
+      I X[2] = { I(-1.,2.), I(0.,3.) };
+      F.options.ALPHA = ABB::Options::SCALED_GERSHGORIN;
+      F.set( X );
+\endcode
+
+The parameters \f$\alpha_i\f$ are retrieved as <tt>F.alpha(i)</tt>. The value and gradient of the underestimator at a point \f$x=(1,1)\f$ are then given by:
+
+\code
+      double x[2] = { 1., 1. }, g[2];
+      double fcv = F.l( x, g );
+\endcode
+
+Several points can also be evaluated in a single call. The points are then stored variable by variable, so that the <tt>i</tt>th component of the <tt>k</tt>th point is <tt>x[i*npts+k]</tt>, and the gradients are returned in the same format:
+
+\code
+      const unsigned int npts = 100;
+      double x[2*npts], L[npts], G[2*npts];
+      // ... fill in x
+      F.l( npts, x, L, G );
+\endcode
+
+
+\section sec_ALPHABB_opt How are the options set for the computation of an alphaBB underestimator?
+
+The class mc::AlphaBB has a public member called mc::AlphaBB::options that can be used to set/modify the options before calling mc::AlphaBB::set. The available options are as follows:
+
+<TABLE border="1">
+<CAPTION><EM>Options in mc::AlphaBB::Options: name, type and description</EM></CAPTION>
+     <TR><TH><b>Name</b>  <TD><b>Type</b><TD><b>Default</b>
+         <TD><b>Description</b>
+     <TR><TH><tt>ALPHA</tt> <TD><tt>mc::AlphaBB::Options::ALPHA_STRATEGY</tt> <TD>mc::AlphaBB::Options::SPECBND
+         <TD>Strategy for computing the parameters \f$\alpha_i\f$
+</TABLE>
+
+
+\section sec_ALPHABB_err What errors can I encounter in constructing an alphaBB underestimator?
+
+Errors are managed based on the exception handling mechanism of the C++ language. Each time an error is encountered, a class object of type mc::AlphaBB::Exceptions is thrown, which contains the type of error. Possible errors encountered are:
+
+<TABLE border="1">
+<CAPTION><EM>Errors during the Construction of an alphaBB Underestimator</EM></CAPTION>
+     <TR><TH><b>Number</b> <TD><b>Description</b>
+     <TR><TH><tt>-1</tt> <TD>Underestimator evaluated before the parameters are computed with mc::AlphaBB::set
+     <TR><TH><tt>-2</tt> <TD>Variable index out of range
+     <TR><TH><tt>-33</tt> <TD>Feature not yet implemented in mc::AlphaBB
+</TABLE>
+
+Moreover, exceptions may be thrown by mc::Specbnd and by the template parameter class itself.
+
+
+\section sec_ALPHABB_refs References
+
+- Adjiman, C.S., Dallwig, S., Floudas, C.A., and A. Neumaier, <A href="http://dx.doi.org/10.1016/S0098-1354(98)00027-1">A global optimization method, &alpha;BB, for general twice-differentiable constrained NLPs &ndash; I. Theoretical advances</A>, <i>Computers & Chemical Engineering</i>, <b>22</b>(9):1137-1158, 1998.
+.
+
+*/
+
+#ifndef MC__ALPHABB_HPP
+#define MC__ALPHABB_HPP
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "mcop.hpp"
+#include "specbnd.hpp"
+#include "fadiff.h"
+#include "badiff.h"
+
+namespace mc
+{
+//! @brief C++ template class computing alphaBB convex underestimators of a factorable function on a box
+////////////////////////////////////////////////////////////////////////
+//! mc::AlphaBB<T,FCT> is a C++ template class computing alphaBB convex
+//! underestimators of a factorable function on a box, and evaluating
+//! their values and gradients. The template parameter T corresponds to
+//! the type used in the underlying interval arithmetic calculations,
+//! and FCT to a functor with a call operator templated on the variable
+//! type.
+////////////////////////////////////////////////////////////////////////
+template <typename T, typename FCT>
+class AlphaBB
+////////////////////////////////////////////////////////////////////////
+{
+public:
+
+  //! @brief Options of mc::AlphaBB
+  struct Options
+  {
+    //! @brief Constructor
+    Options():
+      ALPHA(SPECBND)
+      {}
+    //! @brief Strategy for computing the alphaBB parameters
+    enum ALPHA_STRATEGY{
+      SPECBND=0,	//!< Uniform parameter from eigenvalue arithmetic in mc::Specbnd
+      HESSBND,		//!< Uniform parameter from interval Hessian matrix using mc::Specbnd::spectral_bound
+      SCALED_GERSHGORIN	//!< Nonuniform parameters from interval Hessian matrix using the scaled Gershgorin method
+    };
+    //! @brief Strategy for computing the parameters \f$\alpha_i\f$
+    ALPHA_STRATEGY ALPHA;
+  } options;
+
+  //! @brief Exceptions of mc::AlphaBB
+  class Exceptions
+  {
+  public:
+    //! @brief Enumeration type for AlphaBB exception handling
+    enum TYPE{
+      INIT=-1,	//!< Underestimator evaluated before the parameters are computed
+      INDEX=-2,	//!< Variable index out of range
+      UNDEF=-33 //!< Feature not yet implemented in mc::AlphaBB
+    };
+    //! @brief Constructor for error <a>ierr</a>
+    Exceptions( TYPE ierr ) : _ierr( ierr ){}
+    //! @brief Inline function returning the error flag
+    int ierr(){ return _ierr; }
+    //! @brief Error description
+    std::string what(){
+      switch( _ierr ){
+      case INIT:
+        return "mc::AlphaBB\t Underestimator evaluated before the parameters are computed";
+      case INDEX:
+        return "mc::AlphaBB\t Variable index out of range";
+      case UNDEF:
+        return "mc::AlphaBB\t Feature not yet implemented in mc::AlphaBB class";
+      default:
+        return "mc::AlphaBB\t Undocumented error";
+      }
+    }
+
+  private:
+    TYPE _ierr;
+  };
+
+  //! @brief Constructor of alphaBB underestimator for function <tt>f</tt> in <tt>n</tt> variables
+  AlphaBB
+    ( const FCT&f, const unsigned int n )
+    : _f(f), _n(n), _set(false), _XL(n), _XU(n), _alpha(n)
+    {}
+
+  //! @brief Destructor
+  ~AlphaBB()
+    {}
+
+  //! @brief Compute the alphaBB parameters on the box <tt>X</tt>
+  AlphaBB<T,FCT>& set
+    ( const T*X );
+
+  //! @brief Number of variables
+  unsigned int n() const
+    { return _n; }
+  //! @brief Lower spectral bound used for the uniform alphaBB parameter (mc::AlphaBB::Options::SPECBND and mc::AlphaBB::Options::HESSBND only)
+  double lambda() const
+    { if( !_set ) throw Exceptions( Exceptions::INIT );
+      return _lambda; }
+  //! @brief AlphaBB parameter for variable <tt>i</tt>
+  double alpha
+    ( const unsigned int i ) const
+    { if( !_set ) throw Exceptions( Exceptions::INIT );
+      if( i >= _n ) throw Exceptions( Exceptions::INDEX );
+      return _alpha[i]; }
+
+  //! @brief Value of the underestimator at point <tt>x</tt>, with its gradient returned in <tt>g</tt> unless NULL
+  double l
+    ( const double*x, double*g=0 ) const;
+  //! @brief Values <tt>L</tt> of the underestimator at the <tt>npts</tt> points <tt>x</tt> stored variable by variable, with the gradients returned in <tt>G</tt> in the same format unless NULL
+  void l
+    ( const unsigned int npts, const double*x, double*L, double*G=0 ) const;
+
+private:
+
+  //! @brief Factorable function
+  FCT _f;
+  //! @brief Number of variables
+  unsigned int _n;
+  //! @brief Whether the parameters have been computed
+  bool _set;
+  //! @brief Lower bounds of the box
+  std::vector<double> _XL;
+  //! @brief Upper bounds of the box
+  std::vector<double> _XU;
+  //! @brief AlphaBB parameters
+  std::vector<double> _alpha;
+  //! @brief Lower spectral bound
+  double _lambda;
+
+  //! @brief Compute the uniform alphaBB parameter using eigenvalue arithmetic
+  void _alpha_specbnd
+    ( const T*X );
+  //! @brief Compute the uniform alphaBB parameter using the interval Hessian matrix <tt>D2F</tt>
+  void _alpha_hessbnd
+    ( const fadbad::F< fadbad::F<T> >&D2F );
+  //! @brief Compute the nonuniform alphaBB parameters from the interval Hessian matrix <tt>D2F</tt> using the scaled Gershgorin method
+  void _alpha_scaled_gershgorin
+    ( const fadbad::F< fadbad::F<T> >&D2F );
+};
+
+template <typename T, typename FCT> inline AlphaBB<T,FCT>&
+AlphaBB<T,FCT>::set
+( const T*X )
+{
+  _set = false;
+  for( unsigned int i=0; i<_n; i++ ){
+    _XL[i] = Op<T>::l(X[i]);
+    _XU[i] = Op<T>::u(X[i]);
+  }
+
+  if( options.ALPHA == Options::SPECBND )
+    _alpha_specbnd( X );
+
+  else{
+    // Interval Hessian matrix using forward-forward AD
+    std::vector< fadbad::F< fadbad::F<T> > > D2X( _n );
+    for( unsigned int i=0; i<_n; i++ ){
+      fadbad::F<T> DXi = X[i];
+      DXi.diff(i,_n);
+      D2X[i] = DXi;
+      D2X[i].diff(i,_n);
+    }
+    fadbad::F< fadbad::F<T> > D2F = _f( &D2X[0] );
+
+    switch( options.ALPHA ){
+    case Options::HESSBND:
+      _alpha_hessbnd( D2F ); break;
+    case Options::SCALED_GERSHGORIN:
+      _alpha_scaled_gershgorin( D2F ); break;
+    default:
+      throw Exceptions( Exceptions::UNDEF );
+    }
+  }
+
+  _set = true;
+  return *this;
+}
+
+template <typename T, typename FCT> inline void
+AlphaBB<T,FCT>::_alpha_specbnd
+( const T*X )
+{
+  std::vector< Specbnd<T> > SBX( _n );
+  for( unsigned int i=0; i<_n; i++ ) SBX[i].set( X[i], i, _n );
+  Specbnd<T> SBF = _f( &SBX[0] );
+  _lambda = Op<T>::l( SBF.SI() );
+  std::fill( _alpha.begin(), _alpha.end(), std::max( 0., -0.5*_lambda ) );
+}
+
+template <typename T, typename FCT> inline void
+AlphaBB<T,FCT>::_alpha_hessbnd
+( const fadbad::F< fadbad::F<T> >&D2F )
+{
+  // A constant or linear function has an empty Hessian
+  _lambda = D2F.size()? Specbnd<T>::spectral_bound( D2F ).first: 0.;
+  std::fill( _alpha.begin(), _alpha.end(), std::max( 0., -0.5*_lambda ) );
+}
+
+template <typename T, typename FCT> inline void
+AlphaBB<T,FCT>::_alpha_scaled_gershgorin
+( const fadbad::F< fadbad::F<T> >&D2F )
+{
+  _lambda = 0.;
+  std::fill( _alpha.begin(), _alpha.end(), 0. );
+  if( !D2F.size() ) return;
+
+  for( unsigned int i=0; i<_n; i++ ){
+    const double di = _XU[i] - _XL[i];
+    // Degenerate variables do not contribute to the underestimator
+    if( di <= 0. ) continue;
+    double ri = 0.;
+    for( unsigned int j=0; j<_n; j++ ){
+      if( j == i ) continue;
+      T D2Fij;
+      if( !inter( D2Fij, D2F.deriv(i).deriv(j), D2F.deriv(j).deriv(i) ) )
+        D2Fij = D2F.deriv(i).deriv(j);
+      ri += Op<T>::abs( D2Fij ) * ( _XU[j] - _XL[j] ) / di;
+    }
+    _alpha[i] = std::max( 0., -0.5*( Op<T>::l( D2F.deriv(i).deriv(i) ) - ri ) );
+  }
+}
+
+template <typename T, typename FCT> inline double
+AlphaBB<T,FCT>::l
+( const double*x, double*g ) const
+{
+  if( !_set ) throw Exceptions( Exceptions::INIT );
+
+  // Function value, and gradient using reverse AD
+  double f = 0.;
+  if( g ){
+    std::vector< fadbad::B<double> > BX( x, x+_n );
+    fadbad::B<double> BF = _f( &BX[0] );
+    BF.diff(0,1);
+    f = BF.x();
+    for( unsigned int i=0; i<_n; i++ ) g[i] = BX[i].d(0);
+  }
+  else
+    f = _f( x );
+
+  for( unsigned int i=0; i<_n; i++ ){
+    if( _alpha[i] == 0. ) continue;
+    f -= _alpha[i] * ( x[i] - _XL[i] ) * ( _XU[i] - x[i] );
+    if( g ) g[i] -= _alpha[i] * ( _XU[i] + _XL[i] - 2.*x[i] );
+  }
+  return f;
+}
+
+template <typename T, typename FCT> inline void
+AlphaBB<T,FCT>::l
+( const unsigned int npts, const double*x, double*L, double*G ) const
+{
+  if( !_set ) throw Exceptions( Exceptions::INIT );
+
+  std::vector<double> xk( _n ), gk( _n );
+  for( unsigned int k=0; k<npts; k++ ){
+    for( unsigned int i=0; i<_n; i++ ) xk[i] = x[i*npts+k];
+    L[k] = l( &xk[0], G? &gk[0]: 0 );
+    if( !G ) continue;
+    for( unsigned int i=0; i<_n; i++ ) G[i*npts+k] = gk[i];
+  }
+}
+
+} // namespace mc
+
+#endif
@@ -0,0 +1,772 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_BTAPE Reverse-Mode Automatic Differentiation on a Contiguous Tape
+\author Beno&icirc;t Chachuat
+
+The reverse mode of automatic differentiation (AD) in FADBAD++ [Bendtsen & Stauning, 1996], <tt>fadbad::B</tt>, builds an expression graph whereby every elementary operation allocates a reference-counted node on the heap. When the underlying arithmetic is itself cheap, as with interval arithmetic, or when the graph is rebuilt many times over, as in a branch-and-bound search, the cost of these allocations may dominate that of the derivative computation.
+
+The classes mc::BTape and mc::BVar implement the reverse mode of AD on a tape, namely a contiguous record of the elementary operations in the order of their evaluation [Griewank & Walther, 2008]. Each entry of the tape consists of an opcode, the indices of its operands on the tape, a real constant, and the value of the operation in the arithmetic <tt>T</tt>. These entries are stored in arrays that grow as needed and keep their memory when the tape is reset, so that recording the same function repeatedly does not allocate memory after the first evaluation. The template parameter <tt>T</tt> can be any type supported by <tt>fadbad::B</tt>, including <tt>double</tt>, mc::Interval, mc::McCormick, and mc::TVar, for which the header file <tt>mcfadbad.hpp</tt> provides the required specializations of <tt>fadbad::Op</tt>.
+
+The partial derivatives of the elementary operations are computed during the reverse sweep from the values recorded on the tape, using the same expressions as <tt>fadbad::B</tt>. The adjoints of the tape entries that do not depend on the dependent variable are neither initialized nor propagated.
+
+
+\section sec_BTAPE_use How do I compute the gradient of a factorable function with mc::BTape?
+
+Suppose we want to compute an interval enclosure of the gradient of the function \f$f(x,y)=x\,y\,\exp(x)+\sin(x-y)\f$ on the box \f$[1,2]\times[-1,0]\f$. The relevant header files are:
+
+\code
+      #include "interval.hpp"
+      #include "btape.hpp"
+      typedef mc::Interval I;
+\endcode
+
+The independent variables are recorded on a tape of type mc::BTape, and the function is evaluated using variables of type mc::BVar:
+
+\code
+      mc::BTape<I> tape;
+      mc::BVar<I> X = tape.var( I(1.,2.) ), Y = tape.var( I(-1.,0.) );
+      mc::BVar<I> F = X*Y*exp(X) + sin(X-Y);
+\endcode
+
+The reverse sweep is then performed from the dependent variable <tt>F</tt>, after which the gradient entries are retrieved as the adjoints of the independent variables:
+
+\code
+      tape.reverse( F );
+      std::cout << "F = " << F.val() << std::endl
+                << "dFdX = " << X.d() << std::endl
+                << "dFdY = " << Y.d() << std::endl;
+\endcode
+
+Before evaluating the function on another box, the tape is reset with <tt>tape.reset()</tt>, in constant time. The variables recorded before the reset can no longer be used after it.
+
+
+\section sec_BTAPE_err What errors can I encounter when using mc::BTape?
+
+Errors are managed based on the exception handling mechanism of the C++ language. Each time an error is encountered, a class object of type mc::BTape::Exceptions is thrown, which contains the type of error. Possible errors are:
+
+<TABLE border="1">
+<CAPTION><EM>Errors during Reverse-Mode Differentiation with mc::BTape</EM></CAPTION>
+     <TR><TH><b>Number</b> <TD><b>Description</b>
+     <TR><TH><tt>-1</tt> <TD>Operation between variables recorded on different tapes
+     <TR><TH><tt>-2</tt> <TD>Variable not recorded on the current tape
+     <TR><TH><tt>-33</tt> <TD>Feature not yet implemented in mc::BTape
+</TABLE>
+
+
+\section sec_BTAPE_refs References
+
+- Bendtsen, C., and O. Stauning, <A href="http://www.fadbad.com/download/fadbad.ps.gz">FADBAD, a flexible C++ package for automatic differentiation</A>, Technical Report IMM-REP-1996-17, Technical University of Denmark, 1996.
+- Griewank, A., and A. Walther, <I><A href="http://dx.doi.org/10.1137/1.9780898717761">Evaluating Derivatives: Principles and Techniques of Algorithmic Differentiation</A></I>, 2nd Edition, SIAM, 2008.
+.
+
+*/
+
+#ifndef MC__BTAPE_HPP
+#define MC__BTAPE_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "mcfadbad.hpp"
+
+namespace mc
+{
+
+template <typename T> class BVar;
+
+//! @brief C++ class recording factorable functions on a contiguous tape for reverse-mode AD
+////////////////////////////////////////////////////////////////////////
+//! mc::BTape is a C++ class recording the elementary operations of a
+//! factorable function on a contiguous tape, in order to compute its
+//! gradient with the reverse mode of automatic differentiation in the
+//! arithmetic <tt>T</tt>.
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class BTape
+////////////////////////////////////////////////////////////////////////
+{
+  friend class BVar<T>;
+
+public:
+
+  //! @brief Exceptions of mc::BTape
+  class Exceptions
+  {
+  public:
+    //! @brief Enumeration type for BTape exception handling
+    enum TYPE{
+      TAPE=-1,	//!< Operation between variables recorded on different tapes
+      INDEX=-2,	//!< Variable not recorded on the current tape
+      UNDEF=-33 //!< Feature not yet implemented in mc::BTape
+    };
+    //! @brief Constructor for error <a>ierr</a>
+    Exceptions( TYPE ierr ) : _ierr( ierr ){}
+    //! @brief Inline function returning the error flag
+    int ierr(){ return _ierr; }
+    //! @brief Error description
+    std::string what(){
+      switch( _ierr ){
+      case TAPE:
+        return "mc::BTape\t Operation between variables recorded on different tapes";
+      case INDEX:
+        return "mc::BTape\t Variable not recorded on the current tape";
+      case UNDEF:
+        return "mc::BTape\t Feature not yet implemented in mc::BTape class";
+      default:
+        return "mc::BTape\t Undocumented error";
+      }
+    }
+
+  private:
+    TYPE _ierr;
+  };
+
+  //! @brief Enumeration type for the opcodes of the operations recorded on the tape
+  enum OPCODE{
+    VAR=0,	//!< Independent variable
+    ADD,	//!< Sum of two variables
+    SUB,	//!< Difference of two variables
+    MUL,	//!< Product of two variables
+    DIV,	//!< Ratio of two variables
+    ADDC,	//!< Sum of a variable and a constant
+    CSUB,	//!< Difference of a constant and a variable
+    MULC,	//!< Product of a variable and a constant
+    DIVC,	//!< Ratio of a variable and a constant
+    CDIV,	//!< Ratio of a constant and a variable
+    NEG,	//!< Opposite of a variable
+    SQR,	//!< Square of a variable
+    INV,	//!< Inverse of a variable
+    SQRT,	//!< Square root of a variable
+    EXP,	//!< Exponential of a variable
+    LOG,	//!< Natural logarithm of a variable
+    SIN,	//!< Sine of a variable
+    COS,	//!< Cosine of a variable
+    TAN,	//!< Tangent of a variable
+    ASIN,	//!< Arcsine of a variable
+    ACOS,	//!< Arccosine of a variable
+    ATAN,	//!< Arctangent of a variable
+    POW,	//!< Power of a variable with variable exponent
+    POWI,	//!< Power of a variable with integer exponent
+    POWC,	//!< Power of a variable with real exponent
+    CPOW	//!< Power of a constant with variable exponent
+  };
+
+  //! @brief Default constructor
+  BTape():
+    _size(0)
+  {}
+
+  //! @brief Record a new independent variable with value <a>X</a>
+  BVar<T> var
+    ( const T&X )
+    { return _record( VAR, 0, 0, 0., X ); }
+
+  //! @brief Perform the reverse sweep from the dependent variable <a>F</a>
+  void reverse
+    ( const BVar<T>&F );
+
+  //! @brief Adjoint of the variable <a>X</a> after the last reverse sweep
+  T adjoint
+    ( const BVar<T>&X ) const;
+
+  //! @brief Reset the tape, keeping the memory allocated for its entries
+  void reset()
+    { _size = 0; }
+
+  //! @brief Preallocate memory for <a>n</a> entries on the tape
+  void reserve
+    ( const unsigned int n )
+    { _node.reserve( n ); _val.reserve( n ); _adj.reserve( n ); _live.reserve( n ); }
+
+  //! @brief Number of entries on the tape
+  unsigned int size() const
+    { return _size; }
+
+private:
+
+  //! @brief Structure storing the opcode, operands and real constant of a tape entry
+  struct t_node{
+    OPCODE op;
+    unsigned int a1;
+    unsigned int a2;
+    double c;
+  };
+
+  //! @brief Entries recorded on the tape, valid up to index <tt>_size</tt>
+  std::vector<t_node> _node;
+  //! @brief Values of the entries recorded on the tape
+  std::vector<T> _val;
+  //! @brief Adjoints of the entries recorded on the tape
+  std::vector<T> _adj;
+  //! @brief Flags indicating whether the adjoints have been set during the last reverse sweep
+  std::vector<bool> _live;
+  //! @brief Number of entries recorded on the tape
+  unsigned int _size;
+
+  //! @brief Record a new entry with opcode <a>op</a>, operands <a>a1</a> and <a>a2</a>, constant <a>c</a> and value <a>V</a>
+  BVar<T> _record
+    ( const OPCODE op, const unsigned int a1, const unsigned int a2,
+      const double c, const T&V );
+
+  //! @brief Add <a>D</a> to the adjoint of entry <a>i</a>
+  void _add
+    ( const unsigned int i, const T&D )
+    {
+      if( _live[i] ) fadbad::Op<T>::myCadd( _adj[i], D );
+      else{ _adj[i] = D; _live[i] = true; }
+    }
+
+  //! @brief Subtract <a>D</a> from the adjoint of entry <a>i</a>
+  void _sub
+    ( const unsigned int i, const T&D )
+    {
+      if( _live[i] ) fadbad::Op<T>::myCsub( _adj[i], D );
+      else{ _adj[i] = fadbad::Op<T>::myNeg( D ); _live[i] = true; }
+    }
+
+  //! @brief Private copy constructor (the variables recorded on a tape hold pointers to it)
+  BTape
+    ( const BTape<T>& );
+  //! @brief Private assignment operator
+  BTape<T>& operator=
+    ( const BTape<T>& );
+};
+
+//! @brief C++ class for variables recorded on a tape of type mc::BTape
+////////////////////////////////////////////////////////////////////////
+//! mc::BVar is a C++ class for the variables of a factorable function
+//! recorded on a tape of type mc::BTape. A variable not attached to any
+//! tape is a passive real constant.
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class BVar
+////////////////////////////////////////////////////////////////////////
+{
+  friend class BTape<T>;
+
+  template <typename U> friend BVar<U> operator-
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> operator+
+    ( const BVar<U>&, const BVar<U>& );
+  template <typename U> friend BVar<U> operator+
+    ( const double, const BVar<U>& );
+  template <typename U> friend BVar<U> operator-
+    ( const BVar<U>&, const BVar<U>& );
+  template <typename U> friend BVar<U> operator-
+    ( const double, const BVar<U>& );
+  template <typename U> friend BVar<U> operator*
+    ( const BVar<U>&, const BVar<U>& );
+  template <typename U> friend BVar<U> operator*
+    ( const double, const BVar<U>& );
+  template <typename U> friend BVar<U> operator/
+    ( const BVar<U>&, const BVar<U>& );
+  template <typename U> friend BVar<U> operator/
+    ( const BVar<U>&, const double );
+  template <typename U> friend BVar<U> operator/
+    ( const double, const BVar<U>& );
+  template <typename U> friend BVar<U> sqr
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> inv
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> sqrt
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> exp
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> log
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> sin
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> cos
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> tan
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> asin
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> acos
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> atan
+    ( const BVar<U>& );
+  template <typename U> friend BVar<U> pow
+    ( const BVar<U>&, const int );
+  template <typename U> friend BVar<U> pow
+    ( const BVar<U>&, const double );
+  template <typename U> friend BVar<U> pow
+    ( const double, const BVar<U>& );
+  template <typename U> friend BVar<U> pow
+    ( const BVar<U>&, const BVar<U>& );
+
+public:
+
+  typedef typename BTape<T>::Exceptions Exceptions;
+  typedef typename BTape<T>::OPCODE OPCODE;
+
+  //! @brief Constructor for passive real constant <a>c</a>
+  BVar
+    ( const double c=0. ):
+    _tape(0), _ndx(0), _cst(c)
+    {}
+
+  //! @brief Tape on which the variable is recorded (NULL for a passive constant)
+  const BTape<T>* tape() const
+    { return _tape; }
+
+  //! @brief Value of the variable
+  T val() const
+    { return _tape? _tape->_val[_ndx]: T( _cst ); }
+
+  //! @brief Adjoint of the variable after the last reverse sweep on its tape
+  T d() const
+    { return _tape? _tape->adjoint( *this ): T( 0. ); }
+
+  BVar<T>& operator+=
+    ( const BVar<T>&X )
+    { return *this = *this + X; }
+  BVar<T>& operator-=
+    ( const BVar<T>&X )
+    { return *this = *this - X; }
+  BVar<T>& operator*=
+    ( const BVar<T>&X )
+    { return *this = *this * X; }
+  BVar<T>& operator/=
+    ( const BVar<T>&X )
+    { return *this = *this / X; }
+
+private:
+
+  //! @brief Constructor for entry <a>ndx</a> on tape <a>tape</a>
+  BVar
+    ( BTape<T>*tape, const unsigned int ndx ):
+    _tape(tape), _ndx(ndx), _cst(0.)
+    {}
+
+  //! @brief Pointer to the tape (NULL for a passive constant)
+  BTape<T>* _tape;
+  //! @brief Index of the entry on the tape
+  unsigned int _ndx;
+  //! @brief Value of a passive constant
+  double _cst;
+
+  //! @brief Value of the variable recorded on a tape
+  const T& _value() const
+    { return _tape->_val[_ndx]; }
+
+  //! @brief Record a new entry on tape <a>tape</a> (see mc::BTape::_record)
+  static BVar<T> _record
+    ( BTape<T>*tape, const OPCODE op, const unsigned int a1,
+      const unsigned int a2, const double c, const T&V )
+    { return tape->_record( op, a1, a2, c, V ); }
+
+  //! @brief Common tape of the variables <a>X1</a> and <a>X2</a>
+  static BTape<T>* _tape_check
+    ( const BVar<T>&X1, const BVar<T>&X2 )
+    {
+      if( X1._tape != X2._tape ) throw Exceptions( BTape<T>::Exceptions::TAPE );
+      return X1._tape;
+    }
+
+  //! @brief Record univariate operation <a>op</a> with value function <a>f</a> on the tape of <a>X</a>, or apply <a>fcst</a> to a passive constant
+  static BVar<T> _univ
+    ( const OPCODE op, const BVar<T>&X, T (*f)( const T& ),
+      double (*fcst)( const double& ) )
+    {
+      if( !X._tape ) return fcst( X._cst );
+      return X._tape->_record( op, X._ndx, 0, 0., f( X._value() ) );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T> inline BVar<T>
+BTape<T>::_record
+( const OPCODE op, const unsigned int a1, const unsigned int a2,
+  const double c, const T&V )
+{
+  t_node node;
+  node.op = op; node.a1 = a1; node.a2 = a2; node.c = c;
+  if( _size < _node.size() ){
+    _node[_size] = node;
+    _val[_size] = V;
+  }
+  else{
+    _node.push_back( node );
+    _val.push_back( V );
+    _adj.push_back( V );
+    _live.push_back( false );
+  }
+  return BVar<T>( this, _size++ );
+}
+
+template <typename T> inline T
+BTape<T>::adjoint
+( const BVar<T>&X ) const
+{
+  if( X._tape != this || X._ndx >= _size )
+    throw Exceptions( Exceptions::INDEX );
+  return _live[X._ndx]? _adj[X._ndx]: T( 0. );
+}
+
+template <typename T> inline void
+BTape<T>::reverse
+( const BVar<T>&F )
+{
+  if( F._tape != this || F._ndx >= _size )
+    throw Exceptions( Exceptions::INDEX );
+  typedef fadbad::Op<T> OpT;
+
+  std::fill( _live.begin(), _live.begin()+_size, false );
+  _adj[F._ndx] = T( OpT::myOne() );
+  _live[F._ndx] = true;
+
+  for( unsigned int i=F._ndx+1; i>0; ){
+    if( !_live[--i] ) continue;
+    const t_node& node = _node[i];
+    const T& A = _adj[i];
+    switch( node.op ){
+    case VAR:
+      break;
+    case ADD:
+      _add( node.a1, A ); _add( node.a2, A );
+      break;
+    case SUB:
+      _add( node.a1, A ); _sub( node.a2, A );
+      break;
+    case MUL:
+      _add( node.a1, _val[node.a2]*A ); _add( node.a2, _val[node.a1]*A );
+      break;
+    case DIV:{
+      T tmp( OpT::myInv( _val[node.a2] ) );
+      _add( node.a1, tmp*A ); _sub( node.a2, (tmp*_val[i])*A );
+      break;
+    }
+    case ADDC:
+      _add( node.a1, A );
+      break;
+    case CSUB:
+    case NEG:
+      _sub( node.a1, A );
+      break;
+    case MULC:
+      _add( node.a1, node.c*A );
+      break;
+    case DIVC:
+      _add( node.a1, (1./node.c)*A );
+      break;
+    case CDIV:
+      _sub( node.a1, (OpT::myInv( _val[node.a1] )*_val[i])*A );
+      break;
+    case SQR:
+      _add( node.a1, (OpT::myTwo()*_val[node.a1])*A );
+      break;
+    case INV:
+      _sub( node.a1, OpT::mySqr( _val[i] )*A );
+      break;
+    case SQRT:
+      _add( node.a1, OpT::myInv( _val[i]*OpT::myTwo() )*A );
+      break;
+    case EXP:
+      _add( node.a1, _val[i]*A );
+      break;
+    case LOG:
+      _add( node.a1, OpT::myInv( _val[node.a1] )*A );
+      break;
+    case SIN:
+      _add( node.a1, OpT::myCos( _val[node.a1] )*A );
+      break;
+    case COS:
+      _sub( node.a1, OpT::mySin( _val[node.a1] )*A );
+      break;
+    case TAN:
+      _add( node.a1, (OpT::mySqr( _val[i] )+OpT::myOne())*A );
+      break;
+    case ASIN:
+      _add( node.a1, OpT::myInv( OpT::mySqrt( OpT::myOne()-OpT::mySqr( _val[node.a1] ) ) )*A );
+      break;
+    case ACOS:
+      _sub( node.a1, OpT::myInv( OpT::mySqrt( OpT::myOne()-OpT::mySqr( _val[node.a1] ) ) )*A );
+      break;
+    case ATAN:
+      _add( node.a1, OpT::myInv( OpT::mySqr( _val[node.a1] )+OpT::myOne() )*A );
+      break;
+    case POW:{
+      T tmp1( _val[node.a2]*OpT::myPow( _val[node.a1], _val[node.a2]-OpT::myOne() ) );
+      T tmp2( _val[i]*OpT::myLog( _val[node.a1] ) );
+      _add( node.a1, tmp1*A ); _add( node.a2, tmp2*A );
+      break;
+    }
+    case POWI:{
+      const int n = (int)node.c;
+      _add( node.a1, ((double)n*OpT::myPow( _val[node.a1], n-1 ))*A );
+      break;
+    }
+    case POWC:
+      _add( node.a1, (node.c*OpT::myPow( _val[node.a1], node.c-1. ))*A );
+      break;
+    case CPOW:
+      _add( node.a2, (_val[i]*std::log( node.c ))*A );
+      break;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T> inline BVar<T>
+operator+
+( const BVar<T>&X )
+{
+  return X;
+}
+
+template <typename T> inline BVar<T>
+operator-
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::NEG, X, fadbad::Op<T>::myNeg,
+    fadbad::Op<double>::myNeg );
+}
+
+template <typename T> inline BVar<T>
+operator+
+( const BVar<T>&X1, const BVar<T>&X2 )
+{
+  if( !X1._tape ) return X1._cst + X2;
+  if( !X2._tape ) return X2._cst + X1;
+  BTape<T>* tape = BVar<T>::_tape_check( X1, X2 );
+  return BVar<T>::_record( tape, BTape<T>::ADD, X1._ndx, X2._ndx, 0.,
+    X1._value() + X2._value() );
+}
+
+template <typename T> inline BVar<T>
+operator+
+( const double c, const BVar<T>&X )
+{
+  if( !X._tape ) return c + X._cst;
+  return BVar<T>::_record( X._tape, BTape<T>::ADDC, X._ndx, 0, c, c + X._value() );
+}
+
+template <typename T> inline BVar<T>
+operator+
+( const BVar<T>&X, const double c )
+{
+  return c + X;
+}
+
+template <typename T> inline BVar<T>
+operator-
+( const BVar<T>&X1, const BVar<T>&X2 )
+{
+  if( !X1._tape ) return X1._cst - X2;
+  if( !X2._tape ) return X1 + (-X2._cst);
+  BTape<T>* tape = BVar<T>::_tape_check( X1, X2 );
+  return BVar<T>::_record( tape, BTape<T>::SUB, X1._ndx, X2._ndx, 0.,
+    X1._value() - X2._value() );
+}
+
+template <typename T> inline BVar<T>
+operator-
+( const double c, const BVar<T>&X )
+{
+  if( !X._tape ) return c - X._cst;
+  return BVar<T>::_record( X._tape, BTape<T>::CSUB, X._ndx, 0, c, c - X._value() );
+}
+
+template <typename T> inline BVar<T>
+operator-
+( const BVar<T>&X, const double c )
+{
+  return (-c) + X;
+}
+
+template <typename T> inline BVar<T>
+operator*
+( const BVar<T>&X1, const BVar<T>&X2 )
+{
+  if( !X1._tape ) return X1._cst * X2;
+  if( !X2._tape ) return X2._cst * X1;
+  BTape<T>* tape = BVar<T>::_tape_check( X1, X2 );
+  return BVar<T>::_record( tape, BTape<T>::MUL, X1._ndx, X2._ndx, 0.,
+    X1._value() * X2._value() );
+}
+
+template <typename T> inline BVar<T>
+operator*
+( const double c, const BVar<T>&X )
+{
+  if( !X._tape ) return c * X._cst;
+  return BVar<T>::_record( X._tape, BTape<T>::MULC, X._ndx, 0, c, c * X._value() );
+}
+
+template <typename T> inline BVar<T>
+operator*
+( const BVar<T>&X, const double c )
+{
+  return c * X;
+}
+
+template <typename T> inline BVar<T>
+operator/
+( const BVar<T>&X1, const BVar<T>&X2 )
+{
+  if( !X1._tape ) return X1._cst / X2;
+  if( !X2._tape ) return X1 / X2._cst;
+  BTape<T>* tape = BVar<T>::_tape_check( X1, X2 );
+  return BVar<T>::_record( tape, BTape<T>::DIV, X1._ndx, X2._ndx, 0.,
+    X1._value() / X2._value() );
+}
+
+template <typename T> inline BVar<T>
+operator/
+( const BVar<T>&X, const double c )
+{
+  if( !X._tape ) return X._cst / c;
+  return BVar<T>::_record( X._tape, BTape<T>::DIVC, X._ndx, 0, c, X._value() / c );
+}
+
+template <typename T> inline BVar<T>
+operator/
+( const double c, const BVar<T>&X )
+{
+  if( !X._tape ) return c / X._cst;
+  return BVar<T>::_record( X._tape, BTape<T>::CDIV, X._ndx, 0, c, c / X._value() );
+}
+
+template <typename T> inline BVar<T>
+sqr
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::SQR, X, fadbad::Op<T>::mySqr,
+    fadbad::Op<double>::mySqr );
+}
+
+template <typename T> inline BVar<T>
+inv
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::INV, X, fadbad::Op<T>::myInv,
+    fadbad::Op<double>::myInv );
+}
+
+template <typename T> inline BVar<T>
+sqrt
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::SQRT, X, fadbad::Op<T>::mySqrt,
+    fadbad::Op<double>::mySqrt );
+}
+
+template <typename T> inline BVar<T>
+exp
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::EXP, X, fadbad::Op<T>::myExp,
+    fadbad::Op<double>::myExp );
+}
+
+template <typename T> inline BVar<T>
+log
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::LOG, X, fadbad::Op<T>::myLog,
+    fadbad::Op<double>::myLog );
+}
+
+template <typename T> inline BVar<T>
+sin
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::SIN, X, fadbad::Op<T>::mySin,
+    fadbad::Op<double>::mySin );
+}
+
+template <typename T> inline BVar<T>
+cos
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::COS, X, fadbad::Op<T>::myCos,
+    fadbad::Op<double>::myCos );
+}
+
+template <typename T> inline BVar<T>
+tan
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::TAN, X, fadbad::Op<T>::myTan,
+    fadbad::Op<double>::myTan );
+}
+
+template <typename T> inline BVar<T>
+asin
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::ASIN, X, fadbad::Op<T>::myAsin,
+    fadbad::Op<double>::myAsin );
+}
+
+template <typename T> inline BVar<T>
+acos
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::ACOS, X, fadbad::Op<T>::myAcos,
+    fadbad::Op<double>::myAcos );
+}
+
+template <typename T> inline BVar<T>
+atan
+( const BVar<T>&X )
+{
+  return BVar<T>::_univ( BTape<T>::ATAN, X, fadbad::Op<T>::myAtan,
+    fadbad::Op<double>::myAtan );
+}
+
+template <typename T> inline BVar<T>
+pow
+( const BVar<T>&X, const int n )
+{
+  if( !X._tape ) return std::pow( X._cst, n );
+  return BVar<T>::_record( X._tape, BTape<T>::POWI, X._ndx, 0, n,
+    fadbad::Op<T>::myPow( X._value(), n ) );
+}
+
+template <typename T> inline BVar<T>
+pow
+( const BVar<T>&X, const double a )
+{
+  if( !X._tape ) return std::pow( X._cst, a );
+  return BVar<T>::_record( X._tape, BTape<T>::POWC, X._ndx, 0, a,
+    fadbad::Op<T>::myPow( X._value(), a ) );
+}
+
+template <typename T> inline BVar<T>
+pow
+( const double a, const BVar<T>&X )
+{
+  if( !X._tape ) return std::pow( a, X._cst );
+  return BVar<T>::_record( X._tape, BTape<T>::CPOW, 0, X._ndx, a,
+    fadbad::Op<T>::myExp( std::log( a ) * X._value() ) );
+}
+
+template <typename T> inline BVar<T>
+pow
+( const BVar<T>&X1, const BVar<T>&X2 )
+{
+  if( !X2._tape ) return pow( X1, X2._cst );
+  if( !X1._tape ) return pow( X1._cst, X2 );
+  BTape<T>* tape = BVar<T>::_tape_check( X1, X2 );
+  return BVar<T>::_record( tape, BTape<T>::POW, X1._ndx, X2._ndx, 0.,
+    fadbad::Op<T>::myPow( X1._value(), X2._value() ) );
+}
+
+template <typename T> inline std::ostream&
+operator<<
+( std::ostream&out, const BVar<T>&X )
+{
+  return out << X.val();
+}
+
+} // namespace mc
+
+#endif
@@ -0,0 +1,1879 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_CHEBYSHEV Chebyshev Model Arithmetic for Factorable Functions
+\author Beno&icirc;t Chachuat
+
+A \f$q\f$th-order Chebyshev model of a multivariate function \f$f:\mathbb{R}^n\to\mathbb{R}\f$ on the box \f$D=[x^L,x^U]\f$ consists of a \f$q^{\rm th}\f$-order multivariate polynomial \f$\mathcal P\f$ expressed in the tensor-product Chebyshev basis of the scaled variables \f$t_i=(x_i-\hat{x}_i)/r_i\in[-1,1]\f$, with \f$\hat{x}_i\f$ and \f$r_i\f$ the mid-point and radius of \f$[x_i^L,x_i^U]\f$, plus a remainder term \f$\mathcal R\f$, so that
+\f{align*}
+  f({x}) \in \sum_{|\alpha|\leq q} a_\alpha \prod_{i=1}^n T_{\alpha_i}(t_i) \oplus \mathcal R, \quad \forall {x}\in D.
+\f}
+Compared with Taylor models (see \ref page_TAYLOR), which rely on a monomial basis around a reference point, Chebyshev models are based on near-minimax polynomial approximants. They are typically tighter on wide domains for the same order [Brisebarre & Joldes, 2010; Rajyaguru <I>et al.</I>, 2017], so that a lower order, and therefore fewer coefficients, may be used to achieve a given enclosure width.
+
+The classes mc::CModel and mc::CVar provide an implementation of Chebyshev model arithmetic, with an interface similar to that of mc::TModel and mc::TVar. Products of Chebyshev models rely on the identity \f$T_mT_n=\frac{1}{2}(T_{m+n}+T_{|m-n|})\f$, which is precomputed into a product table upon construction of the Chebyshev model environment. Compositions with univariate functions are obtained from the Chebyshev interpolant of the outer function at the Chebyshev nodes of the inner range, and the interpolation error is bounded based on a bound of the derivative of order \f$q+1\f$ of the outer function. Since \f$|T_k(t)|\leq 1\f$ for all \f$t\in[-1,1]\f$, the range of the polynomial part is bounded by the sum of the absolute values of its nonconstant coefficients. We note that mc::CModel is <b>not a verified implementation</b> in the sense that rounding errors are not accounted for in propagating the coefficients in the multivariate polynomial part, which are treated as floating-point numbers.
+
+
+\section sec_CHEBYSHEV_I How do I compute a Chebyshev model with interval remainder bound of a factorable function?
+
+Suppose we want to compute a 4th-order Chebyshev model for the real-valued function \f$f(x,y)=x\exp(x+y^2)-y^2\f$ with \f$(x,y)\in [1,2]\times[0,1]\f$. For simplicity, bounds on the remainder terms are computed using the default interval type mc::Interval here:
+
+\code
+      #include "interval.hpp"
+      #include "cmodel.hpp"
+      typedef mc::Interval I;
+      typedef mc::CModel<I> CM;
+      typedef mc::CVar<I> CV;
+\endcode
+
+The number of independent variables and the order of the Chebyshev model are specified by defining an mc::CModel object, and the variables are then defined as mc::CVar objects, in the same way as Taylor models:
+
+\code
+      CM mod( 2, 4 );
+      CV X( &mod, 0, I(1.,2.) );
+      CV Y( &mod, 1, I(0.,1.) );
+      CV F = X*exp(X+pow(Y,2))-pow(Y,2);
+      std::cout << "f Chebyshev model: " << F << std::endl;
+\endcode
+
+The coefficients <tt>a0</tt>,...,<tt>a14</tt> displayed are those of the tensor-product Chebyshev polynomials with the corresponding degrees given in the subsequent columns. The remainder bound, range bound and value of the polynomial part at a given point are retrieved as:
+
+\code
+      I R = F.R();
+      I B = F.B();
+      double x[2] = { 1.5, 0.5 };
+      double Pval = F.P( x );
+\endcode
+
+
+\section sec_CHEBYSHEV_fct Which functions are overloaded for Chebyshev model arithmetic?
+
+mc::CVar overloads the usual functions <tt>exp</tt>, <tt>log</tt>, <tt>sqr</tt>, <tt>sqrt</tt>, <tt>pow</tt>, <tt>inv</tt>, <tt>cos</tt>, <tt>sin</tt>, <tt>tan</tt>, <tt>acos</tt>, <tt>asin</tt>, <tt>atan</tt>. The functions <tt>min</tt>, <tt>max</tt> and <tt>fabs</tt> are not overloaded as they are nonsmooth. The functions <tt>inter</tt> and <tt>hull</tt> are defined in the same way as for mc::TVar (see \ref sec_TAYLOR_fct).
+
+
+\section sec_CHEBYSHEV_opt How are the options set for the computation of a Chebyshev model?
+
+The class mc::CModel has a public member called mc::CModel::options that can be used to set/modify the options; e.g.,
+
+\code
+      model.options.CENTER_REMAINDER = true;
+\endcode
+
+The available options are the following:
+
+<TABLE border="1">
+<CAPTION><EM>Options in mc::CModel::Options: name, type and description</EM></CAPTION>
+     <TR><TH><b>Name</b>  <TD><b>Type</b><TD><b>Default</b>
+         <TD><b>Description</b>
+     <TR><TH><tt>PROPAGATE_BNDT</tt> <TD><tt>bool</tt> <TD>false
+         <TD>Whether to propagate bounds in arithmetic of the template parameter along with Chebyshev model arithmetic.
+     <TR><TH><tt>INTER_WITH_BNDT</tt> <TD><tt>bool</tt> <TD>false
+         <TD>Whether to intersect bounds derived from the Chebyshev model with those from the template parameter arithmetic. Only if mc::CModel::options::PROPAGATE_BNDT is set to true.
+     <TR><TH><tt>CENTER_REMAINDER</tt> <TD><tt>bool</tt> <TD>false
+         <TD>Whether to center the remainder term during Chebyshev model propagation.
+     <TR><TH><tt>REF_POLY</tt> <TD><tt>double</tt> <TD>0.
+         <TD>Scalar in \f$[0,1]\f$ related to the choice of the polynomial part in the overloaded functions mc::inter and mc::hull. A value of 0. amounts to selecting the polynomial part of the left operand, whereas a value of 1. selects the right operand.
+     <TR><TH><tt>DISPLAY_DIGITS</tt> <TD><tt>unsigned int</tt> <TD>5
+         <TD>Number of digits in output stream for Chebyshev model coefficients.
+</TABLE>
+
+
+\section sec_CM_err Errors What errors can I encounter during computation of a Chebyshev model?
+
+Errors are managed based on the exception handling mechanism of the C++ language. Each time an error is encountered, a class object of type mc::CModel::Exceptions is thrown, which contains the type of error.
+
+Possible errors encountered during the computation of a Chebyshev model are:
+
+<TABLE border="1">
+<CAPTION><EM>Errors during the Computation of a Chebyshev Model</EM></CAPTION>
+     <TR><TH><b>Number</b> <TD><b>Description</b>
+     <TR><TH><tt>1</tt> <TD>Division by zero
+     <TR><TH><tt>2</tt> <TD>Log or square-root of a Chebyshev model with nonpositive range
+     <TR><TH><tt>-1</tt> <TD>Number of variable in Chebyshev model must be nonzero
+     <TR><TH><tt>-2</tt> <TD>Failed to construct Chebyshev variable
+     <TR><TH><tt>-3</tt> <TD>Chebyshev model bound does not intersect with bound in template parameter arithmetic
+     <TR><TH><tt>-4</tt> <TD>Operation between Chebyshev variables linked to different Chebyshev models
+     <TR><TH><tt>-5</tt> <TD>Maximum size of Chebyshev model reached (monomials indexed as unsigned int)
+     <TR><TH><tt>-33</tt> <TD>Feature not yet implemented in mc::CModel
+</TABLE>
+
+Moreover, exceptions may be thrown by the template parameter class itself.
+
+
+\section sec_CM_refs References
+
+- Brisebarre, N., and M. Joldes, <A href="http://dx.doi.org/10.1145/1837934.1837966">Chebyshev interpolation polynomial-based tools for rigorous computing</A>, <i>Proceedings of the 2010 International Symposium on Symbolic and Algebraic Computation (ISSAC)</i>, pp. 147-154, 2010
+- Rajyaguru, J., M.E. Villanueva, B. Houska, and B. Chachuat, <A href="http://dx.doi.org/10.1007/s10898-016-0474-9">Chebyshev model arithmetic for factorable functions</A>, <i>Journal of Global Optimization</i>, <b>68</b>(2):413-438, 2017
+- Trefethen, L.N., <I>Approximation Theory and Approximation Practice</I>, SIAM, 2013
+.
+*/
+
+#ifndef MC__CMODEL_H
+#define MC__CMODEL_H
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <cassert>
+#include <climits>
+#include <cmath>
+#include <vector>
+
+#include "mcfunc.hpp"
+#include "mcop.hpp"
+
+#undef  MC__CMODEL_DEBUG
+
+namespace mc
+{
+
+template <typename T> class CVar;
+typedef unsigned long long CM_size;
+
+//! @brief C++ class for Chebyshev model computation of factorable function - Chebyshev model environment
+////////////////////////////////////////////////////////////////////////
+//! mc::CModel is a C++ class for definition of Chebyshev model
+//! environment. Propagation of Chebyshev models for factorable
+//! functions is via the C++ class mc::CVar. The template parameter
+//! corresponds to the type used to propagate the remainder bound.
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class CModel
+////////////////////////////////////////////////////////////////////////
+{
+  friend class CVar<T>;
+  template <typename U> friend class CModel;
+
+  template <typename U> friend CVar<U> operator*
+    ( const CVar<U>&, const CVar<U>& );
+  template <typename U> friend CVar<U> inv
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> sqrt
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> log
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> exp
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> cos
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> atan
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> pow
+    ( const CVar<U>&, const int );
+
+public:
+
+  /** @addtogroup CHEBYSHEV Chebyshev Model Arithmetic for Factorable Functions
+   *  @{
+   */
+  //! @brief Constructor of Chebyshev model environment for <tt>nvar</tt> variables and order <tt>nord</tt>
+  CModel
+    ( const unsigned int nvar, const unsigned int nord )
+    { _size( nvar, nord ); }
+
+  //! @brief Destructor of Chebyshev model environment
+  ~CModel()
+    { _cleanup(); }
+
+  //! @brief Number of variables in Chebyshev model environment
+  unsigned int nvar() const
+    { return _nvar; };
+
+  //! @brief Order of Chebyshev model environment
+  unsigned int nord() const
+    { return _nord; };
+
+  //! @brief Total number of monomial terms in Chebyshev variable
+  unsigned int nmon() const
+    { return _nmon; };
+
+  //! @brief Const pointer to array of size <tt>nmon()*nvar()</tt> with Chebyshev degrees in each monomial term. The degree for variable <tt>ivar</tt> in monomial term <tt>imon</tt> is at position <tt>imon*nvar()+ivar</tt>.
+  const unsigned int* expmon() const
+    { return _expmon; };
+
+  //! @brief Index of monomial term whose Chebyshev degrees are the same as those in array <tt>iexp</tt> (of size <tt>nvar()</tt>)
+  unsigned int loc_expmon
+    ( const unsigned int *iexp ) const
+    { return _loc_expmon( iexp ); }
+
+  //! @brief Exceptions of mc::CModel
+  class Exceptions
+  {
+  public:
+    //! @brief Enumeration type for CModel exception handling
+    enum TYPE{
+      DIV=1,	//!< Division by zero scalar
+      DOMAIN,	//!< Log or square-root of a Chebyshev model with nonpositive range
+      SIZE=-1,	//!< Number of variable in Chebyshev model must be nonzero
+      INIT=-2,	//!< Failed to construct Chebyshev variable
+      INCON=-3, //!< Chebyshev model bound does not intersect with bound in template parameter arithmetic
+      CMODEL=-4,//!< Operation between Chebyshev variables linked to different Chebyshev models
+      MAXSIZE=-5,//!< Maximum size of Chebyshev model reached (monomials indexed as unsigned int)
+      UNDEF=-33 //!< Feature not yet implemented in mc::CModel
+    };
+    //! @brief Constructor for error <a>ierr</a>
+    Exceptions( TYPE ierr ) : _ierr( ierr ){}
+    //! @brief Error flag
+    int ierr(){ return _ierr; }
+    //! @brief Error description
+    std::string what(){
+      switch( _ierr ){
+      case DIV:
+        return "mc::CModel\t Division by zero scalar";
+      case DOMAIN:
+        return "mc::CModel\t Log or square-root of Chebyshev model with nonpositive range";
+      case SIZE:
+        return "mc::CModel\t Inconsistent Chebyshev model dimension";
+      case INIT:
+        return "mc::CModel\t Chebyshev variable initialization failed";
+      case INCON:
+        return "mc::CModel\t Inconsistent bounds with template parameter arithmetic";
+      case CMODEL:
+        return "mc::CModel\t Operation between Chebyshev variables in different Chebyshev model environment not allowed";
+      case MAXSIZE:
+        return "mc::CModel\t Maximum size in Chebyshev model reached";
+      case UNDEF:
+        return "mc::CModel\t Feature not yet implemented in mc::CModel class";
+      default:
+        return "mc::CModel\t Undocumented error";
+      }
+    }
+
+  private:
+    TYPE _ierr;
+  };
+
+  //! @brief Options of mc::CModel
+  struct Options
+  {
+    //! @brief Constructor of mc::CModel::Options
+    Options():
+      PROPAGATE_BNDT(false), INTER_WITH_BNDT(false), CENTER_REMAINDER(false),
+      REF_POLY(0.), DISPLAY_DIGITS(5)
+      {}
+    //! @brief Copy constructor of mc::CModel::Options
+    template <typename U> Options
+      ( U&options )
+      : PROPAGATE_BNDT( options.PROPAGATE_BNDT ),
+        INTER_WITH_BNDT( options.INTER_WITH_BNDT ),
+        CENTER_REMAINDER( options.CENTER_REMAINDER ),
+        REF_POLY( options.REF_POLY ),
+        DISPLAY_DIGITS( options.DISPLAY_DIGITS )
+      {}
+    //! @brief Assignment of mc::CModel::Options
+    template <typename U> Options& operator =
+      ( U&options ){
+        PROPAGATE_BNDT   = options.PROPAGATE_BNDT;
+        INTER_WITH_BNDT  = options.INTER_WITH_BNDT;
+        CENTER_REMAINDER = options.CENTER_REMAINDER;
+        REF_POLY         = options.REF_POLY;
+        DISPLAY_DIGITS   = options.DISPLAY_DIGITS;
+        return *this;
+      }
+    //! @brief Whether to propagate bounds in arithmetic of the template parameter along with Chebyshev model arithmetic
+    bool PROPAGATE_BNDT;
+    //! @brief Whether to intersect bounds derived from the Chebyshev model with those from the template parameter arithmetic. Only if mc::CModel::options::PROPAGATE_BNDT is set to <tt>true</tt>.
+    bool INTER_WITH_BNDT;
+    //! @brief Whether to center the remainder term during Chebyshev model propagation
+    bool CENTER_REMAINDER;
+    //! @brief Scalar in \f$[0,1]\f$ related to the choice of the polynomial part in the overloaded functions mc::inter and mc::hull. A value of 0. amounts to selecting the polynomial part of the left operand, whereas a value of 1. selects the right operand.
+    double REF_POLY;
+    //! @brief Number of digits in output stream for Chebyshev model coefficients.
+    unsigned int DISPLAY_DIGITS;
+  } options;
+  /** @} */
+
+private:
+  //! @brief Order of Chebyshev model
+  unsigned int _nord;
+  //! @brief Number of variables in Chebyshev model
+  unsigned int _nvar;
+  //! @brief Total number of monomial terms in Chebyshev model
+  unsigned int _nmon;
+  //! @brief Array of size <tt>_nord+2</tt> with indices of first monomial term of order <tt>iord=0,...,_nord+1</tt> in Chebyshev model
+  unsigned int *_posord;
+  //! @brief Array of size <tt>_nmon*_nvar</tt> with Chebyshev degrees in monomial terms. The degree for variable <tt>ivar</tt> in monomial term <tt>imon</tt> is at location <tt>imon*nvar()+ivar</tt>.
+  unsigned int *_expmon;
+  //! @brief Array of size <tt>_nmon</tt> of pointers to the product table of monomial term <tt>imon</tt> with monomial terms <tt>jmon=imon,...,_nmon-1</tt>. For each pair, the table stores the number of product terms of order up to <tt>_nord</tt>, the number of product terms of order greater than <tt>_nord</tt>, and the indices of the former.
+  unsigned int **_prodmon;
+  //! @brief Array of <tt>(_nvar+_nord-1)*(_nord+1)</tt> contining binomial coefficients
+  CM_size *_binom;
+  //! @brief Array of size <tt>_nvar</tt> with reference points for the variables
+  double *_refpoint;
+  //! @brief Array of size <tt>_nvar</tt> with scaling for the variables
+  double *_scaling;
+  //! @brief Array of size <tt>_nord+1</tt> with Chebyshev interpolant coefficients for univariate terms
+  double *_ccheb;
+
+  //! @brief Internal Chebyshev variable to speed-up computations and reduce dynamic allocation
+  CVar<T>* _CV;
+
+  //! @brief Set Chebyshev model order <tt>nord</tt> and number of variables <tt>nvar</tt>
+  void _size
+    ( const unsigned int nvar, const unsigned int nord );
+
+  //! @brief Populate array <tt>_posord</tt>
+  void _set_posord();
+
+  //! @brief Populate array <tt>_expmon</tt>
+  void _set_expmon();
+
+  //! @brief Generate variable exponents <tt>iexp</tt> for subsequent monomial order <tt>iord</tt>
+  void _next_expmon
+    ( unsigned int *iexp, const unsigned int iord ) const;
+
+  //! @brief Populate product table <tt>_prodmon</tt>
+  void _set_prodmon();
+
+  //! @brief Get index of monomial term with Chebyshev degrees <tt>iexp</tt> in <tt>0,...,_nmon-1</tt>
+  unsigned int _loc_expmon
+    ( const unsigned int *iexp ) const;
+
+  //! @brief Populate array <tt>_binom</tt> with binomial coefficients
+  void _set_binom();
+
+  //! @brief Get binomial coefficient \f$\left(\stackrel{n}{k}\right)\f$
+  CM_size _get_binom
+    ( const unsigned int n, const unsigned int k ) const;
+
+  //! @brief Clean up the arrays
+  void _cleanup();
+
+  //! @brief Prototype real-valued function for univariate terms
+  typedef double (puniv)
+    ( const double x, const double*rusr, const int*iusr );
+
+  //! @brief Prototype bound on the derivative of order <tt>n</tt> of univariate terms
+  typedef T (punivder)
+    ( const T&x, const unsigned int n, const double*rusr, const int*iusr );
+
+  //! @brief Compute Chebyshev model of a univariate term as the composition of its Chebyshev interpolant with <tt>CV</tt>
+  CVar<T> _univ_chebyshev
+    ( const CVar<T>&CV, puniv f, punivder dnf, const double*rusr,
+      const int*iusr );
+
+  //! @brief Recursive calculation of nonnegative integer powers
+  CVar<T> _intpow
+    ( const CVar<T>&CV, const int n );
+} ;
+
+//! @brief C++ class for Chebyshev model computation of factorable function - Chebyshev model propagation
+////////////////////////////////////////////////////////////////////////
+//! mc::CVar is a C++ class for propagation of Chebyshev models through
+//! factorable functions. The template parameter corresponds to the
+//! type used in computing the remainder bound.
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class CVar
+////////////////////////////////////////////////////////////////////////
+{
+  template <typename U> friend class CVar;
+  template <typename U> friend class CModel;
+
+  template <typename U> friend CVar<U> operator+
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> operator-
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> operator*
+    ( const CVar<U>&, const CVar<U>& );
+  template <typename U> friend std::ostream& operator<<
+    ( std::ostream&, const CVar<U>& );
+
+  template <typename U> friend CVar<U> inv
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> sqr
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> sqrt
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> exp
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> log
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> pow
+    ( const CVar<U>&, const int );
+  template <typename U> friend CVar<U> cos
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> asin
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> atan
+    ( const CVar<U>& );
+  template <typename U> friend CVar<U> hull
+    ( const CVar<U>&, const CVar<U>& );
+  template <typename U> friend bool inter
+    ( CVar<U>&, const CVar<U>&, const CVar<U>& );
+
+private:
+  //! @brief Pointer to Chebyshev model environment
+  CModel<T> *_CM;
+  //! @brief Pointer to internal Chebyshev variable in Chebyshev model environment
+  CVar<T>* _CV() const
+    { return _CM->_CV; };
+  //! @brief Order of Chebyshev model environment
+  unsigned int _nord() const
+    { return _CM->_nord; };
+  //! @brief Number of variables in Chebyshev model environment
+  unsigned int _nvar() const
+    { return _CM->_nvar; };
+  //! @brief Total number of monomial terms in Chebyshev variable
+  unsigned int _nmon() const
+    { return _CM->_nmon; };
+  //! @brief Index of first monomial term of order <tt>iord</tt> in Chebyshev variable
+  unsigned int _posord
+    ( const unsigned int iord ) const
+    { return _CM->_posord[iord]; };
+  //! @brief Const pointer to array of size <tt>nvar()</tt> of Chebyshev degrees in monomial term <tt>imon</tt>
+  const unsigned int* _expmon
+    ( const unsigned int imon ) const
+    { return _CM->_expmon+imon*_CM->_nvar; };
+  //! @brief Reference point for variable <tt>ivar</tt> in Chebyshev model
+  double _refpoint
+    ( const unsigned int ivar ) const
+    { return _CM->_refpoint[ivar]; };
+  //! @brief Scaling for variable <tt>ivar</tt> in Chebyshev model
+  double _scaling
+    ( const unsigned int ivar ) const
+    { return _CM->_scaling[ivar]; };
+
+public:
+  /** @addtogroup CHEBYSHEV Chebyshev Model Arithmetic for Factorable Functions
+   *  @{
+   */
+  //! @brief Constructor of Chebyshev variable for a real scalar
+  CVar
+    ( const double d=0. );
+  //! @brief Constructor of Chebyshev variable for a remainder bound
+  CVar
+    ( const T&B );
+  //! @brief Constructor of Chebyshev variable with index <a>ix</a> (starting from 0) and bounded by <a>X</a>
+  CVar
+    ( CModel<T>*CM, const unsigned int ix, const T&X );
+  //! @brief Copy constructor of Chebyshev variable
+  CVar
+    ( const CVar<T>&CV );
+
+  //! @brief Destructor of Chebyshev variable
+  ~CVar()
+    { delete [] _coefmon; delete [] _bndord; }
+
+  //! @brief Set Chebyshev variable with index <a>ix</a> (starting from 0) and bounded by <a>X</a>
+  CVar<T>& set
+    ( CModel<T>*CM, const unsigned int ix, const T&X )
+    { *this = CVar( CM, ix, X ); return *this; }
+
+  //! @brief Set multivariate polynomial coefficients in Chebyshev variable to <tt>coefmon</tt>
+  CVar<T>& set
+    ( const double*coefmon )
+    { for( unsigned int imon=0; imon<(_CM?_nmon():1); imon++ )
+        _coefmon[imon] = coefmon[imon];
+      _update_bndord(); return *this; }
+
+  //! @brief Set remainder term in Chebyshev variable to <tt>bndrem</tt>
+  CVar<T>& set
+    ( const T&bndrem )
+    { *_bndrem = bndrem; return *this; }
+
+  //! @brief Get pointer to Chebyshev model environment
+  CModel<T>* env() const
+    { return _CM; }
+
+  //! @brief Compute bound on all terms of (total) order <tt>iord</tt> in Chebyshev variable
+  T bound
+    ( const unsigned int iord ) const
+    { return (!iord || (_CM && iord<=_nord()))? _bndord[iord]: 0.; }
+
+  //! @brief Compute bound on Chebyshev variable
+  T bound() const
+    { T bndmod; return _bound( bndmod ); }
+
+  //! @brief Return reference to variable bound in template parameter arithmetic
+  const T& boundT() const
+    { return _bndT; }
+
+  //! @brief Return remainder term of Chebyshev variable
+  T remainder() const
+    { return( *_bndrem ); }
+
+  //! @brief Center remainder term of Chebyshev variable
+  CVar<T>& center()
+    { _center_CM(); return *this; }
+
+  //! @brief Return new Chebyshev variable with same multivariate polynomial part and zero remainder
+  CVar<T> polynomial() const
+    { CVar<T> CV = *this; *(CV._bndrem) = 0.; return CV; }
+
+  //! @brief Evaluate polynomial part at <tt>x</tt>
+  double polynomial
+    ( const double*x ) const;
+
+  //! @brief Shortcut to mc::CVar::bound
+  T B
+    ( const unsigned int iord ) const
+    { return bound( iord ); }
+
+  //! @brief Shortcut to mc::CVar::bound
+  T B() const
+    { T bndmod; return _bound( bndmod ); }
+
+  //! @brief Shortcut to mc::CVar::remainder
+  T R() const
+    { return remainder(); }
+
+  //! @brief Shortcut to mc::CVar::center
+  CVar<T>& C()
+    { return center(); }
+
+  //! @brief Shortcut to mc::CVar::polynomial
+  CVar<T> P() const
+    { return polynomial(); }
+
+  //! @brief Shortcut to mc::CVar::polynomial
+  double P
+    ( const double*x ) const
+    { return polynomial( x ); }
+
+  //! @brief Get coefficient of constant term in Chebyshev variable
+  double constant() const
+    { return _coefmon[0]; }
+
+  //! @brief Get coefficient in monomial term with Chebyshev degrees as given in <a>iexp</a>
+  double coefmon
+    ( const unsigned int*iexp ) const;
+
+  //! @brief Get pair of size of, and const pointer to, array of monomial coefficients in multivariate polynomial of Chebyshev variable
+  std::pair<unsigned int, const double*> coefmon() const
+    { return std::make_pair( (_CM?_nmon():1), _coefmon ); }
+  /** @} */
+
+  CVar<T>& operator =
+    ( const double );
+  CVar<T>& operator =
+    ( const CVar<T>& );
+  CVar<T>& operator =
+    ( const T& );
+  CVar<T>& operator +=
+    ( const CVar<T>& );
+  CVar<T>& operator +=
+    ( const T& );
+  CVar<T>& operator +=
+    ( const double );
+  CVar<T>& operator -=
+    ( const CVar<T>& );
+  CVar<T>& operator -=
+    ( const T& );
+  CVar<T>& operator -=
+    ( const double );
+  CVar<T>& operator *=
+    ( const CVar<T>& );
+  CVar<T>& operator *=
+    ( const double );
+  CVar<T>& operator *=
+    ( const T& );
+  CVar<T>& operator /=
+    ( const CVar<T>& );
+  CVar<T>& operator /=
+    ( const double );
+
+private:
+
+  //! @brief Private constructor for real scalar in Chebyshev model environment <tt>CM</tt>
+  CVar
+    ( CModel<T>*CM, const double d=0. );
+
+  //! @brief Array of size <tt>_nmon</tt> with monomial coefficients
+  double *_coefmon;
+  //! @brief Array of size <tt>_nord+2</tt> with bounds for all terms of degrees <tt>iord=0,...,_nord</tt> as well as the remainder bound at position <tt>_nord+1</tt>
+  T * _bndord;
+  //! @brief Pointer to the remainder bound
+  T * _bndrem;
+  //! @brief Bound evaluated in T arithmetic
+  T _bndT;
+
+  //! @brief Update bounds for all terms of degrees <tt>iord=0,...,_nord</tt> in <tt>_bndord</tt>
+  void _update_bndord();
+  //! @brief Center remainder error term <tt>_bndrem</tt>
+  void _center_CM();
+  //! @brief Range bounder - sum of absolute values of the nonconstant coefficients
+  T& _bound
+    ( T& bndmod ) const;
+  //! @brief Bound on polynomial part (excluding remainder)
+  T _bound_poly() const;
+
+  //! @brief Initialize private members
+  void _init();
+  //! @brief Reinitialize private members
+  void _reinit();
+  //! @brief Clean up private members
+  void _clean();
+};
+
+////////////////////////////////// CModel //////////////////////////////////////
+
+template <typename T> inline void
+CModel<T>::_size
+( const unsigned int nvar, const unsigned int nord )
+{
+  if( !nvar ) throw Exceptions( Exceptions::SIZE );
+
+  _nvar = nvar;
+  _nord = nord;
+  _binom = new CM_size[(nvar+nord-1)*(nord+1)];
+  _set_binom();
+  _posord = new unsigned int[nord+2];
+  _set_posord();
+  _nmon = _posord[_nord+1];
+  _expmon = new unsigned int[_nmon*nvar];
+  _set_expmon();
+  _set_prodmon();
+  _refpoint = new double[_nvar];
+  _scaling = new double[_nvar];
+  for( unsigned int i=0; i<_nvar; i++ ){ _refpoint[i] = 0.; _scaling[i] = 1.; }
+  _ccheb = new double[_nord+1];
+
+  _CV = new CVar<T>( this );
+}
+
+template <typename T> inline void
+CModel<T>::_set_posord()
+{
+  _posord[0] = 0;
+  _posord[1] = 1;
+  for( unsigned int i=1; i<=_nord; i++ ){
+    CM_size _posord_next = _posord[i] + _get_binom( _nvar+i-1, i );
+    if( _posord_next > UINT_MAX )
+      throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::MAXSIZE );
+    _posord[i+1] = _posord_next;
+  }
+
+#ifdef MC__CMODEL_DEBUG
+  mc::display( 1, _nord+2, _posord, 1, "_posord", std::cout );
+#endif
+}
+
+template <typename T> inline void
+CModel<T>::_set_expmon()
+{
+  unsigned int *iexp = new unsigned int[_nvar] ;
+  for( unsigned int k=0; k<_nvar; k++ ) _expmon[k] = 0;
+  for( unsigned int i=1; i<=_nord; i++ ){
+    for( unsigned int j=0; j<_nvar; j++ ) iexp[j] = 0;
+    for( unsigned int j=_posord[i]; j<_posord[i+1]; j++ ){
+      _next_expmon( iexp, i );
+      for( unsigned int k=0; k<_nvar; k++ )
+        _expmon[j*_nvar+k] = iexp[k];
+    }
+  }
+  delete[] iexp;
+}
+
+template <typename T> inline void
+CModel<T>::_next_expmon
+( unsigned int *iexp, const unsigned int iord ) const
+{
+  unsigned int curord;
+  do{
+    iexp[_nvar-1] += iord;
+    unsigned int j = _nvar;
+    while( j > 0 && iexp[j-1] > iord ){
+      iexp[j-1] -= iord + 1;
+      j-- ;
+      iexp[j-1]++;
+    }
+    curord = 0;
+    for( unsigned int i=0; i<_nvar; i++ ) curord += iexp[i];
+  } while( curord != iord );
+}
+
+template <typename T> inline void
+CModel<T>::_set_prodmon()
+{
+  // The product of T_a and T_b is (T_{a+b}+T_{|a-b|})/2 in each variable
+  // where both degrees are nonzero, and T_{a+b} otherwise. Each pair of
+  // monomial terms thus produces 2^k terms with equal weight 1/2^k.
+  _prodmon = new unsigned int*[_nmon];
+  unsigned int *iexp = new unsigned int[_nvar];
+  unsigned int *ivar = new unsigned int[_nvar];
+  std::vector<unsigned int> table;
+  for( unsigned int i=0; i<_nmon; i++ ){
+    table.clear();
+    for( unsigned int j=i; j<_nmon; j++ ){
+      const unsigned int*iexpi = _expmon+i*_nvar, *iexpj = _expmon+j*_nvar;
+      unsigned int nshared = 0;
+      for( unsigned int k=0; k<_nvar; k++ )
+        if( iexpi[k] && iexpj[k] ) ivar[nshared++] = k;
+      const unsigned int pos = table.size();
+      table.push_back( 0 ); table.push_back( 0 );
+      for( unsigned int icomb=0; icomb<(1u<<nshared); icomb++ ){
+        unsigned int ord = 0;
+        for( unsigned int k=0; k<_nvar; k++ ) iexp[k] = iexpi[k] + iexpj[k];
+        for( unsigned int l=0; l<nshared; l++ ){
+          if( !((icomb>>l)&1) ) continue;
+          const unsigned int k = ivar[l];
+          iexp[k] = ( iexpi[k]>iexpj[k]? iexpi[k]-iexpj[k]: iexpj[k]-iexpi[k] );
+        }
+        for( unsigned int k=0; k<_nvar; k++ ) ord += iexp[k];
+        if( ord > _nord ){ table[pos+1]++; continue; }
+        table[pos]++;
+        table.push_back( _loc_expmon( iexp ) );
+      }
+    }
+    _prodmon[i] = new unsigned int[table.size()];
+    for( unsigned int k=0; k<table.size(); k++ ) _prodmon[i][k] = table[k];
+  }
+  delete[] iexp;
+  delete[] ivar;
+}
+
+template <typename T> inline unsigned int
+CModel<T>::_loc_expmon
+( const unsigned int *iexp ) const
+{
+  unsigned int ord = 0;
+  for( unsigned int i=0; i<_nvar; i++ ) ord += iexp[i];
+  assert( ord<_nord+2 );
+  unsigned int pos = _posord[ord];
+
+  unsigned int p = _nvar ;
+  for( unsigned int i=0; i<_nvar-1; i++ ){
+    p--;
+    for( unsigned int j=0; j<iexp[i]; j++ )
+      pos += _get_binom( p-1+ord-j, ord-j );
+    ord -= iexp[i];
+  }
+
+  return pos;
+}
+
+template <typename T> inline void
+CModel<T>::_set_binom()
+{
+  CM_size *p;
+  unsigned int k;
+  for( unsigned int i=0; i<_nvar+_nord-1; i++ ){
+    p = &_binom[i*(_nord+1)];
+    *p = 1;
+    p++;
+    *p = i+1;
+    p++;
+    k = ( i+1<_nord? i+1: _nord );
+    for( unsigned int j=2; j<=k; j++, p++ ) *p = *(p-1) * (i+2-j)/j;
+    for( unsigned int j=k+1; j<=_nord; j++, p++ ) *p = 0.;
+  }
+}
+
+template <typename T> inline CM_size
+CModel<T>::_get_binom
+( const unsigned int n, const unsigned int k ) const
+{
+  assert( k<=n );
+  return( n? _binom[(n-1)*(_nord+1)+k]: 1. );
+}
+
+template <typename T> inline void
+CModel<T>::_cleanup()
+{
+  for( unsigned int i=0; i<_nmon; i++ ) delete[] _prodmon[i];
+  delete[] _prodmon;
+  delete[] _expmon;
+  delete[] _posord;
+  delete[] _refpoint;
+  delete[] _scaling;
+  delete[] _ccheb;
+  delete[] _binom;
+  delete _CV;
+}
+
+template <typename T> inline CVar<T>
+CModel<T>::_univ_chebyshev
+( const CVar<T>&CV, puniv f, punivder dnf, const double*rusr,
+  const int*iusr )
+{
+  assert( CV._CM == this );
+
+  const T B( CV.B() );
+  const double xmid = Op<T>::mid(B), xrad = Op<T>::diam(B)/2.;
+  if( isequal( xrad, 0. ) ) return CVar<T>( this, f( xmid, rusr, iusr ) );
+
+  // Chebyshev interpolant coefficients at the Chebyshev nodes in B
+  for( unsigned int k=0; k<=_nord; k++ ) _ccheb[k] = 0.;
+  for( unsigned int j=0; j<=_nord; j++ ){
+    const double tj = std::cos( PI*(2.*j+1.)/(2.*_nord+2.) );
+    const double fj = f( xmid+xrad*tj, rusr, iusr );
+    double Tkm1 = 1., Tk = tj;
+    _ccheb[0] += fj;
+    for( unsigned int k=1; k<=_nord; k++ ){
+      _ccheb[k] += fj * Tk;
+      const double Tkp1 = 2.*tj*Tk - Tkm1;
+      Tkm1 = Tk; Tk = Tkp1;
+    }
+  }
+  for( unsigned int k=0; k<=_nord; k++ ) _ccheb[k] *= 2./(_nord+1.);
+  _ccheb[0] /= 2.;
+
+  // Composition with the inner model scaled in [-1,1]
+  CVar<T> CVs( ( CV - xmid ) / xrad );
+  CVar<T> CV2( this, _ccheb[0] ), Tkm1( this, 1. ), Tk( CVs );
+  for( unsigned int k=1; k<=_nord; k++ ){
+    CV2 += _ccheb[k] * Tk;
+    if( k == _nord ) break;
+    CVar<T> Tkp1( 2. * CVs * Tk - Tkm1 );
+    Tkm1 = Tk; Tk = Tkp1;
+  }
+
+  // Interpolation error bound: |f^(n+1)|/(n+1)! * 2*(r/2)^(n+1)
+  double s = 2.;
+  for( unsigned int k=1; k<=_nord+1; k++ ) s *= xrad/2./k;
+  CV2 += s * dnf( B, _nord+1, rusr, iusr ) * ( 2.*Op<T>::zeroone()-1. );
+  return CV2;
+}
+
+template <typename T> inline CVar<T>
+CModel<T>::_intpow
+( const CVar<T>&CV, const int n )
+{
+  if( n == 0 ) return CVar<T>( this, 1. );
+  else if( n == 1 ) return CV;
+  return n%2 ? sqr( _intpow( CV, n/2 ) ) * CV : sqr( _intpow( CV, n/2 ) );
+}
+
+////////////////////////////////// CVar ///////////////////////////////////////
+
+template <typename T> inline
+CVar<T>::CVar
+( const double d )
+: _CM( 0 ), _bndT( d )
+{
+  _init();
+  _coefmon[0] = d;
+  _bndord[0] = 0.;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator =
+( const double d )
+{
+  if( _CM ){ _CM = 0; _reinit(); }
+  _coefmon[0] = d;
+  _bndord[0] = 0.;
+  return *this;
+}
+
+template <typename T> inline
+CVar<T>::CVar
+( CModel<T>*CM, const double d )
+: _CM( CM )
+{
+  if( !_CM )
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::INIT );
+  _init();
+  _coefmon[0] = d;
+  for( unsigned int i=1; i<_nmon(); i++ ) _coefmon[i] = 0.;
+  _bndord[0] = d;
+  for( unsigned int i=1; i<_nord()+2; i++) _bndord[i] = 0.;
+  if( _CM->options.PROPAGATE_BNDT ) _bndT = d;
+}
+
+template <typename T> inline
+CVar<T>::CVar
+( const T&B )
+: _CM( 0 ), _bndT( B )
+{
+  _init();
+  _coefmon[0] = 0.;
+  _bndord[0] = B;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator =
+( const T&B )
+{
+  if( _CM ){ _CM = 0; _reinit(); }
+  _coefmon[0] = 0.;
+  _bndord[0] = B;
+  return *this;
+}
+
+template <typename T> inline
+CVar<T>::CVar
+( const CVar<T>&CV )
+: _CM(0)
+{
+  _init();
+  *this = CV;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator =
+( const CVar<T>&CV )
+{
+  // Same CVar
+  if( this == &CV ) return *this;
+
+  // Reinitialization needed?
+  if( _CM != CV._CM ){ _CM = CV._CM; _reinit(); }
+
+  // Set to CVar not linked to CModel (either scalar or range)
+  if( !_CM ){
+    _coefmon[0] = CV._coefmon[0];
+    _bndord[0] = CV._bndord[0];
+    return *this;
+  }
+  // Set to CVar linked to CModel
+  for( unsigned int i=0; i<_nmon(); i++ ) _coefmon[i] = CV._coefmon[i];
+  for( unsigned int i=0; i<_nord()+2; i++) _bndord[i] = CV._bndord[i];
+  if( _CM->options.PROPAGATE_BNDT ) _bndT = CV._bndT;
+  return *this;
+}
+
+template <typename T> inline
+CVar<T>::CVar
+( CModel<T>*CM, const unsigned int ivar, const T&X )
+: _CM( CM )
+{
+  if( !CM || ivar>=CM->_nvar )
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::INIT );
+
+  // Keep track of variable mid-point and radius in CModel
+  double scaling = Op<T>::diam(X)/2.;
+  if( isequal( scaling, 0. ) ) scaling = 1.;
+  _CM->_refpoint[ivar] = Op<T>::mid(X);
+  _CM->_scaling[ivar] = scaling;
+  _init();
+
+  // Populate _coefmon w/ CVar coefficients
+  _coefmon[0] = Op<T>::mid(X);
+  for( unsigned int i=1; i<_nmon(); i++ ) _coefmon[i] = 0.;
+  if( _nord() > 0 ) _coefmon[_nvar()-ivar] = scaling;
+
+  // Populate _bndord w/ bounds on CVar terms
+  _bndord[0] = _coefmon[0];
+  _bndord[1] = X-_coefmon[0];
+  for( unsigned int i=2; i<_nord()+2; i++) _bndord[i] = 0.;
+  if( !_nord() ) *_bndrem = X-_coefmon[0];
+  if( _CM->options.PROPAGATE_BNDT ) _bndT = X;
+}
+
+template <typename T> inline void
+CVar<T>::_init()
+{
+  if( !_CM ){
+    _coefmon = new double[1];
+    _bndord  = new T[1];
+    _bndrem  = _bndord;
+    return;
+  }
+  _coefmon = new double[_nmon()];
+  _bndord  = new T[_nord()+2];
+  _bndrem  = _bndord + _nord()+1;
+}
+
+template <typename T> inline void
+CVar<T>::_clean()
+{
+  delete [] _coefmon; delete [] _bndord;
+  _coefmon = 0; _bndord = _bndrem = 0;
+}
+
+template <typename T> inline void
+CVar<T>::_reinit()
+{
+  _clean(); _init();
+}
+
+template <typename T> inline void
+CVar<T>::_update_bndord()
+{
+  if( !_CM ) return;
+  _bndord[0] = _coefmon[0];
+  for( unsigned int i=1; i<=_nord(); i++ ){
+    double sabs = 0.;
+    for( unsigned int j=_posord(i); j<_posord(i+1); j++ )
+      sabs += std::fabs( _coefmon[j] );
+    _bndord[i] = sabs * ( 2.*Op<T>::zeroone()-1. );
+  }
+}
+
+template <typename T> inline void
+CVar<T>::_center_CM()
+{
+  const double remmid = Op<T>::mid(*_bndrem);
+  _coefmon[0] += remmid;
+  if( _CM ) _bndord[0] = _coefmon[0];
+  *_bndrem -= remmid;
+}
+
+template <typename T> inline T
+CVar<T>::_bound_poly() const
+{
+  if( !_CM ) return _coefmon[0];
+  T bndpol = _coefmon[0];
+  for( unsigned int i=1; i<=_nord(); i++ ) bndpol += _bndord[i];
+  return bndpol;
+}
+
+template <typename T> inline T&
+CVar<T>::_bound
+( T& bndmod ) const
+{
+  if( !_CM ){ bndmod = _coefmon[0] + _bndord[0]; return bndmod; }
+
+  bndmod = _bound_poly() + *_bndrem;
+  if( _CM->options.PROPAGATE_BNDT && _CM->options.INTER_WITH_BNDT
+    && !Op<T>::inter( bndmod, bndmod, _bndT ) )
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::INCON );
+
+  return bndmod;
+}
+
+template <typename T> inline double
+CVar<T>::polynomial
+( const double*x ) const
+{
+  if( !_CM ) return _coefmon[0];
+
+  // Chebyshev polynomials T_0,...,T_nord for each scaled variable
+  double*Tval = new double[_nvar()*(_nord()+1)];
+  for( unsigned int k=0; k<_nvar(); k++ ){
+    const double t = ( x[k] - _refpoint(k) ) / _scaling(k);
+    double*Tk = Tval + k*(_nord()+1);
+    Tk[0] = 1.;
+    if( _nord() ) Tk[1] = t;
+    for( unsigned int i=2; i<=_nord(); i++ ) Tk[i] = 2.*t*Tk[i-1] - Tk[i-2];
+  }
+
+  double Pval = _coefmon[0];
+  for( unsigned int i=1; i<_nmon(); i++ ){
+    double valmon = 1.;
+    for( unsigned int k=0; k<_nvar(); k++ )
+      valmon *= Tval[k*(_nord()+1)+_expmon(i)[k]];
+    Pval += _coefmon[i] * valmon;
+  }
+  delete[] Tval;
+  return Pval;
+}
+
+template <typename T> inline double
+CVar<T>::coefmon
+( const unsigned int*iexp ) const
+{
+  if( !_CM ) return 0;
+  unsigned int iord = 0;
+  for( unsigned int k=0; k<_nvar(); k++ ) iord += iexp[k];
+  if( iord > _nord() ) return 0.;
+  return _coefmon[_CM->_loc_expmon( iexp )];
+}
+
+template <typename T> inline std::ostream&
+operator <<
+( std::ostream&out, const CVar<T>&CV )
+{
+  out << std::endl
+      << std::scientific << std::setprecision(5)
+      << std::right;
+
+  // Constant model
+  if( !CV._CM ){
+    out << "   a0    = " << std::right << std::setw(12) << CV._coefmon[0]
+        << "      0  0"
+        << std::endl
+        << "   R     = " << *(CV._bndrem) << std::endl;
+  }
+
+  // Chebyshev term coefficients and corresponding degrees
+  else{
+    out << std::setprecision(CV._CM->options.DISPLAY_DIGITS);
+    for( unsigned int i=0; i<CV._nmon(); i++ ){
+      out << "   a" << std::left << std::setw(4) << i << " = "
+          << std::right << std::setw(CV._CM->options.DISPLAY_DIGITS+7)
+          << CV._coefmon[i] << "   ";
+      for( unsigned int k=0; k<CV._nvar(); k++ )
+        out << std::setw(3) << CV._expmon(i)[k];
+      out << std::endl;
+    }
+    // Remainder term
+    out << std::right << "   R     =  " << *(CV._bndrem)
+        << std::endl;
+  }
+
+  // Range bounder
+  out << std::right << "   B     =  " << CV.B()
+      << std::endl;
+
+  return out;
+}
+
+template <typename T> inline CVar<T>
+operator +
+( const CVar<T>&CV )
+{
+  return CV;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator +=
+( const CVar<T>&CV )
+{
+  if( !CV._CM ){
+    if( _CM && _CM->options.PROPAGATE_BNDT ) _bndT += CV._bndT;
+    _coefmon[0] += CV._coefmon[0];
+    if( _CM ) _bndord[0] = _coefmon[0];
+    *_bndrem += *(CV._bndrem);
+  }
+  else if( !_CM ){
+    CVar<T> CV2(*this);
+    *this = CV; *this += CV2;
+  }
+  else{
+    if( _CM != CV._CM )
+      throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::CMODEL );
+    if( _CM->options.PROPAGATE_BNDT ) _bndT += CV._bndT;
+    for( unsigned int i=0; i<_nmon(); i++ )
+      _coefmon[i] += CV._coefmon[i];
+    *_bndrem += *(CV._bndrem);
+    _update_bndord();
+  }
+  if( _CM && _CM->options.CENTER_REMAINDER ) _center_CM();
+  return *this;
+}
+
+template <typename T> inline CVar<T>
+operator +
+( const CVar<T>&CV1, const CVar<T>&CV2 )
+{
+  CVar<T> CV3( CV1 );
+  CV3 += CV2;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator +=
+( const double c )
+{
+  _coefmon[0] += c;
+  if( _CM ) _bndord[0] = _coefmon[0];
+  if( _CM && _CM->options.PROPAGATE_BNDT ) _bndT += c;
+  return *this;
+}
+
+template <typename T> inline CVar<T>
+operator +
+( const CVar<T>&CV1, const double c )
+{
+  CVar<T> CV3( CV1 );
+  CV3 += c;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>
+operator +
+( const double c, const CVar<T>&CV2 )
+{
+  CVar<T> CV3( CV2 );
+  CV3 += c;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator +=
+( const T&I )
+{
+  *_bndrem += I;
+  if( _CM && _CM->options.PROPAGATE_BNDT ) _bndT += I;
+  if( _CM && _CM->options.CENTER_REMAINDER ) _center_CM();
+  return *this;
+}
+
+template <typename T> inline CVar<T>
+operator +
+( const CVar<T>&CV1, const T&I )
+{
+  CVar<T> CV3( CV1 );
+  CV3 += I;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>
+operator +
+( const T&I, const CVar<T>&CV2 )
+{
+  CVar<T> CV3( CV2 );
+  CV3 += I;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>
+operator -
+( const CVar<T>&CV )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._coefmon[0] = -CV._coefmon[0];
+    CV2._bndord[0] = -CV._bndord[0];
+    return CV2;
+  }
+  CVar<T>& CV2 = *CV._CV();
+  for( unsigned int i=0; i<CV._nmon(); i++ ) CV2._coefmon[i] = -CV._coefmon[i];
+  for( unsigned int i=0; i<CV._nord()+2; i++ ) CV2._bndord[i] = -CV._bndord[i];
+  if( CV._CM->options.PROPAGATE_BNDT ) CV2._bndT = -CV._bndT;
+  if( CV._CM->options.CENTER_REMAINDER ) CV2._center_CM();
+  return CV2;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator -=
+( const CVar<T>&CV )
+{
+  if( !CV._CM ){
+    if( _CM && _CM->options.PROPAGATE_BNDT ) _bndT -= CV._bndT;
+    _coefmon[0] -= CV._coefmon[0];
+    if( _CM ) _bndord[0] = _coefmon[0];
+    *_bndrem -= *(CV._bndrem);
+  }
+  else if( !_CM ){
+    CVar<T> CV2(*this);
+    *this = -CV; *this += CV2;
+  }
+  else{
+    if( _CM != CV._CM )
+      throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::CMODEL );
+    if( _CM->options.PROPAGATE_BNDT ) _bndT -= CV._bndT;
+    for( unsigned int i=0; i<_nmon(); i++ )
+      _coefmon[i] -= CV._coefmon[i];
+    *_bndrem -= *(CV._bndrem);
+    _update_bndord();
+  }
+  if( _CM && _CM->options.CENTER_REMAINDER ) _center_CM();
+  return *this;
+}
+
+template <typename T> inline CVar<T>
+operator -
+( const CVar<T>&CV1, const CVar<T>&CV2 )
+{
+  CVar<T> CV3( CV1 );
+  CV3 -= CV2;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator -=
+( const double c )
+{
+  _coefmon[0] -= c;
+  if( _CM ) _bndord[0] = _coefmon[0];
+  if( _CM && _CM->options.PROPAGATE_BNDT ) _bndT -= c;
+  return *this;
+}
+
+template <typename T> inline CVar<T>
+operator -
+( const CVar<T>&CV1, const double c )
+{
+  CVar<T> CV3( CV1 );
+  CV3 -= c;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>
+operator -
+( const double c, const CVar<T>&CV2 )
+{
+  CVar<T> CV3( -CV2 );
+  CV3 += c;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator -=
+( const T&I )
+{
+  *_bndrem -= I;
+  if( _CM && _CM->options.PROPAGATE_BNDT ) _bndT -= I;
+  if( _CM && _CM->options.CENTER_REMAINDER ) _center_CM();
+  return *this;
+}
+
+template <typename T> inline CVar<T>
+operator -
+( const CVar<T>&CV1, const T&I )
+{
+  CVar<T> CV3( CV1 );
+  CV3 -= I;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>
+operator -
+( const T&I, const CVar<T>&CV2 )
+{
+  CVar<T> CV3( -CV2 );
+  CV3 += I;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator *=
+( const CVar<T>&CV )
+{
+   CVar<T> CV2( *this );
+   *this = CV * CV2;
+   return *this;
+}
+
+template <typename T> inline CVar<T>
+operator *
+( const CVar<T>&CV1, const CVar<T>&CV2 )
+{
+  if( !CV2._CM )      return( CV1 * CV2._coefmon[0] + CV1 * *(CV2._bndrem) );
+  else if( !CV1._CM ) return( CV2 * CV1._coefmon[0] + CV2 * *(CV1._bndrem) );
+
+  if( CV1._CM != CV2._CM )
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::CMODEL );
+  CVar<T>& CV3 = *CV1._CV();
+  for( unsigned int i=0; i<CV3._nmon(); i++ ) CV3._coefmon[i] = 0.;
+
+  // Populate _coefmon for product term using product table; terms of
+  // order greater than _nord are bounded by their absolute value
+  double trunc = 0.;
+  for( unsigned int i=0; i<CV3._nmon(); i++ ){
+    const unsigned int*prod = CV3._CM->_prodmon[i];
+    for( unsigned int j=i; j<CV3._nmon(); j++ ){
+      const unsigned int nin = *prod++, nout = *prod++;
+      double coefprod = ( i==j? CV1._coefmon[i] * CV2._coefmon[i]:
+        CV1._coefmon[i] * CV2._coefmon[j] + CV1._coefmon[j] * CV2._coefmon[i] );
+      if( coefprod == 0. ){ prod += nin; continue; }
+      coefprod /= nin + nout;
+      for( unsigned int k=0; k<nin; k++ )
+        CV3._coefmon[*prod++] += coefprod;
+      if( nout ) trunc += std::fabs( coefprod ) * nout;
+    }
+  }
+
+  // Calculate remainder term _bndrem for product term
+  *(CV3._bndrem) = trunc * ( 2.*Op<T>::zeroone()-1. )
+    + CV1._bound_poly() * *(CV2._bndrem)
+    + *(CV1._bndrem) * ( CV2._bound_poly() + *(CV2._bndrem) );
+
+  // Populate _bndord for product term (except remainder term)
+  CV3._update_bndord();
+  if( CV3._CM->options.PROPAGATE_BNDT ) CV3._bndT = CV1._bndT * CV2._bndT;
+  if( CV3._CM->options.CENTER_REMAINDER ) CV3._center_CM();
+  return CV3;
+}
+
+template <typename T> inline CVar<T>
+sqr
+( const CVar<T>&CV )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._bndord[0] = Op<T>::sqr( CV._coefmon[0] + CV._bndord[0] );
+    return CV2;
+  }
+  CVar<T> CV2( CV * CV );
+  if( CV2._CM->options.PROPAGATE_BNDT ) CV2._bndT = Op<T>::sqr( CV._bndT );
+  return CV2;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator *=
+( const double c )
+{
+  if( !_CM ){
+    _coefmon[0] *= c;
+    *(_bndrem) *= c;
+  }
+  else{
+    for( unsigned int i=0; i<_nmon(); i++ ) _coefmon[i] *= c;
+    for( unsigned int i=0; i<_nord()+2; i++ ) _bndord[i] *= c;
+    if( _CM->options.PROPAGATE_BNDT ) _bndT *= c;
+  }
+  return *this;
+}
+
+template <typename T> inline CVar<T>
+operator *
+( const CVar<T>&CV1, const double c )
+{
+  CVar<T> CV3( CV1 );
+  CV3 *= c;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>
+operator *
+( const double c, const CVar<T>&CV2 )
+{
+  CVar<T> CV3( CV2 );
+  CV3 *= c;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator *=
+( const T&I )
+{
+  if( !_CM ){
+    *(_bndrem) += _coefmon[0];
+    _coefmon[0] = 0.;
+    *(_bndrem) *= I;
+  }
+  else{
+    const double Imid = Op<T>::mid(I);
+    T Icur = bound();
+    for( unsigned int i=0; i<_nmon(); i++ ) _coefmon[i] *= Imid;
+    for( unsigned int i=0; i<_nord()+2; i++ ) _bndord[i] *= Imid;
+    *_bndrem += (I-Imid)*Icur;
+  }
+  if( _CM && _CM->options.CENTER_REMAINDER ) _center_CM();
+  if( _CM && _CM->options.PROPAGATE_BNDT ) _bndT *= I;
+  return (*this);
+}
+
+template <typename T> inline CVar<T>
+operator *
+( const CVar<T>&CV1, const T&I )
+{
+  CVar<T> CV3( CV1 );
+  CV3 *= I;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>
+operator *
+( const T&I, const CVar<T>&CV2 )
+{
+  CVar<T> CV3( CV2 );
+  CV3 *= I;
+  return CV3;
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator /=
+( const CVar<T>&CV )
+{
+   *this *= inv(CV);
+   return *this;
+}
+
+template <typename T> inline CVar<T>
+operator /
+( const CVar<T>&CV1, const CVar<T>&CV2 )
+{
+  return CV1 * inv(CV2);
+}
+
+template <typename T> inline CVar<T>&
+CVar<T>::operator /=
+( const double c )
+{
+  if ( isequal( c, 0. ))
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::DIV );
+   *this *= (1./c);
+   return *this;
+}
+
+template <typename T> inline CVar<T>
+operator /
+( const CVar<T>&CV, const double c )
+{
+  if ( isequal( c, 0. ))
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::DIV );
+  return CV * (1./c);
+}
+
+template <typename T> inline CVar<T>
+operator /
+( const double c, const CVar<T>&CV )
+{
+  return inv(CV) * c;
+}
+
+template <typename T> inline CVar<T>
+inv
+( const CVar<T>&CV )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._bndord[0] = Op<T>::inv( CV._coefmon[0] + CV._bndord[0] );
+    return CV2;
+  }
+
+  const T B( CV.B() );
+  if( Op<T>::l(B) <= 0. && Op<T>::u(B) >= 0. )
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::DIV );
+  struct loc{
+    static double inv
+      ( const double x, const double*rusr, const int*iusr )
+      { return 1./x; }
+    static T dninv
+      ( const T&x, const unsigned int n, const double*rusr, const int*iusr )
+      { double s = ( n%2? -1.: 1. );
+        for( unsigned int k=2; k<=n; k++ ) s *= k;
+        return s * Op<T>::pow( Op<T>::inv(x), (int)n+1 ); }
+  };
+  CVar<T> CV2 = CV._CM->_univ_chebyshev( CV, loc::inv, loc::dninv, 0, 0 );
+
+  if( CV2._CM->options.PROPAGATE_BNDT ) CV2._bndT = Op<T>::inv( CV._bndT );
+  if( CV2._CM->options.CENTER_REMAINDER ) CV2._center_CM();
+  return CV2;
+}
+
+template <typename T> inline CVar<T>
+sqrt
+( const CVar<T>&CV )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._bndord[0] = Op<T>::sqrt( CV._coefmon[0] + CV._bndord[0] );
+    return CV2;
+  }
+
+  if( Op<T>::l( CV.B() ) <= 0. )
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::DOMAIN );
+  struct loc{
+    static double sqrt
+      ( const double x, const double*rusr, const int*iusr )
+      { return std::sqrt(x); }
+    static T dnsqrt
+      ( const T&x, const unsigned int n, const double*rusr, const int*iusr )
+      { double s = 1.;
+        for( unsigned int k=0; k<n; k++ ) s *= 0.5-k;
+        return s * Op<T>::sqrt(x) * Op<T>::pow( Op<T>::inv(x), (int)n ); }
+  };
+  CVar<T> CV2 = CV._CM->_univ_chebyshev( CV, loc::sqrt, loc::dnsqrt, 0, 0 );
+
+  if( CV2._CM->options.PROPAGATE_BNDT ) CV2._bndT = Op<T>::sqrt( CV._bndT );
+  if( CV2._CM->options.CENTER_REMAINDER ) CV2._center_CM();
+  return CV2;
+}
+
+template <typename T> inline CVar<T>
+exp
+( const CVar<T>&CV )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._bndord[0] = Op<T>::exp( CV._coefmon[0] + CV._bndord[0] );
+    return CV2;
+  }
+
+  struct loc{
+    static double exp
+      ( const double x, const double*rusr, const int*iusr )
+      { return std::exp(x); }
+    static T dnexp
+      ( const T&x, const unsigned int n, const double*rusr, const int*iusr )
+      { return Op<T>::exp(x); }
+  };
+  CVar<T> CV2 = CV._CM->_univ_chebyshev( CV, loc::exp, loc::dnexp, 0, 0 );
+
+  if( CV2._CM->options.PROPAGATE_BNDT ) CV2._bndT = Op<T>::exp( CV._bndT );
+  if( CV2._CM->options.CENTER_REMAINDER ) CV2._center_CM();
+  return CV2;
+}
+
+template <typename T> inline CVar<T>
+log
+( const CVar<T>&CV )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._bndord[0] = Op<T>::log( CV._coefmon[0] + CV._bndord[0] );
+    return CV2;
+  }
+
+  if( Op<T>::l( CV.B() ) <= 0. )
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::DOMAIN );
+  struct loc{
+    static double log
+      ( const double x, const double*rusr, const int*iusr )
+      { return std::log(x); }
+    static T dnlog
+      ( const T&x, const unsigned int n, const double*rusr, const int*iusr )
+      { double s = ( n%2? 1.: -1. );
+        for( unsigned int k=2; k<n; k++ ) s *= k;
+        return s * Op<T>::pow( Op<T>::inv(x), (int)n ); }
+  };
+  CVar<T> CV2 = CV._CM->_univ_chebyshev( CV, loc::log, loc::dnlog, 0, 0 );
+
+  if( CV2._CM->options.PROPAGATE_BNDT ) CV2._bndT = Op<T>::log( CV._bndT );
+  if( CV2._CM->options.CENTER_REMAINDER ) CV2._center_CM();
+  return CV2;
+}
+
+template <typename T> inline CVar<T>
+xlog
+( const CVar<T>&CV )
+{
+  return CV * log( CV );
+}
+
+template <typename T> inline CVar<T>
+pow
+( const CVar<T>&CV, const int n )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._bndord[0] = Op<T>::pow( CV._coefmon[0] + CV._bndord[0], n );
+    return CV2;
+  }
+
+  if( n < 0 ) return pow( inv( CV ), -n );
+  CVar<T> CV2( CV._CM->_intpow( CV, n ) );
+  if( CV2._CM->options.PROPAGATE_BNDT ) CV2._bndT = Op<T>::pow( CV._bndT, n );
+  if( CV2._CM->options.CENTER_REMAINDER ) CV2._center_CM();
+  return CV2;
+}
+
+template <typename T> inline CVar<T>
+pow
+( const CVar<T> &CV, const double a )
+{
+  return exp( a * log( CV ) );
+}
+
+template <typename T> inline CVar<T>
+pow
+( const CVar<T> &CV1, const CVar<T> &CV2 )
+{
+  return exp( CV2 * log( CV1 ) );
+}
+
+template <typename T> inline CVar<T>
+pow
+( const double a, const CVar<T> &CV )
+{
+  return exp( CV * std::log( a ) );
+}
+
+template <typename T> inline CVar<T>
+monomial
+(const unsigned int n, const CVar<T>*CV, const int*k)
+{
+  if( n == 0 ){
+    return 1.;
+  }
+  if( n == 1 ){
+    return pow( CV[0], k[0] );
+  }
+  return pow( CV[0], k[0] ) * monomial( n-1, CV+1, k+1 );
+}
+
+template <typename T> inline CVar<T>
+cos
+( const CVar<T> &CV )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._bndord[0] = Op<T>::cos( CV._coefmon[0] + CV._bndord[0] );
+    return CV2;
+  }
+
+  struct loc{
+    static double cos
+      ( const double x, const double*rusr, const int*iusr )
+      { return std::cos(x); }
+    static T dncos
+      ( const T&x, const unsigned int n, const double*rusr, const int*iusr )
+      { return Op<T>::cos( x + n*PI/2. ); }
+  };
+  CVar<T> CV2 = CV._CM->_univ_chebyshev( CV, loc::cos, loc::dncos, 0, 0 );
+
+  if( CV2._CM->options.PROPAGATE_BNDT ) CV2._bndT = Op<T>::cos( CV._bndT );
+  if( CV2._CM->options.CENTER_REMAINDER ) CV2._center_CM();
+  return CV2;
+}
+
+template <typename T> inline CVar<T>
+sin
+( const CVar<T> &CV )
+{
+  return cos( CV - PI/2. );
+}
+
+template <typename T> inline CVar<T>
+tan
+( const CVar<T> &CV )
+{
+  return sin(CV) / cos(CV);
+}
+
+template <typename T> inline CVar<T>
+atan
+( const CVar<T> &CV )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._bndord[0] = Op<T>::atan( CV._coefmon[0] + CV._bndord[0] );
+    return CV2;
+  }
+
+  struct loc{
+    static double atan
+      ( const double x, const double*rusr, const int*iusr )
+      { return std::atan(x); }
+    static T dnatan
+      ( const T&x, const unsigned int n, const double*rusr, const int*iusr )
+      { double s = 1.;
+        for( unsigned int k=2; k<n; k++ ) s *= k;
+        const T Iatan( Op<T>::atan(x) );
+        return s * Op<T>::pow( Op<T>::cos(Iatan), (int)n )
+                 * Op<T>::sin( (double)n*(Iatan+PI/2.) ); }
+  };
+  CVar<T> CV2 = CV._CM->_univ_chebyshev( CV, loc::atan, loc::dnatan, 0, 0 );
+
+  if( CV2._CM->options.PROPAGATE_BNDT ) CV2._bndT = Op<T>::atan( CV._bndT );
+  if( CV2._CM->options.CENTER_REMAINDER ) CV2._center_CM();
+  return CV2;
+}
+
+template <typename T> inline CVar<T>
+asin
+( const CVar<T> &CV )
+{
+  if( !CV._CM ){
+    CVar<T> CV2;
+    CV2._bndord[0] = Op<T>::asin( CV._coefmon[0] + CV._bndord[0] );
+    return CV2;
+  }
+
+  CVar<T> CV2( atan( CV / sqrt( 1. - sqr( CV ) ) ) );
+  if( CV2._CM->options.PROPAGATE_BNDT ) CV2._bndT = Op<T>::asin( CV._bndT );
+  return CV2;
+}
+
+template <typename T> inline CVar<T>
+acos
+( const CVar<T> &CV )
+{
+  return PI/2. - asin( CV );
+}
+
+template <typename T> inline CVar<T>
+hull
+( const CVar<T>&CV1, const CVar<T>&CV2 )
+{
+  // Neither operands associated to CModel -- Make union in T type
+  if( !CV1._CM && !CV2._CM ){
+    T R1 = CV1._coefmon[0] + CV1._bndord[0];
+    T R2 = CV2._coefmon[0] + CV2._bndord[0];
+    return Op<T>::hull(R1, R2);
+  }
+
+  // First operand not associated to CModel
+  else if( !CV1._CM )
+    return hull( CV2, CV1 );
+
+  // Second operand not associated to CModel
+  else if( !CV2._CM )
+    return CV1.P() + Op<T>::hull( CV1.R(), CV2._coefmon[0]+CV2._bndord[0]-CV1.P().B() );
+
+  // CModel for first and second operands are inconsistent
+  else if( CV1._CM != CV2._CM )
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::CMODEL );
+
+  // Perform union
+  CVar<T> CV1C( CV1 ), CV2C( CV2 );
+  const double eta = CV1._CM->options.REF_POLY;
+  T R1C = CV1C.C().R(), R2C = CV2C.C().R();
+  CV1C.set(T(0.));
+  CV2C.set(T(0.));
+  T BCVD = (CV1C-CV2C).B();
+  return (1.-eta)*CV1C + eta*CV2C + Op<T>::hull( R1C+eta*BCVD, R2C+(eta-1.)*BCVD );
+}
+
+template <typename T> inline bool
+inter
+( CVar<T>&CVR, const CVar<T>&CV1, const CVar<T>&CV2 )
+{
+  // Neither operands associated to CModel -- Make intersection in T type
+  if( !CV1._CM && !CV2._CM ){
+    T R1 = CV1._coefmon[0] + CV1._bndord[0];
+    T R2 = CV2._coefmon[0] + CV2._bndord[0];
+    T RR( 0. );
+    bool flag = Op<T>::inter(RR, R1, R2);
+    CVR = RR;
+    return flag;
+  }
+
+  // First operand not associated to CModel
+  else if( !CV1._CM )
+    return inter( CVR, CV2, CV1 );
+
+  // Second operand not associated to CModel
+  else if( !CV2._CM ){
+    CVR = CV1.P();
+    return( Op<T>::inter(*(CVR._bndrem), CV1.R(),
+      CV2._coefmon[0]+CV2._bndord[0]-CV1.P().B())? true: false );
+  }
+
+  // CModel for first and second operands are inconsistent
+  else if( CV1._CM != CV2._CM )
+    throw typename CModel<T>::Exceptions( CModel<T>::Exceptions::CMODEL );
+
+  // Perform intersection
+  CVar<T> CV1C( CV1 ), CV2C( CV2 );
+  const double eta = CV1._CM->options.REF_POLY;
+  T R1C = CV1C.C().R(), R2C = CV2C.C().R();
+  CV1C.set(T(0.));
+  CV2C.set(T(0.));
+  CVR = (1.-eta)*CV1C + eta*CV2C;
+  CV1C -= CV2C;
+  T BCVD = CV1C.B();
+  return( Op<T>::inter( *(CVR._bndrem), R1C+eta*BCVD, R2C+(eta-1.)*BCVD )?
+    true: false );
+}
+
+} // namespace mc
+
+#include "mcop.hpp"
+
+namespace mc
+{
+
+//! @brief C++ structure for specialization of the mc::Op templated structure to allow usage of the Chebyshev model type mc::CVar inside other MC++ type, e.g. mc::McCormick
+template <typename T> struct Op< mc::CVar<T> >
+{
+  typedef mc::CVar<T> CV;
+  static CV point( const double c ) { return CV(c); }
+  static CV zeroone() { return CV( mc::Op<T>::zeroone() ); }
+  static void I(CV& x, const CV&y) { x = y; }
+  static double l(const CV& x) { return mc::Op<T>::l(x.B()); }
+  static double u(const CV& x) { return mc::Op<T>::u(x.B()); }
+  static double abs (const CV& x) { return mc::Op<T>::abs(x.B());  }
+  static double mid (const CV& x) { return mc::Op<T>::mid(x.B());  }
+  static double diam(const CV& x) { return mc::Op<T>::diam(x.B()); }
+  static CV inv (const CV& x) { return mc::inv(x);  }
+  static CV sqr (const CV& x) { return mc::sqr(x);  }
+  static CV sqrt(const CV& x) { return mc::sqrt(x); }
+  static CV log (const CV& x) { return mc::log(x);  }
+  static CV xlog(const CV& x) { return x*mc::log(x); }
+  static CV fabs(const CV& x) { return CV( mc::Op<T>::fabs(x.B()) ); }
+  static CV exp (const CV& x) { return mc::exp(x);  }
+  static CV sin (const CV& x) { return mc::sin(x);  }
+  static CV cos (const CV& x) { return mc::cos(x);  }
+  static CV tan (const CV& x) { return mc::tan(x);  }
+  static CV asin(const CV& x) { return mc::asin(x); }
+  static CV acos(const CV& x) { return mc::acos(x); }
+  static CV atan(const CV& x) { return mc::atan(x); }
+  static CV erf (const CV& x) { throw typename mc::CModel<T>::Exceptions( CModel<T>::Exceptions::UNDEF ); }
+  static CV erfc(const CV& x) { throw typename mc::CModel<T>::Exceptions( CModel<T>::Exceptions::UNDEF ); }
+  static CV hull(const CV& x, const CV& y) { return mc::hull(x,y); }
+  static CV min (const CV& x, const CV& y) { return mc::Op<T>::min(x.B(),y.B());  }
+  static CV max (const CV& x, const CV& y) { return mc::Op<T>::max(x.B(),y.B());  }
+  static CV arh (const CV& x, const double k) { return mc::exp(-k/x); }
+  template <typename X, typename Y> static CV pow(const X& x, const Y& y) { return mc::pow(x,y); }
+  static CV monomial (const unsigned int n, const CV* x, const int* k) { return mc::monomial(n,x,k); }
+  static bool inter(CV& xIy, const CV& x, const CV& y) { return mc::inter(xIy,x,y); }
+  static bool eq(const CV& x, const CV& y) { return mc::Op<T>::eq(x.B(),y.B()); }
+  static bool ne(const CV& x, const CV& y) { return mc::Op<T>::ne(x.B(),y.B()); }
+  static bool lt(const CV& x, const CV& y) { return mc::Op<T>::lt(x.B(),y.B()); }
+  static bool le(const CV& x, const CV& y) { return mc::Op<T>::le(x.B(),y.B()); }
+  static bool gt(const CV& x, const CV& y) { return mc::Op<T>::gt(x.B(),y.B()); }
+  static bool ge(const CV& x, const CV& y) { return mc::Op<T>::ge(x.B(),y.B()); }
+};
+
+} // namespace mc
+
+#endif
@@ -0,0 +1,634 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_FFBRANCHBOUND Spatial Branch-and-Bound Global Optimization with mc::FFBranchBound
+\author Beno&icirc;t Chachuat
+
+The bounds and relaxations computed by MC++ are typically used within a spatial branch-and-bound algorithm, in order to find the global minimum of a factorable function \f$f\f$ subject to factorable constraints \f$\underline{c}_j \leq g_j(x) \leq \overline{c}_j\f$, \f$j=1,\ldots,m\f$, on a box \f$X\f$ [Horst & Tuy, 1996; Tawarmalani & Sahinidis, 2002]. The class mc::FFBranchBound implements such an algorithm for the functions recorded in a graph of type mc::FFGraph (see \ref page_FFUNC). The objective and constraint functions are compiled once into a program of type mc::FFProgram, which is then evaluated at every node of the search tree in the arithmetic used for bounding, with workspaces that are kept from one node to the next. The algorithm proceeds as follows:
+- The open nodes, i.e. the subboxes of \f$X\f$ that may still contain a global minimum, are stored in a priority heap ordered by their lower bounds, and the node with the lowest bound is processed first (best-first search). Each node inherits the lower bound of its parent.
+- The box of a node is first reduced by forward-backward constraint propagation with mc::FFContractor (see \ref page_FFCONTRACTOR), where the objective function is constrained by the best known value \f$f^U\f$ as \f$f(x)\leq f^U\f$.
+- A lower bound of the objective function is then computed on the reduced box, either from its interval bounds, from an affine relaxation given by the McCormick relaxations and their subgradients at the middle of the box (see \ref page_MCCORMICK), or from a Taylor model (see \ref page_TAYLOR). The node is discarded if a constraint cannot be satisfied in the box according to the same bounds or relaxations. With McCormick relaxations, the affine relaxations of the objective and constraint functions are also used to reduce the box further, before the lower bound is computed.
+- An upper bound is computed by evaluating the objective and constraint functions at the middle of the box, which becomes the new incumbent if it is feasible with respect to the constraints up to a tolerance and improves on the best known value.
+- The node is discarded if its lower bound is within the tolerances of the best known value. Otherwise, it is bisected along the variable with the widest range relative to the initial box, and both subboxes are added to the heap.
+.
+The algorithm terminates when the lowest bound in the heap is within the absolute or relative tolerances of the best known value, or when the heap is empty.
+
+The template parameter <tt>T</tt> is the interval type used for the bounds and for the constraint propagation, which must be constructible from its lower and upper bounds, possibly infinite. The lower bounds are valid only to the same extent as the arithmetic <tt>T</tt> and the McCormick relaxations, computed to nearest; in particular, the affine relaxations are minimized over the boxes in real arithmetic.
+
+
+\section sec_FFBRANCHBOUND_use How do I find the global minimum of a factorable function with mc::FFBranchBound?
+
+Suppose we want to minimize the function \f$f(x,y)=-x-y\f$ on the box \f$[0,3]\times[0,4]\f$ subject to the constraints \f$y\leq 2x^4-8x^3+8x^2+2\f$ and \f$y\leq 4x^4-32x^3+88x^2-96x+36\f$ [Floudas <I>et al.</I>, 1999, Section 4.10]. The relevant header files are:
+
+\code
+      #include "interval.hpp"
+      #include "ffbranchbound.hpp"
+      typedef mc::Interval I;
+\endcode
+
+The objective and constraint functions are recorded in a graph, and the solver is constructed for these functions and variables:
+
+\code
+      mc::FFGraph DAG;
+      mc::FFVar X[2] = { DAG.var(), DAG.var() };
+      mc::FFVar F = -X[0]-X[1];
+      mc::FFVar G[2] = { X[1]-2.*pow(X[0],4)+8.*pow(X[0],3)-8.*sqr(X[0]),
+                         X[1]-4.*pow(X[0],4)+32.*pow(X[0],3)-88.*sqr(X[0])+96.*X[0] };
+      mc::FFBranchBound<I> BB( DAG, F, 2, G, 2, X );
+\endcode
+
+The problem is then solved for the given box and ranges of the constraint functions, where infinite bounds are used for one-sided constraints:
+
+\code
+      const double INF = std::numeric_limits<double>::infinity();
+      I IX[2] = { I(0.,3.), I(0.,4.) }, IC[2] = { I(-INF,2.), I(-INF,36.) };
+      if( BB.solve( IX, IC ) == mc::FFBranchBound<I>::OPTIMAL )
+        std::cout << "global minimum: " << BB.upper() << " at ("
+                  << BB.solution()[0] << "," << BB.solution()[1] << ")" << std::endl;
+\endcode
+
+The function <tt>solve</tt> returns one of the following values:
+- mc::FFBranchBound::OPTIMAL: the best known value <tt>upper()</tt>, attained at the point <tt>solution()</tt>, is within the tolerances of the lower bound <tt>lower()</tt> on the global minimum;
+- mc::FFBranchBound::INFEASIBLE: all the nodes were discarded without finding a feasible point, so that the problem is infeasible, or at least it has no point feasible within the tolerance;
+- mc::FFBranchBound::INTERRUPTED: the maximal number of nodes was reached, and <tt>lower()</tt> and <tt>upper()</tt> give the remaining gap;
+- mc::FFBranchBound::UNRESOLVED: some nodes could not be discarded although their boxes were too small to be bisected, e.g. for equality constraints that are not satisfied at the middle of the box within the feasibility tolerance, or for functions that cannot be bounded on the boxes. The lower bound <tt>lower()</tt> still accounts for these nodes.
+.
+The number of nodes processed is returned by <tt>nnode()</tt>. When no constraint is given, the second argument of <tt>solve</tt> may be omitted; it is required otherwise.
+
+
+\section sec_FFBRANCHBOUND_opt How are the options set for the branch-and-bound algorithm?
+
+The class mc::FFBranchBound has a public member called mc::FFBranchBound::options that can be used to set/modify the options; e.g.,
+
+\code
+      BB.options.LBOUND = mc::FFBranchBound<I>::Options::TAYLOR;
+      BB.options.TORDER = 4;
+      BB.options.RELTOL = 1e-3;
+\endcode
+
+The available options are the following:
+
+<TABLE border="1">
+<CAPTION><EM>Options in mc::FFBranchBound::Options: name, type and description</EM></CAPTION>
+     <TR><TH><b>Name</b>  <TD><b>Type</b><TD><b>Default</b>
+         <TD><b>Description</b>
+     <TR><TH><tt>LBOUND</tt> <TD><tt>mc::FFBranchBound::Options::BOUNDER</tt> <TD>mc::FFBranchBound::Options::MCCORMICK
+         <TD>Arithmetic used for the lower bounds: interval arithmetic <tt>T</tt> (INTERVAL), McCormick relaxations with subgradients (MCCORMICK), or Taylor models (TAYLOR). The bounds of the McCormick relaxations and Taylor models are intersected with the interval bounds in any case.
+     <TR><TH><tt>TORDER</tt> <TD><tt>unsigned int</tt> <TD>3
+         <TD>Order of the Taylor models, for TAYLOR.
+     <TR><TH><tt>CONTRACT</tt> <TD><tt>bool</tt> <TD>true
+         <TD>Whether to reduce the boxes by forward-backward constraint propagation at each node.
+     <TR><TH><tt>LINRED</tt> <TD><tt>bool</tt> <TD>true
+         <TD>Whether to reduce the boxes based on the affine relaxations of the objective and constraint functions, for MCCORMICK.
+     <TR><TH><tt>ABSTOL</tt> <TD><tt>double</tt> <TD>1e-5
+         <TD>Absolute tolerance on the gap between the best known value and the lower bound.
+     <TR><TH><tt>RELTOL</tt> <TD><tt>double</tt> <TD>1e-5
+         <TD>Relative tolerance on the gap between the best known value and the lower bound.
+     <TR><TH><tt>FEASTOL</tt> <TD><tt>double</tt> <TD>1e-7
+         <TD>Tolerance on the constraint ranges for a point to be feasible.
+     <TR><TH><tt>BRANCHTOL</tt> <TD><tt>double</tt> <TD>1e-9
+         <TD>Minimal width of the ranges of the variables, relative to the initial box, for a node to be bisected.
+     <TR><TH><tt>MAXNODE</tt> <TD><tt>unsigned int</tt> <TD>100000
+         <TD>Maximal number of nodes to process. A value of 0 sets no limit.
+</TABLE>
+
+The options of the contractor, and those of the classes mc::McCormick and mc::TModel, apply to the constraint propagation and to the bounds at each node, respectively. The options of the contractor are set through the public member <tt>contractor()</tt>, e.g. <tt>BB.contractor().options.MAXREV = 5</tt>.
+
+
+\section sec_FFBRANCHBOUND_err What errors can I encounter when using mc::FFBranchBound?
+
+The errors are those of mc::FFGraph (see \ref sec_FFUNC_err), when the functions or the variables are not recorded in the graph, or when <tt>solve</tt> is called without the ranges of the constraints. The exceptions of mc::FFGraph, mc::Interval, mc::McCormick and mc::TModel thrown during the bounding of a node, e.g. when the range of a variable is outside the domain of a function, are caught: the node is then bounded with the arithmetics that did not fail, or bisected with the lower bound of its parent if the interval bounds cannot be computed either. Any other exception, e.g. <tt>std::bad_alloc</tt>, is passed on to the calling program. The initial box must be bounded.
+
+
+\section sec_FFBRANCHBOUND_refs References
+
+- Floudas, C.A., P.M. Pardalos, C.S. Adjiman, W.R. Esposito, Z.H. Gumus, S.T. Harding, J.L. Klepeis, C.A. Meyer, and C.A. Schweiger, <I>Handbook of Test Problems in Local and Global Optimization</I>, Kluwer Academic Publishers, 1999.
+- Horst, R., and H. Tuy, <I>Global Optimization: Deterministic Approaches</I>, 3rd Edition, Springer, 1996.
+- Tawarmalani, M., and N.V. Sahinidis, <I>Convexification and Global Optimization in Continuous and Mixed-Integer Nonlinear Programming</I>, Kluwer Academic Publishers, 2002.
+.
+
+*/
+
+#ifndef MC__FFBRANCHBOUND_HPP
+#define MC__FFBRANCHBOUND_HPP
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <cmath>
+#include "mcfunc.hpp"
+#include "mcop.hpp"
+#include "interval.hpp"
+#include "mccormick.hpp"
+#include "tmodel.hpp"
+#include "ffunc.hpp"
+#include "ffcontractor.hpp"
+
+namespace mc
+{
+
+//! @brief C++ class for the global minimization of factorable functions recorded in mc::FFGraph by spatial branch-and-bound
+////////////////////////////////////////////////////////////////////////
+//! mc::FFBranchBound is a C++ class for the global minimization of a
+//! factorable function subject to factorable constraints on a box, with
+//! the functions recorded in a graph of type mc::FFGraph, by spatial
+//! branch-and-bound with best-first node selection, constraint
+//! propagation, and lower bounds in interval arithmetic <tt>T</tt>,
+//! McCormick relaxations or Taylor models.
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class FFBranchBound
+////////////////////////////////////////////////////////////////////////
+{
+public:
+
+  typedef FFGraph::Exceptions Exceptions;
+  typedef McCormick<T> MCT;
+  typedef TVar<T> TVT;
+
+  //! @brief Options of mc::FFBranchBound
+  struct Options
+  {
+    //! @brief Constructor of mc::FFBranchBound::Options
+    Options():
+      LBOUND(MCCORMICK), TORDER(3), CONTRACT(true), LINRED(true),
+      ABSTOL(1e-5), RELTOL(1e-5), FEASTOL(1e-7), BRANCHTOL(1e-9),
+      MAXNODE(100000)
+      {}
+    //! @brief Arithmetic for the lower bounds
+    enum BOUNDER{
+      INTERVAL=0,	//!< Interval arithmetic
+      MCCORMICK,	//!< McCormick relaxations with subgradients
+      TAYLOR		//!< Taylor models
+    };
+    //! @brief Arithmetic for the lower bounds - See \ref sec_FFBRANCHBOUND_opt
+    BOUNDER LBOUND;
+    //! @brief Order of the Taylor models - See \ref sec_FFBRANCHBOUND_opt
+    unsigned int TORDER;
+    //! @brief Whether to reduce the boxes by constraint propagation - See \ref sec_FFBRANCHBOUND_opt
+    bool CONTRACT;
+    //! @brief Whether to reduce the boxes based on the affine relaxations - See \ref sec_FFBRANCHBOUND_opt
+    bool LINRED;
+    //! @brief Absolute tolerance on the gap - See \ref sec_FFBRANCHBOUND_opt
+    double ABSTOL;
+    //! @brief Relative tolerance on the gap - See \ref sec_FFBRANCHBOUND_opt
+    double RELTOL;
+    //! @brief Feasibility tolerance on the constraint ranges - See \ref sec_FFBRANCHBOUND_opt
+    double FEASTOL;
+    //! @brief Minimal relative width for bisecting a node - See \ref sec_FFBRANCHBOUND_opt
+    double BRANCHTOL;
+    //! @brief Maximal number of nodes - See \ref sec_FFBRANCHBOUND_opt
+    unsigned int MAXNODE;
+  } options;
+
+  //! @brief Termination status of the branch-and-bound algorithm
+  enum STATUS{
+    OPTIMAL=0,		//!< Gap within the tolerances
+    INFEASIBLE,		//!< No feasible point found, all the nodes discarded
+    INTERRUPTED,	//!< Maximal number of nodes reached
+    UNRESOLVED		//!< Some nodes too small to be bisected but not discarded
+  };
+
+  //! @brief Constructor for the objective function <a>obj</a> and the <a>nctr</a> constraint functions <a>ctr</a> in graph <a>dag</a> of the <a>nvar</a> variables <a>var</a>
+  FFBranchBound
+    ( const FFGraph&dag, const FFVar&obj, const unsigned int nctr,
+      const FFVar*ctr, const unsigned int nvar, const FFVar*var );
+
+  //! @brief Minimize the objective function on the box <a>X</a> subject to the constraint functions being in the ranges <a>C</a>, which may be omitted only if there are no constraints
+  STATUS solve
+    ( const T*X, const T*C=0 );
+
+  //! @brief Lower bound on the global minimum after the last call to <tt>solve</tt>
+  double lower() const
+    { return _lbd; }
+
+  //! @brief Best known value of the objective function after the last call to <tt>solve</tt>, infinite if no feasible point was found
+  double upper() const
+    { return _ubd; }
+
+  //! @brief Point attaining the best known value after the last call to <tt>solve</tt>, empty if no feasible point was found
+  const std::vector<double>& solution() const
+    { return _xinc; }
+
+  //! @brief Number of nodes processed in the last call to <tt>solve</tt>
+  unsigned int nnode() const
+    { return _nnode; }
+
+  //! @brief Number of constraints
+  unsigned int nctr() const
+    { return _prog.ndep()-1; }
+
+  //! @brief Number of variables
+  unsigned int nvar() const
+    { return _prog.nvar(); }
+
+  //! @brief Contractor used for the constraint propagation at each node
+  FFContractor<T>& contractor()
+    { return _hc4; }
+
+private:
+
+  //! @brief Structure storing the box, lower bound and depth of a node
+  struct t_node{
+    std::vector<T> X;
+    double lbd;
+    unsigned int depth;
+  };
+
+  //! @brief Ordering of the nodes in the heap, with the lowest bound, then the deepest node, on top
+  struct lt_node{
+    bool operator()( const t_node&N1, const t_node&N2 ) const
+      { return N1.lbd > N2.lbd || ( N1.lbd == N2.lbd && N1.depth < N2.depth ); }
+  };
+
+  //! @brief Objective function followed by the constraint functions
+  std::vector<FFVar> _fg;
+  //! @brief Program evaluating the objective and constraint functions
+  FFProgram _prog;
+  //! @brief Contractor for the objective and constraint functions
+  FFContractor<T> _hc4;
+
+  //! @brief Initial box
+  std::vector<T> _X0;
+  //! @brief Ranges of the objective and constraint functions, with the objective function bounded by the best known value
+  std::vector<T> _C;
+  //! @brief Best known value
+  double _ubd;
+  //! @brief Lower bound on the global minimum
+  double _lbd;
+  //! @brief Point attaining the best known value
+  std::vector<double> _xinc;
+  //! @brief Number of nodes processed
+  unsigned int _nnode;
+  //! @brief Number of nodes neither discarded nor bisected
+  unsigned int _nunres;
+
+  //! @brief Real values of the variables and functions, and workspace
+  std::vector<double> _xD, _fD, _wkD;
+  //! @brief Interval values of the functions, and workspace
+  std::vector<T> _fI, _wkI;
+  //! @brief McCormick values of the variables and functions, and workspace
+  std::vector<MCT> _xMC, _fMC, _wkMC;
+  //! @brief Taylor values of the variables and functions, and workspace
+  std::vector<TVT> _xTM, _fTM, _wkTM;
+  //! @brief Minima of the terms of an affine function over a box
+  std::vector<double> _lo;
+  //! @brief Opposite of a subgradient of a concave relaxation
+  std::vector<double> _s;
+
+  //! @brief Bound the node <a>N</a> and reduce its box, returning false if the node is discarded
+  bool _bound
+    ( t_node&N, TModel<T>*TM );
+
+  //! @brief Rethrow the exception being handled unless it was thrown by one of the arithmetics, to be called from a <tt>catch(...)</tt> block
+  static void _rethrow_unless_arithmetic();
+
+  //! @brief Bound the node <a>N</a> in interval arithmetic, returning false if infeasible
+  bool _bound_interval
+    ( t_node&N );
+
+  //! @brief Bound the node <a>N</a> and reduce its box with McCormick relaxations, returning false if infeasible
+  bool _bound_mccormick
+    ( t_node&N );
+
+  //! @brief Bound the node <a>N</a> with Taylor models in environment <a>TM</a>, returning false if infeasible
+  bool _bound_taylor
+    ( t_node&N, TModel<T>*TM );
+
+  //! @brief Update the incumbent with the middle of the box <a>X</a> if feasible and better
+  void _incumbent
+    ( const std::vector<T>&X );
+
+  //! @brief Whether the range [<a>Fl</a>,<a>Fu</a>] of constraint <a>j</a> does not intersect its range, up to the feasibility tolerance
+  bool _infeasible
+    ( const unsigned int j, const double Fl, const double Fu ) const;
+
+  //! @brief Minimum of the affine function <a>c</a>+<a>s</a>(x-<a>xref</a>) over the box <a>X</a>, with the minima of its terms in <tt>_lo</tt>
+  double _affmin
+    ( const double c, const double*s, const double*xref,
+      const std::vector<T>&X );
+
+  //! @brief Reduce the box <a>X</a> subject to the affine constraint <a>c</a>+<a>s</a>(x-<a>xref</a>) <= <a>r</a>, returning false if empty
+  bool _linred
+    ( const double c, const double*s, const double*xref, const double r,
+      std::vector<T>&X );
+
+  //! @brief Index of the variable with the widest range relative to the initial box, or -1 if all the relative widths are below <tt>BRANCHTOL</tt>
+  int _select
+    ( const std::vector<T>&X ) const;
+
+  //! @brief Gap tolerance for the value <a>f</a>
+  double _tol
+    ( const double f ) const
+    { return std::max( options.ABSTOL, options.RELTOL*std::fabs(f) ); }
+
+  //! @brief Whether a node with lower bound <a>lbd</a> cannot improve the incumbent within the tolerances, always false without an incumbent
+  bool _fathom
+    ( const double lbd ) const
+    { return !_xinc.empty() && lbd >= _ubd - _tol( _ubd ); }
+
+  //! @brief Infinity
+  static double _inf()
+    { return std::numeric_limits<double>::infinity(); }
+
+  //! @brief Objective function followed by the <a>nctr</a> constraint functions <a>ctr</a>
+  static std::vector<FFVar> _deps
+    ( const FFVar&obj, const unsigned int nctr, const FFVar*ctr )
+    { std::vector<FFVar> fg( 1, obj ); fg.insert( fg.end(), ctr, ctr+nctr ); return fg; }
+};
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T> inline
+FFBranchBound<T>::FFBranchBound
+( const FFGraph&dag, const FFVar&obj, const unsigned int nctr,
+  const FFVar*ctr, const unsigned int nvar, const FFVar*var ):
+  _fg( _deps( obj, nctr, ctr ) ),
+  _prog( dag, _fg.size(), &_fg[0], nvar, var ),
+  _hc4( dag, _fg.size(), &_fg[0], nvar, var ),
+  _ubd( _inf() ), _lbd( -_inf() ), _nnode( 0 ), _nunres( 0 )
+{}
+
+template <typename T> inline typename FFBranchBound<T>::STATUS
+FFBranchBound<T>::solve
+( const T*X, const T*C )
+{
+  const unsigned int nvar = _prog.nvar(), nfg = _prog.ndep();
+  if( !X || ( nfg > 1 && !C ) ) throw Exceptions( Exceptions::SIZE );
+  _X0.assign( X, X+nvar );
+  _C.resize( nfg, T(0.) );
+  for( unsigned int j=1; j<nfg; j++ ) _C[j] = C[j-1];
+  _ubd = _inf(); _lbd = _inf(); _xinc.clear();
+  _nnode = _nunres = 0;
+
+  // The Taylor model environment is shared by all the nodes
+  TModel<T>* TM = 0;
+  if( options.LBOUND == Options::TAYLOR ) TM = new TModel<T>( nvar, options.TORDER );
+
+  std::priority_queue< t_node, std::vector<t_node>, lt_node > heap;
+  t_node root;
+  root.X = _X0; root.lbd = -_inf(); root.depth = 0;
+  heap.push( root );
+
+  STATUS status = OPTIMAL;
+  try{
+    while( !heap.empty() ){
+      // The other nodes in the heap have larger lower bounds than the top one
+      if( _fathom( heap.top().lbd ) ) break;
+      if( options.MAXNODE && _nnode >= options.MAXNODE ){ status = INTERRUPTED; break; }
+      t_node N = heap.top();
+      heap.pop();
+      _nnode++;
+
+      if( !_bound( N, TM ) ) continue;
+      if( _fathom( N.lbd ) ){
+        _lbd = std::min( _lbd, N.lbd );
+        continue;
+      }
+
+      // Bisection of the widest variable relative to the initial box
+      const int ib = _select( N.X );
+      if( ib < 0 ){
+        _lbd = std::min( _lbd, N.lbd );
+        _nunres++;
+        continue;
+      }
+      t_node N1( N );
+      const double xm = Op<T>::mid( N.X[ib] );
+      N1.X[ib] = T( Op<T>::l( N.X[ib] ), xm );
+      N.X[ib] = T( xm, Op<T>::u( N.X[ib] ) );
+      N1.depth = ++N.depth;
+      heap.push( N1 );
+      heap.push( N );
+    }
+  }
+  catch(...){ delete TM; throw; }
+  delete TM;
+
+  if( !heap.empty() ) _lbd = std::min( _lbd, heap.top().lbd );
+  _lbd = std::min( _lbd, _ubd );
+  if( status == INTERRUPTED ) return status;
+  if( _nunres && !_fathom( _lbd ) ) return UNRESOLVED;
+  if( _xinc.empty() ) return INFEASIBLE;
+  return OPTIMAL;
+}
+
+template <typename T> inline bool
+FFBranchBound<T>::_bound
+( t_node&N, TModel<T>*TM )
+{
+  // Constraint propagation, with the objective function bounded by the best known value
+  if( options.CONTRACT ){
+    _C[0] = T( -_inf(), _ubd );
+    // The box is left unchanged when the interval bounds are not defined on it
+    try{
+      if( !_hc4.contract( &N.X[0], &_C[0] ) ) return false;
+    }
+    catch(...){ _rethrow_unless_arithmetic(); }
+  }
+
+  // The other bounds are computed only if the interval bounds are defined on the box
+  bool undef = false;
+  try{
+    if( !_bound_interval( N ) ) return false;
+  }
+  catch(...){
+    _rethrow_unless_arithmetic();
+    undef = true;
+  }
+
+  if( !undef ){
+    switch( options.LBOUND ){
+    case Options::MCCORMICK:
+      try{
+        if( !_bound_mccormick( N ) ) return false;
+      }
+      catch(...){ _rethrow_unless_arithmetic(); }
+      break;
+    case Options::TAYLOR:
+      try{
+        if( !_bound_taylor( N, TM ) ) return false;
+      }
+      catch(...){ _rethrow_unless_arithmetic(); }
+      break;
+    case Options::INTERVAL: default:
+      break;
+    }
+  }
+
+  _incumbent( N.X );
+  return true;
+}
+
+template <typename T> inline void
+FFBranchBound<T>::_rethrow_unless_arithmetic()
+{
+  try{ throw; }
+  catch( typename MCT::Exceptions& ){}
+  catch( typename TModel<T>::Exceptions& ){}
+  catch( Interval::Exceptions& ){}
+  catch( FFGraph::Exceptions& ){}
+}
+
+template <typename T> inline bool
+FFBranchBound<T>::_bound_interval
+( t_node&N )
+{
+  const unsigned int nfg = _prog.ndep();
+  _fI.resize( nfg, T(0.) );
+  _prog.eval( &N.X[0], &_fI[0], _wkI );
+  for( unsigned int j=1; j<nfg; j++ )
+    if( _infeasible( j, Op<T>::l( _fI[j] ), Op<T>::u( _fI[j] ) ) ) return false;
+  N.lbd = std::max( N.lbd, Op<T>::l( _fI[0] ) );
+  return true;
+}
+
+template <typename T> inline bool
+FFBranchBound<T>::_bound_mccormick
+( t_node&N )
+{
+  const unsigned int nvar = _prog.nvar(), nfg = _prog.ndep();
+  _xD.resize( nvar );
+  _xMC.resize( nvar );
+  _fMC.resize( nfg );
+  for( unsigned int i=0; i<nvar; i++ ){
+    _xD[i] = Op<T>::mid( N.X[i] );
+    _xMC[i] = MCT( N.X[i], _xD[i] ).sub( nvar, i );
+  }
+  _prog.eval( &_xMC[0], &_fMC[0], _wkMC );
+
+  // Infeasibility and reduction of the box based on the affine relaxations of the constraints
+  for( unsigned int j=1; j<nfg; j++ ){
+    const MCT& G = _fMC[j];
+    if( _infeasible( j, G.l(), G.u() ) ) return false;
+    if( !G.cvsub() ) continue;
+    if( Op<T>::u( _C[j] ) < _inf() ){
+      if( !options.LINRED ){
+        if( _affmin( G.cv(), G.cvsub(), &_xD[0], N.X ) > Op<T>::u( _C[j] ) + options.FEASTOL ) return false;
+      }
+      else if( !_linred( G.cv(), G.cvsub(), &_xD[0], Op<T>::u( _C[j] ) + options.FEASTOL, N.X ) ) return false;
+    }
+    if( Op<T>::l( _C[j] ) > -_inf() ){
+      _s.resize( nvar );
+      for( unsigned int i=0; i<nvar; i++ ) _s[i] = -G.ccsub(i);
+      if( !options.LINRED ){
+        if( _affmin( -G.cc(), &_s[0], &_xD[0], N.X ) > -Op<T>::l( _C[j] ) + options.FEASTOL ) return false;
+      }
+      else if( !_linred( -G.cc(), &_s[0], &_xD[0], -Op<T>::l( _C[j] ) + options.FEASTOL, N.X ) ) return false;
+    }
+  }
+
+  // Reduction of the box based on the affine relaxation of the objective function and the best known value, then lower bound
+  const MCT& F = _fMC[0];
+  N.lbd = std::max( N.lbd, F.l() );
+  if( !F.cvsub() ) return true;
+  if( options.LINRED && _ubd < _inf() && !_linred( F.cv(), F.cvsub(), &_xD[0], _ubd, N.X ) ) return false;
+  N.lbd = std::max( N.lbd, _affmin( F.cv(), F.cvsub(), &_xD[0], N.X ) );
+  return true;
+}
+
+template <typename T> inline bool
+FFBranchBound<T>::_bound_taylor
+( t_node&N, TModel<T>*TM )
+{
+  const unsigned int nvar = _prog.nvar(), nfg = _prog.ndep();
+  _xTM.resize( nvar );
+  _fTM.resize( nfg );
+  for( unsigned int i=0; i<nvar; i++ )
+    _xTM[i] = TVT( TM, i, N.X[i] );
+  _prog.eval( &_xTM[0], &_fTM[0], _wkTM );
+
+  for( unsigned int j=1; j<nfg; j++ ){
+    const T G = _fTM[j].bound();
+    if( _infeasible( j, Op<T>::l( G ), Op<T>::u( G ) ) ) return false;
+  }
+  N.lbd = std::max( N.lbd, Op<T>::l( _fTM[0].bound() ) );
+  return true;
+}
+
+template <typename T> inline void
+FFBranchBound<T>::_incumbent
+( const std::vector<T>&X )
+{
+  const unsigned int nvar = _prog.nvar(), nfg = _prog.ndep();
+  _xD.resize( nvar );
+  _fD.resize( nfg );
+  for( unsigned int i=0; i<nvar; i++ )
+    _xD[i] = Op<T>::mid( X[i] );
+  _prog.eval( &_xD[0], &_fD[0], _wkD );
+
+  // The comparisons fail for the NaN values outside the domains of the functions
+  if( !( _fD[0] < _ubd ) ) return;
+  for( unsigned int j=1; j<nfg; j++ )
+    if( !( _fD[j] >= Op<T>::l( _C[j] ) - options.FEASTOL
+        && _fD[j] <= Op<T>::u( _C[j] ) + options.FEASTOL ) ) return;
+  _ubd = _fD[0];
+  _xinc = _xD;
+}
+
+template <typename T> inline bool
+FFBranchBound<T>::_infeasible
+( const unsigned int j, const double Fl, const double Fu ) const
+{
+  return Fl > Op<T>::u( _C[j] ) + options.FEASTOL
+      || Fu < Op<T>::l( _C[j] ) - options.FEASTOL;
+}
+
+template <typename T> inline double
+FFBranchBound<T>::_affmin
+( const double c, const double*s, const double*xref,
+  const std::vector<T>&X )
+{
+  const unsigned int nvar = X.size();
+  _lo.resize( nvar );
+  double fmin = c;
+  for( unsigned int i=0; i<nvar; i++ ){
+    _lo[i] = s[i] * ( ( s[i] > 0.? Op<T>::l( X[i] ): Op<T>::u( X[i] ) ) - xref[i] );
+    fmin += _lo[i];
+  }
+  return fmin;
+}
+
+template <typename T> inline bool
+FFBranchBound<T>::_linred
+( const double c, const double*s, const double*xref, const double r,
+  std::vector<T>&X )
+{
+  // Slack of the constraint at the minimum of the affine function, widened for the round-off errors
+  const double fmin = _affmin( c, s, xref, X );
+  double fsum = std::fabs( c ) + std::fabs( r );
+  for( unsigned int i=0; i<X.size(); i++ ) fsum += std::fabs( _lo[i] );
+  const double slack = r - fmin + 1e3*machprec()*fsum;
+  if( slack < 0. ) return false;
+
+  // Each term is bounded by the slack plus its own minimum
+  for( unsigned int i=0; i<X.size(); i++ ){
+    if( s[i] == 0. ) continue;
+    const double xb = xref[i] + ( slack + _lo[i] ) / s[i];
+    const double xl = Op<T>::l( X[i] ), xu = Op<T>::u( X[i] );
+    if( s[i] > 0. && xb < xu ) X[i] = T( xl, std::max( xl, xb ) );
+    else if( s[i] < 0. && xb > xl ) X[i] = T( std::min( xu, xb ), xu );
+  }
+  return true;
+}
+
+template <typename T> inline int
+FFBranchBound<T>::_select
+( const std::vector<T>&X ) const
+{
+  int ib = -1;
+  double wmax = options.BRANCHTOL;
+  for( unsigned int i=0; i<X.size(); i++ ){
+    const double w0 = Op<T>::diam( _X0[i] );
+    if( !( w0 > 0. ) ) continue;
+    const double w = Op<T>::diam( X[i] ) / w0;
+    if( w > wmax ){ wmax = w; ib = i; }
+  }
+  return ib;
+}
+
+} // namespace mc
+
+#endif
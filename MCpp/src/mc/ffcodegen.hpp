@@ -0,0 +1,624 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_FFCODEGEN Generating Source Code for McCormick Relaxations with mc::FFCodeGen
+\author Beno&icirc;t Chachuat
+
+Within a branch-and-bound algorithm, the same small factorable functions are relaxed on a very large number of boxes. With mc::McCormick, each of these relaxations goes through the overloaded operators, which create temporary objects, allocate and free the arrays of subgradient components, and propagate all these components even when most of them are zero. Evaluating a program of type mc::FFProgram (see \ref page_FFUNC) removes part of this overhead, but the elementary operations are still dispatched at run time on the opcodes of the instructions.
+
+The class mc::FFCodeGen removes the remaining overhead by generating the source code of a C++ function that computes the interval bounds, the convex and concave relaxations and their subgradients for a factorable function recorded in a graph of type mc::FFGraph. The generated code is a straight-line sequence of statements, one block for each operation of the function, where:
+- the real constants of the function are inlined as literals, e.g. the sign of a constant factor selects the relaxation rule when the code is generated rather than when it is executed;
+- only the subgradient components that may be nonzero are computed, based on the variables that each intermediate depends on, and the subgradients of the variables are the constants 0 or 1;
+- all the values are local variables of plain types, without any memory allocation.
+.
+The rules for the elementary operations are those of mc::McCormick< mc::Interval >, implemented by a few inline functions in the namespace <tt>mcgen</tt> that are emitted at the beginning of the generated code, so that this code is self-contained and does not depend on MC++ when it is compiled.
+
+
+\section sec_FFCODEGEN_use How do I generate the source code for the relaxations of a factorable function?
+
+Suppose we want to relax the function \f$f(x,y)=x\exp(y)-\log(x+2)\f$ within a branch-and-bound algorithm. The function is first recorded in a graph (see \ref sec_FFUNC_use):
+
+\code
+      #include <fstream>
+      #include "ffcodegen.hpp"
+
+      mc::FFGraph DAG;
+      mc::FFVar X[2] = { DAG.var(), DAG.var() };
+      mc::FFVar F = X[0]*exp(X[1]) - log(X[0]+2.);
+\endcode
+
+The code of the function <tt>fct</tt> is then generated for the dependent and independent variables, and written to a header file:
+
+\code
+      mc::FFCodeGen gen( DAG, 1, &F, 2, X );
+      std::ofstream os( "fct.hpp" );
+      gen.mccormick( os, "fct" );
+\endcode
+
+The generated function has the following prototype:
+
+\code
+      int fct( const double*xL, const double*xU, const double*xref, double*fL, double*fU,
+               double*fcv, double*fcc, double*fcvsub, double*fccsub );
+\endcode
+
+where <tt>xL</tt>, <tt>xU</tt> and <tt>xref</tt> are the lower and upper bounds of the <tt>nvar</tt> variables and the reference point where the relaxations are computed, and <tt>fL</tt>, <tt>fU</tt>, <tt>fcv</tt> and <tt>fcc</tt> receive the bounds and the values of the relaxations of the <tt>ndep</tt> dependents. The subgradients of the convex and concave relaxations of dependent <tt>j</tt> are written to <tt>fcvsub[j*nvar]</tt>, ..., <tt>fcvsub[j*nvar+nvar-1]</tt>, and likewise for <tt>fccsub</tt>. The results are those of the variables <tt>mc::McCormick<I>( I(xL[i],xU[i]), xref[i] ).sub(nvar,i)</tt> propagated through the function with the options mc::McCormick::Options::MVCOMP_USE and mc::McCormick::Options::ENVEL_USE set to false, up to round-off errors. In particular, the relaxations and interval bounds are not verified. The file <tt>fct.hpp</tt> can then be included in the solver and compiled with the rest of its code:
+
+\code
+      #include "fct.hpp"
+
+      double xL[2] = { 0., -1. }, xU[2] = { 1., 1. }, xref[2] = { 0.5, 0. };
+      double fL, fU, fcv, fcc, fcvsub[2], fccsub[2];
+      if( fct( xL, xU, xref, &fL, &fU, &fcv, &fcc, fcvsub, fccsub ) )
+        std::cout << "relaxation failed" << std::endl;
+\endcode
+
+Several functions can be generated in the same file, in which case the inline functions of the namespace <tt>mcgen</tt> are only emitted once, or in the same translation unit.
+
+
+\section sec_FFCODEGEN_err What errors can I encounter when using mc::FFCodeGen?
+
+An exception of type mc::FFGraph::Exceptions is thrown when the code is generated for variables that are not recorded in the graph (see \ref sec_FFUNC_err), or for a function with an operation that has no code generation rule. These rules are available for the sum, difference, product and division, the operations with a real constant, the negation, the square, the integer powers, the square root, the exponential, the logarithm, the function \f$x\log(x)\f$ and the absolute value. The other operations require the computation of convex or concave envelopes by iterative methods in mc::McCormick, and throw the exception <tt>-33</tt>.
+
+The generated function returns 0 when the relaxations are computed, or the error code of mc::McCormick::Exceptions when the range of an intermediate is outside the domain of an operation:
+
+<TABLE border="1">
+<CAPTION><EM>Error codes returned by the code generated with mc::FFCodeGen</EM></CAPTION>
+     <TR><TH><b>Number</b> <TD><b>Description</b>
+     <TR><TH><tt>1</tt> <TD>Division by zero
+     <TR><TH><tt>2</tt> <TD>Inverse or negative integer power with zero in range
+     <TR><TH><tt>3</tt> <TD>Logarithm with nonpositive values in range
+     <TR><TH><tt>4</tt> <TD>Square root with negative values in range
+</TABLE>
+
+
+\section sec_FFCODEGEN_refs References
+
+- McCormick, G. P., <A href="http://dx.doi.org/10.1007/BF01580665">Computability of global solutions to factorable nonconvex programs: Part I. Convex underestimating problems</A>, <i>Mathematical Programming</i>, <b>10</b>(2):147-175, 1976
+- Mitsos, A., B. Chachuat, and P.I. Barton, <A href="http://dx.doi.org/10.1137/080717341">McCormick-based relaxations of algorithms</A>, <i>SIAM Journal on Optimization</i>, <b>20</b>(2):573-601, 2009
+.
+
+*/
+
+#ifndef MC__FFCODEGEN_HPP
+#define MC__FFCODEGEN_HPP
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include "mcfunc.hpp"
+#include "ffunc.hpp"
+
+namespace mc
+{
+
+//! @brief C++ class generating the source code of McCormick relaxations for factorable functions recorded in mc::FFGraph
+////////////////////////////////////////////////////////////////////////
+//! mc::FFCodeGen is a C++ class generating the source code of a C++
+//! function that computes the interval bounds, the convex and concave
+//! relaxations and their subgradients for factorable functions recorded
+//! in a graph of type mc::FFGraph, as straight-line code without any
+//! memory allocation.
+////////////////////////////////////////////////////////////////////////
+class FFCodeGen
+////////////////////////////////////////////////////////////////////////
+{
+public:
+
+  typedef FFGraph::Exceptions Exceptions;
+
+  //! @brief Default constructor
+  FFCodeGen()
+    {}
+
+  //! @brief Constructor for the <a>ndep</a> dependents <a>dep</a> in graph <a>dag</a> as functions of the <a>nvar</a> independents <a>var</a>
+  FFCodeGen
+    ( const FFGraph&dag, const unsigned int ndep, const FFVar*dep,
+      const unsigned int nvar, const FFVar*var )
+    { compile( dag, ndep, dep, nvar, var ); }
+
+  //! @brief Compile the <a>ndep</a> dependents <a>dep</a> in graph <a>dag</a> as functions of the <a>nvar</a> independents <a>var</a>
+  void compile
+    ( const FFGraph&dag, const unsigned int ndep, const FFVar*dep,
+      const unsigned int nvar, const FFVar*var );
+
+  //! @brief Write the source code of the function <a>name</a> computing the McCormick relaxations of the dependents to <a>os</a>
+  void mccormick
+    ( std::ostream&os, const std::string&name ) const;
+
+  //! @brief Number of independent variables
+  unsigned int nvar() const
+    { return _prog.nvar(); }
+
+  //! @brief Number of dependent variables
+  unsigned int ndep() const
+    { return _prog.ndep(); }
+
+private:
+
+  typedef FFProgram::t_instr t_instr;
+
+  //! @brief Structure storing the name of a value and the expressions of its subgradient components, empty if zero
+  struct t_val{
+    std::string name;
+    std::vector<std::string> cvs;
+    std::vector<std::string> ccs;
+  };
+
+  //! @brief Program with one slot for each value
+  FFProgram _prog;
+
+  //! @brief Source code of the inline functions for the elementary operations
+  static const char* _kernels();
+
+  //! @brief Literal for the real constant <a>c</a>
+  static std::string _lit
+    ( const double c );
+
+  //! @brief Name of a value computed by instruction <a>k</a>, followed by <a>suffix</a>
+  static std::string _name
+    ( const unsigned int k, const char*suffix="" );
+
+  //! @brief Write the declarations of the subgradient components of value <a>r</a>, and replace their expressions with their names
+  void _subgrad
+    ( std::ostream&os, t_val&r ) const;
+
+  //! @brief Write the call to the kernel <a>call</a> for an operation on <a>a</a> and <a>b</a> (if any), whose result is <a>r</a>
+  void _kernel
+    ( std::ostream&os, const std::string&call, const t_val&a, const t_val*b,
+      t_val&r ) const;
+
+  //! @brief Write the code of the operation <a>op</a> with constant <a>c</a> on <a>a</a>, whose result is <a>r</a>
+  void _affine
+    ( std::ostream&os, const int op, const double c, const t_val&a, t_val&r ) const;
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline void
+FFCodeGen::compile
+( const FFGraph&dag, const unsigned int ndep, const FFVar*dep,
+  const unsigned int nvar, const FFVar*var )
+{
+  _prog.options.REUSE_SLOTS = false;
+  _prog.options.LEVEL_SCHEDULE = false;
+  _prog.compile( dag, ndep, dep, nvar, var );
+  std::vector<t_instr>::const_iterator it = _prog._instr.begin();
+  for( ; it != _prog._instr.end(); ++it ){
+    switch( it->op ){
+    case FFGraph::CNST: case FFGraph::ADD:  case FFGraph::SUB:  case FFGraph::MUL:
+    case FFGraph::DIV:  case FFGraph::ADDC: case FFGraph::CSUB: case FFGraph::MULC:
+    case FFGraph::DIVC: case FFGraph::CDIV: case FFGraph::NEG:  case FFGraph::SQR:
+    case FFGraph::SQRT: case FFGraph::EXP:  case FFGraph::LOG:  case FFGraph::XLOG:
+    case FFGraph::FABS: case FFGraph::POWI:
+      break;
+    default:
+      throw Exceptions( Exceptions::UNDEF );
+    }
+    if( it->op == FFGraph::CNST && !( std::fabs( it->c ) <= std::numeric_limits<double>::max() ) )
+      throw Exceptions( Exceptions::UNDEF );
+  }
+}
+
+inline std::string
+FFCodeGen::_lit
+( const double c )
+{
+  // Shortest decimal representation that reads back as c
+  std::ostringstream oss;
+  for( int p=1; p<=std::numeric_limits<double>::digits10+2; p++ ){
+    oss.str( "" );
+    oss.precision( p );
+    oss << c;
+    std::istringstream iss( oss.str() );
+    double cr;
+    if( iss >> cr && cr == c ) break;
+  }
+  std::string s = oss.str();
+  if( s.find_first_of( ".e" ) == std::string::npos ) s += ".";
+  return c < 0.? "(" + s + ")": s;
+}
+
+inline std::string
+FFCodeGen::_name
+( const unsigned int k, const char*suffix )
+{
+  std::ostringstream oss;
+  oss << "v" << k << suffix;
+  return oss.str();
+}
+
+inline void
+FFCodeGen::_subgrad
+( std::ostream&os, t_val&r ) const
+{
+  for( unsigned int i=0; i<r.cvs.size(); i++ ){
+    if( r.cvs[i].empty() && r.ccs[i].empty() ) continue;
+    std::ostringstream cvs, ccs;
+    cvs << r.name << "_cvs" << i;
+    ccs << r.name << "_ccs" << i;
+    os << "  const double " << cvs.str() << " = " << ( r.cvs[i].empty()? "0.": r.cvs[i] )
+       << ", " << ccs.str() << " = " << ( r.ccs[i].empty()? "0.": r.ccs[i] ) << ";\n";
+    r.cvs[i] = cvs.str();
+    r.ccs[i] = ccs.str();
+  }
+}
+
+inline void
+FFCodeGen::_kernel
+( std::ostream&os, const std::string&call, const t_val&a, const t_val*b,
+  t_val&r ) const
+{
+  os << "  mcgen::val " << r.name << "; mcgen::der " << r.name << "cv, " << r.name << "cc;\n"
+     << "  if( int err = mcgen::" << call << ", " << r.name << ", " << r.name << "cv, "
+     << r.name << "cc ) ) return err;\n";
+
+  // Subgradient components as k1*sel(i1,a)+k2*sel(i2,b)
+  const unsigned int nvar = r.cvs.size();
+  const char* rel[2] = { "cv", "cc" };
+  for( unsigned int i=0; i<nvar; i++ ){
+    const bool ina = !a.cvs[i].empty() || !a.ccs[i].empty();
+    const bool inb = b && ( !b->cvs[i].empty() || !b->ccs[i].empty() );
+    for( unsigned int j=0; j<2; j++ ){
+      std::ostringstream oss;
+      if( ina )
+        oss << r.name << rel[j] << ".k1*mcgen::sel( " << r.name << rel[j] << ".i1, "
+            << ( a.cvs[i].empty()? "0.": a.cvs[i] ) << ", " << ( a.ccs[i].empty()? "0.": a.ccs[i] ) << " )";
+      if( ina && inb ) oss << " + ";
+      if( inb )
+        oss << r.name << rel[j] << ".k2*mcgen::sel( " << r.name << rel[j] << ".i2, "
+            << ( b->cvs[i].empty()? "0.": b->cvs[i] ) << ", " << ( b->ccs[i].empty()? "0.": b->ccs[i] ) << " )";
+      ( j? r.ccs[i]: r.cvs[i] ) = oss.str();
+    }
+  }
+  _subgrad( os, r );
+}
+
+inline void
+FFCodeGen::_affine
+( std::ostream&os, const int op, const double c, const t_val&a, t_val&r ) const
+{
+  // Result c+a, c-a or c*a, with the relaxations of a swapped when the sign of a is flipped
+  const std::string C = _lit( c ), A = a.name;
+  std::string l, u, cv, cc, scv, scc;
+  switch( op ){
+  case FFGraph::ADDC:
+    l = C+" + "+A+".l"; u = C+" + "+A+".u"; cv = C+" + "+A+".cv"; cc = C+" + "+A+".cc";
+    break;
+  case FFGraph::CSUB:
+    l = C+" - "+A+".u"; u = C+" - "+A+".l"; cv = C+" - "+A+".cc"; cc = C+" - "+A+".cv";
+    scv = "-"; scc = "-";
+    break;
+  case FFGraph::NEG:
+    l = "-"+A+".u"; u = "-"+A+".l"; cv = "-"+A+".cc"; cc = "-"+A+".cv";
+    scv = "-"; scc = "-";
+    break;
+  case FFGraph::MULC: default:
+    if( c >= 0. ){
+      l = C+"*"+A+".l"; u = C+"*"+A+".u"; cv = C+"*"+A+".cv"; cc = C+"*"+A+".cc";
+    }
+    else{
+      l = C+"*"+A+".u"; u = C+"*"+A+".l"; cv = C+"*"+A+".cc"; cc = C+"*"+A+".cv";
+    }
+    scv = scc = C+"*";
+    break;
+  }
+  os << "  const mcgen::val " << r.name << " = { " << l << ", " << u << ", " << cv << ", " << cc << " };\n";
+
+  const bool flip = ( op == FFGraph::CSUB || op == FFGraph::NEG || ( op == FFGraph::MULC && c < 0. ) );
+  for( unsigned int i=0; i<r.cvs.size(); i++ ){
+    const std::string& acv = flip? a.ccs[i]: a.cvs[i];
+    const std::string& acc = flip? a.cvs[i]: a.ccs[i];
+    r.cvs[i] = acv.empty()? "": scv+acv;
+    r.ccs[i] = acc.empty()? "": scc+acc;
+  }
+  _subgrad( os, r );
+}
+
+inline void
+FFCodeGen::mccormick
+( std::ostream&os, const std::string&name ) const
+{
+  const unsigned int nvar = _prog._nvar, ndep = _prog._dep.size();
+  os << "// McCormick relaxations of " << ndep << " function(s) in " << nvar
+     << " variable(s), generated by mc::FFCodeGen\n\n"
+     << _kernels() << "\n"
+     << "inline int " << name << "\n"
+     << "( const double*xL, const double*xU, const double*xref, double*fL, double*fU,\n"
+     << "  double*fcv, double*fcc, double*fcvsub, double*fccsub )\n"
+     << "{\n";
+
+  // Values of the slots, only declared for the variables that are read
+  std::vector<t_val> v( _prog._nslot );
+  std::vector<bool> read( _prog._nslot, false );
+  for( unsigned int k=0; k<_prog._instr.size(); k++ ){
+    const t_instr& in = _prog._instr[k];
+    const unsigned int narg = FFGraph::narg( in.op );
+    if( narg > 0 ) read[in.a1] = true;
+    if( narg > 1 ) read[in.a2] = true;
+  }
+  for( unsigned int j=0; j<ndep; j++ ) read[_prog._dep[j]] = true;
+  for( unsigned int k=0; k<_prog._nslot; k++ ){
+    v[k].name = _name( k );
+    v[k].cvs.assign( nvar, "" );
+    v[k].ccs.assign( nvar, "" );
+  }
+  for( unsigned int i=0; i<nvar; i++ ){
+    v[i].cvs[i] = v[i].ccs[i] = "1.";
+    if( !read[i] ) continue;
+    os << "  const mcgen::val " << v[i].name << " = { xL[" << i << "], xU[" << i
+       << "], xref[" << i << "], xref[" << i << "] };\n";
+  }
+
+  for( unsigned int k=0; k<_prog._instr.size(); k++ ){
+    const t_instr& in = _prog._instr[k];
+    t_val& r = v[in.res];
+    const t_val& a = v[in.a1];
+    const t_val& b = v[in.a2];
+    std::ostringstream call;
+    switch( in.op ){
+    case FFGraph::CNST:
+      os << "  const mcgen::val " << r.name << " = { " << _lit( in.c ) << ", " << _lit( in.c )
+         << ", " << _lit( in.c ) << ", " << _lit( in.c ) << " };\n";
+      break;
+    case FFGraph::ADD:
+    case FFGraph::SUB:
+      if( in.op == FFGraph::SUB && in.a1 == in.a2 ){
+        os << "  const mcgen::val " << r.name << " = { 0., 0., 0., 0. };\n";
+        break;
+      }
+      { const char* s = in.op == FFGraph::ADD? " + ": " - ";
+        os << "  const mcgen::val " << r.name << " = { " << a.name << ".l" << s << b.name
+           << ( in.op == FFGraph::ADD? ".l, ": ".u, " ) << a.name << ".u" << s << b.name
+           << ( in.op == FFGraph::ADD? ".u, ": ".l, " ) << a.name << ".cv" << s << b.name
+           << ( in.op == FFGraph::ADD? ".cv, ": ".cc, " ) << a.name << ".cc" << s << b.name
+           << ( in.op == FFGraph::ADD? ".cc };\n": ".cv };\n" );
+        for( unsigned int i=0; i<nvar; i++ ){
+          const std::string& bcv = in.op == FFGraph::ADD? b.cvs[i]: b.ccs[i];
+          const std::string& bcc = in.op == FFGraph::ADD? b.ccs[i]: b.cvs[i];
+          r.cvs[i] = a.cvs[i].empty()? ( bcv.empty()? "": ( in.op == FFGraph::ADD? "": "-" ) + bcv ):
+                     ( bcv.empty()? a.cvs[i]: a.cvs[i] + s + bcv );
+          r.ccs[i] = a.ccs[i].empty()? ( bcc.empty()? "": ( in.op == FFGraph::ADD? "": "-" ) + bcc ):
+                     ( bcc.empty()? a.ccs[i]: a.ccs[i] + s + bcc );
+        }
+        _subgrad( os, r ); }
+      break;
+    case FFGraph::MUL:
+      if( in.a1 == in.a2 ){ _kernel( os, "sqr( "+a.name, a, 0, r ); break; }
+      _kernel( os, "mul( "+a.name+", "+b.name, a, &b, r );
+      break;
+    case FFGraph::DIV:
+    { if( in.a1 == in.a2 ){
+        os << "  const mcgen::val " << r.name << " = { 1., 1., 1., 1. };\n";
+        break;
+      }
+      t_val t = b; t.name = _name( in.res, "i" );
+      _kernel( os, "inv( "+b.name, b, 0, t );
+      _kernel( os, "mul( "+a.name+", "+t.name, a, &t, r );
+      break; }
+    case FFGraph::ADDC: case FFGraph::CSUB: case FFGraph::MULC: case FFGraph::NEG:
+      _affine( os, in.op, in.c, a, r );
+      break;
+    case FFGraph::DIVC:
+      if( isequal( in.c, 0. ) ){
+        os << "  return 1;\n}\n";
+        return;
+      }
+      _affine( os, FFGraph::MULC, 1./in.c, a, r );
+      break;
+    case FFGraph::CDIV:
+    { if( in.c == 1. ){ _kernel( os, "inv( "+a.name, a, 0, r ); break; }
+      t_val t = a; t.name = _name( in.res, "i" );
+      _kernel( os, "inv( "+a.name, a, 0, t );
+      _affine( os, FFGraph::MULC, in.c, t, r );
+      break; }
+    case FFGraph::SQR:
+      _kernel( os, "sqr( "+a.name, a, 0, r );
+      break;
+    case FFGraph::POWI:
+    { const int n = (int)in.c;
+      call << "pow( " << a.name << ", " << n;
+      if( n < 3 || !(n%2) ){ _kernel( os, call.str(), a, 0, r ); break; }
+      // Odd powers as the product of an even power and the variable
+      t_val t = a; t.name = _name( in.res, "p" );
+      call.str( "" ); call << "pow( " << a.name << ", " << n-1;
+      _kernel( os, call.str(), a, 0, t );
+      _kernel( os, "mul( "+t.name+", "+a.name, t, &a, r );
+      break; }
+    case FFGraph::SQRT:
+      _kernel( os, "sqrt( "+a.name, a, 0, r );
+      break;
+    case FFGraph::EXP:
+      _kernel( os, "exp( "+a.name, a, 0, r );
+      break;
+    case FFGraph::LOG:
+      _kernel( os, "log( "+a.name, a, 0, r );
+      break;
+    case FFGraph::XLOG:
+      _kernel( os, "xlog( "+a.name, a, 0, r );
+      break;
+    case FFGraph::FABS:
+      _kernel( os, "fabs( "+a.name, a, 0, r );
+      break;
+    default:
+      throw Exceptions( Exceptions::UNDEF );
+    }
+  }
+
+  // Bounds, relaxations and subgradients of the dependents
+  for( unsigned int j=0; j<ndep; j++ ){
+    const t_val& r = v[_prog._dep[j]];
+    os << "  fL[" << j << "] = " << r.name << ".l; fU[" << j << "] = " << r.name << ".u; fcv["
+       << j << "] = " << r.name << ".cv; fcc[" << j << "] = " << r.name << ".cc;\n";
+    for( unsigned int i=0; i<nvar; i++ )
+      os << "  fcvsub[" << j*nvar+i << "] = " << ( r.cvs[i].empty()? "0.": r.cvs[i] )
+         << "; fccsub[" << j*nvar+i << "] = " << ( r.ccs[i].empty()? "0.": r.ccs[i] ) << ";\n";
+  }
+  os << "  return 0;\n}\n";
+}
+
+inline const char*
+FFCodeGen::_kernels()
+{
+  return
+    "#ifndef MC__FFCODEGEN_KERNELS\n"
+    "#define MC__FFCODEGEN_KERNELS\n"
+    "#include <cmath>\n"
+    "#include <cfloat>\n"
+    "#include <algorithm>\n"
+    "namespace mcgen\n"
+    "{\n"
+    "// Bounds and relaxations of a value, and subgradients of a relaxation as\n"
+    "// k1*s(i1,a)+k2*s(i2,b), where s(i,a) is the subgradient of the convex\n"
+    "// (i=CV) or concave (i=CC) relaxation of operand a, or 0 (i=0)\n"
+    "enum{ CUT=0, CV, CC };\n"
+    "struct val{ double l, u, cv, cc; };\n"
+    "struct der{ int i1, i2; double k1, k2; };\n"
+    "inline double sel( const int i, const double cvs, const double ccs )\n"
+    "{ return i==CV? cvs: i==CC? ccs: 0.; }\n"
+    "inline double mid( const double cv, const double cc, const double z, int&i )\n"
+    "{ if( z < cv ){ i = CV; return cv; } if( z > cc ){ i = CC; return cc; } i = CUT; return z; }\n"
+    "inline double mid( const double l, const double u, const double z )\n"
+    "{ int i; return mid( l, u, z, i ); }\n"
+    "inline bool thin( const double l, const double u )\n"
+    "{ return !( std::fabs(l-u) > DBL_EPSILON + 0.5*std::fabs(l+u)*DBL_EPSILON ); }\n"
+    "inline void set( der&d, const int i, const double k )\n"
+    "{ d.i1 = i; d.k1 = k; d.i2 = CUT; d.k2 = 0.; }\n"
+    "inline void set( der&d, const int i1, const double k1, const int i2, const double k2 )\n"
+    "{ d.i1 = i1; d.k1 = k1; d.i2 = i2; d.k2 = k2; }\n"
+    "inline int cut( val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  if( r.cv < r.l ){ r.cv = r.l; dcv.k1 = dcv.k2 = 0.; }\n"
+    "  if( r.cc > r.u ){ r.cc = r.u; dcc.k1 = dcc.k2 = 0.; }\n"
+    "  return 0;\n"
+    "}\n"
+    "inline int mul( const val&a, const val&b, val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  r.l = std::min( std::min( a.l*b.l, a.l*b.u ), std::min( a.u*b.l, a.u*b.u ) );\n"
+    "  r.u = std::max( std::max( a.l*b.l, a.l*b.u ), std::max( a.u*b.l, a.u*b.u ) );\n"
+    "  const int ia1 = b.u>=0.? CV: CC, ib1 = a.u>=0.? CV: CC, ia2 = b.l>=0.? CV: CC, ib2 = a.l>=0.? CV: CC;\n"
+    "  const double cv1 = b.u*(ia1==CV? a.cv: a.cc) + a.u*(ib1==CV? b.cv: b.cc) - a.u*b.u;\n"
+    "  const double cv2 = b.l*(ia2==CV? a.cv: a.cc) + a.l*(ib2==CV? b.cv: b.cc) - a.l*b.l;\n"
+    "  if( cv1 > cv2 ){ r.cv = cv1; set( dcv, ia1, b.u, ib1, a.u ); }\n"
+    "  else{ r.cv = cv2; set( dcv, ia2, b.l, ib2, a.l ); }\n"
+    "  const int ja1 = b.l>=0.? CC: CV, jb1 = a.u>=0.? CC: CV, ja2 = b.u>=0.? CC: CV, jb2 = a.l>=0.? CC: CV;\n"
+    "  const double cc1 = b.l*(ja1==CV? a.cv: a.cc) + a.u*(jb1==CV? b.cv: b.cc) - a.u*b.l;\n"
+    "  const double cc2 = b.u*(ja2==CV? a.cv: a.cc) + a.l*(jb2==CV? b.cv: b.cc) - a.l*b.u;\n"
+    "  if( cc1 < cc2 ){ r.cc = cc1; set( dcc, ja1, b.l, jb1, a.u ); }\n"
+    "  else{ r.cc = cc2; set( dcc, ja2, b.u, jb2, a.l ); }\n"
+    "  return cut( r, dcv, dcc );\n"
+    "}\n"
+    "inline int inv( const val&a, val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  if( a.l <= 0. && a.u >= 0. ) return 2;\n"
+    "  r.l = 1./a.u; r.u = 1./a.l;\n"
+    "  int i; double m;\n"
+    "  if( a.l > 0. ){\n"
+    "    m = mid( a.cv, a.cc, a.u, i ); r.cv = 1./m; set( dcv, i, -1./(m*m) );\n"
+    "    m = mid( a.cv, a.cc, a.l, i ); r.cc = 1./a.l + 1./a.u - m/(a.l*a.u); set( dcc, i, -1./(a.l*a.u) );\n"
+    "  }\n"
+    "  else{\n"
+    "    m = mid( a.cv, a.cc, a.u, i ); r.cv = 1./a.l + 1./a.u - m/(a.l*a.u); set( dcv, i, -1./(a.l*a.u) );\n"
+    "    m = mid( a.cv, a.cc, a.l, i ); r.cc = 1./m; set( dcc, i, -1./(m*m) );\n"
+    "  }\n"
+    "  return cut( r, dcv, dcc );\n"
+    "}\n"
+    "inline int sqr( const val&a, val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  const double z = mid( a.l, a.u, 0. ), zu = a.l*a.l > a.u*a.u? a.l: a.u;\n"
+    "  r.l = z*z; r.u = std::max( a.l*a.l, a.u*a.u );\n"
+    "  int i; double m = mid( a.cv, a.cc, z, i ); r.cv = m*m; set( dcv, i, 2.*m );\n"
+    "  const double s = thin( a.l, a.u )? 0.: ( a.u*a.u - a.l*a.l )/( a.u - a.l );\n"
+    "  m = mid( a.cv, a.cc, zu, i ); r.cc = a.l*a.l + s*( m - a.l ); set( dcc, i, s );\n"
+    "  return cut( r, dcv, dcc );\n"
+    "}\n"
+    "inline int pow( const val&a, const int n, val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  int i; double m;\n"
+    "  if( n >= 2 ){\n"
+    "    const double z = mid( a.l, a.u, 0. ), pl = std::pow( a.l, n ), pu = std::pow( a.u, n );\n"
+    "    r.l = std::max( 0., std::pow( z, n ) ); r.u = std::max( pl, pu );\n"
+    "    m = mid( a.cv, a.cc, z, i ); r.cv = std::pow( m, n ); set( dcv, i, n*std::pow( m, n-1 ) );\n"
+    "    const double s = thin( a.l, a.u )? 0.: ( pu - pl )/( a.u - a.l );\n"
+    "    m = mid( a.cv, a.cc, pl > pu? a.l: a.u, i ); r.cc = pl + s*( m - a.l ); set( dcc, i, s );\n"
+    "    return cut( r, dcv, dcc );\n"
+    "  }\n"
+    "  if( n == -1 ) return inv( a, r, dcv, dcc );\n"
+    "  if( a.l <= 0. && a.u >= 0. ) return 2;\n"
+    "  const int p = -n;\n"
+    "  const double pl = p%2? std::pow( a.l, p ): std::max( 0., std::pow( mid( a.l, a.u, 0. ), p ) );\n"
+    "  const double pu = p%2? std::pow( a.u, p ): std::max( std::pow( a.l, p ), std::pow( a.u, p ) );\n"
+    "  r.l = 1./pu; r.u = 1./pl;\n"
+    "  double s = std::pow( a.l, p-1 ) + std::pow( a.u, p-1 );\n"
+    "  for( int k=1; k<=p-2; k++ ) s += std::pow( a.l, k ) * std::pow( a.u, p-1-k );\n"
+    "  s /= - std::pow( a.l, p ) * std::pow( a.u, p );\n"
+    "  if( a.l > 0. ){\n"
+    "    m = mid( a.cv, a.cc, a.u, i ); r.cv = std::pow( m, n ); set( dcv, i, n*std::pow( m, n-1 ) );\n"
+    "    m = mid( a.cv, a.cc, a.l, i ); r.cc = std::pow( a.l, n ) + s*( m - a.l ); set( dcc, i, s );\n"
+    "  }\n"
+    "  else if( p%2 ){\n"
+    "    m = mid( a.cv, a.cc, a.u, i ); r.cv = std::pow( a.l, n ) + s*( m - a.l ); set( dcv, i, s );\n"
+    "    m = mid( a.cv, a.cc, a.l, i ); r.cc = std::pow( m, n ); set( dcc, i, n*std::pow( m, n-1 ) );\n"
+    "  }\n"
+    "  else{\n"
+    "    m = mid( a.cv, a.cc, a.l, i ); r.cv = std::pow( m, n ); set( dcv, i, n*std::pow( m, n-1 ) );\n"
+    "    m = mid( a.cv, a.cc, a.u, i ); r.cc = std::pow( a.l, n ) + s*( m - a.l ); set( dcc, i, s );\n"
+    "  }\n"
+    "  return cut( r, dcv, dcc );\n"
+    "}\n"
+    "inline int sqrt( const val&a, val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  if( a.l < 0. ) return 4;\n"
+    "  r.l = std::max( 0., std::sqrt( a.l ) ); r.u = std::sqrt( a.u );\n"
+    "  const double s = thin( a.l, a.u )? 0.: ( std::sqrt( a.u ) - std::sqrt( a.l ) )/( a.u - a.l );\n"
+    "  int i; double m = mid( a.cv, a.cc, a.l, i ); r.cv = std::sqrt( a.l ) + s*( m - a.l ); set( dcv, i, s );\n"
+    "  m = mid( a.cv, a.cc, a.u, i ); r.cc = std::sqrt( m ); set( dcc, i, 1./(2.*r.cc) );\n"
+    "  return cut( r, dcv, dcc );\n"
+    "}\n"
+    "inline int exp( const val&a, val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  r.l = std::max( 0., std::exp( a.l ) ); r.u = std::exp( a.u );\n"
+    "  int i; double m = mid( a.cv, a.cc, a.l, i ); r.cv = std::exp( m ); set( dcv, i, r.cv );\n"
+    "  const double s = thin( a.l, a.u )? 0.: ( std::exp( a.u ) - std::exp( a.l ) )/( a.u - a.l );\n"
+    "  m = mid( a.cv, a.cc, a.u, i ); r.cc = std::exp( a.u ) + s*( m - a.u ); set( dcc, i, s );\n"
+    "  return cut( r, dcv, dcc );\n"
+    "}\n"
+    "inline int log( const val&a, val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  if( a.l <= 0. ) return 3;\n"
+    "  r.l = std::log( a.l ); r.u = std::log( a.u );\n"
+    "  const double s = thin( a.l, a.u )? 0.: ( std::log( a.u ) - std::log( a.l ) )/( a.u - a.l );\n"
+    "  int i; double m = mid( a.cv, a.cc, a.l, i ); r.cv = std::log( a.l ) + s*( m - a.l ); set( dcv, i, s );\n"
+    "  m = mid( a.cv, a.cc, a.u, i ); r.cc = std::log( m ); set( dcc, i, 1./m );\n"
+    "  return cut( r, dcv, dcc );\n"
+    "}\n"
+    "inline int xlog( const val&a, val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  if( a.l <= 0. ) return 3;\n"
+    "  const double z = mid( a.l, a.u, std::exp(-1.) ), xl = a.l*std::log( a.l ), xu = a.u*std::log( a.u );\n"
+    "  r.l = z*std::log( z ); r.u = std::max( xl, xu );\n"
+    "  int i; double m = mid( a.cv, a.cc, z, i ); r.cv = m*std::log( m ); set( dcv, i, std::log( m ) + 1. );\n"
+    "  const double s = thin( a.l, a.u )? 0.: ( xu - xl )/( a.u - a.l );\n"
+    "  m = mid( a.cv, a.cc, xu >= xl? a.u: a.l, i ); r.cc = xl + s*( m - a.l ); set( dcc, i, s );\n"
+    "  return cut( r, dcv, dcc );\n"
+    "}\n"
+    "inline int fabs( const val&a, val&r, der&dcv, der&dcc )\n"
+    "{\n"
+    "  const double z = mid( a.l, a.u, 0. );\n"
+    "  r.l = std::fabs( z ); r.u = std::max( std::fabs( a.l ), std::fabs( a.u ) );\n"
+    "  int i; double m = mid( a.cv, a.cc, z, i ); r.cv = std::fabs( m ); set( dcv, i, m >= 0.? 1.: -1. );\n"
+    "  const double s = thin( a.l, a.u )? 0.: ( std::fabs( a.u ) - std::fabs( a.l ) )/( a.u - a.l );\n"
+    "  m = mid( a.cv, a.cc, std::fabs( a.l ) > std::fabs( a.u )? a.l: a.u, i ); r.cc = std::fabs( a.l ) + s*( m - a.l ); set( dcc, i, s );\n"
+    "  return cut( r, dcv, dcc );\n"
+    "}\n"
+    "} // namespace mcgen\n"
+    "#endif\n";
+}
+
+} // namespace mc
+
+#endif
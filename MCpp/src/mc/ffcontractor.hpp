@@ -0,0 +1,425 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_FFCONTRACTOR Constraint Propagation on Factorable Functions with mc::FFContractor
+\author Beno&icirc;t Chachuat
+
+Before bounding or relaxing a set of factorable constraints \f$\underline{c}_j \leq g_j(x) \leq \overline{c}_j\f$, \f$j=1,\ldots,m\f$, on a box \f$X\f$, it is often worth reducing \f$X\f$ without losing any feasible point, as the bounds and relaxations of MC++ get tighter on smaller boxes. A cheap and effective way of doing this is constraint propagation [Benhamou <I>et al.</I>, 1999]. The class mc::FFContractor implements the forward-backward propagation of the algorithm HC4 on the constraints recorded in a graph of type mc::FFGraph (see \ref page_FFUNC). For each constraint, the revision consists of:
+- a forward pass, in which the ranges of all the subexpressions of \f$g_j\f$ are computed in the interval arithmetic <tt>T</tt> from the leaves to the root of the graph, and intersected with their previous ranges;
+- an intersection of the range of \f$g_j\f$ with \f$[\underline{c}_j,\overline{c}_j]\f$; and
+- a backward pass, in which the range of each subexpression is projected onto its operands from the root to the leaves, e.g. the range of \f$x\f$ is intersected with \f$z-y\f$ for the sum \f$z=x+y\f$, with \f$\log(z)\f$ for the exponential \f$z=\exp(x)\f$, or with \f$\sqrt{z}\cup-\sqrt{z}\f$ for the square \f$z=x^2\f$.
+.
+The ranges of the subexpressions are stored for all the nodes of the graph, so that a subexpression shared by several constraints (see \ref sec_FFUNC_opt) benefits from the reductions obtained with each one of them [Schichl & Neumaier, 2005]. The revisions are scheduled with a worklist until a fixpoint is reached: all the constraints are queued at first, and the constraints that depend on a variable whose range has been reduced by a significant fraction are queued again after each revision.
+
+The template parameter <tt>T</tt> can be any interval type supported by MC++, namely mc::Interval and the interval types of PROFIL or FILIB++ through the specializations in <tt>mcprofil.hpp</tt> and <tt>mcfilib.hpp</tt>; it must be constructible from its lower and upper bounds, possibly infinite. The inverses of the elementary operations that are not computed in <tt>T</tt>, namely the roots for the integer powers, are widened by a few units of machine precision to account for round-off errors. Note that the propagation is verified only to the same extent as the arithmetic <tt>T</tt>. Round-off errors matter more in the backward pass than in a forward evaluation, since a projection that is slightly too narrow removes feasible points from the box, e.g. the square of the lower bound of \f$\sqrt{z}\f$ computed to nearest may exceed \f$\underline{z}\f$ by one unit of machine precision. With mc::Interval, the function <tt>contract</tt> should therefore be called in a verified scope (see \ref sec_INTERVAL_verif).
+
+
+\section sec_FFCONTRACTOR_use How do I reduce a box with mc::FFContractor?
+
+Suppose we want to reduce the box \f$[-10,10]^2\f$ subject to the constraints \f$x^2+y^2 \leq 1\f$ and \f$\exp(x)-y \leq 0\f$. The relevant header files are:
+
+\code
+      #include "interval.hpp"
+      #include "ffcontractor.hpp"
+      typedef mc::Interval I;
+\endcode
+
+The constraint functions are first recorded in a graph, then the contractor is constructed for these constraints and variables:
+
+\code
+      mc::FFGraph DAG;
+      mc::FFVar X[2] = { DAG.var(), DAG.var() };
+      mc::FFVar G[2] = { sqr(X[0])+sqr(X[1]), exp(X[0])-X[1] };
+      mc::FFContractor<I> HC4( DAG, 2, G, 2, X );
+\endcode
+
+The box is reduced in place for the given ranges of the constraint functions, where infinite bounds are used for one-sided constraints:
+
+\code
+      const double INF = std::numeric_limits<double>::infinity();
+      I IX[2] = { I(-10.,10.), I(-10.,10.) }, IC[2] = { I(-INF,1.), I(-INF,0.) };
+      mc::Interval::Verified scope;
+      if( !HC4.contract( IX, IC ) )
+        std::cout << "infeasible box" << std::endl;
+      else
+        std::cout << "reduced box: " << IX[0] << " x " << IX[1] << std::endl;
+\endcode
+
+The function <tt>contract</tt> returns false when the box is proven not to contain any feasible point, in which case the content of <tt>IX</tt> is undefined. The number of constraint revisions performed in the last call is returned by <tt>HC4.nrev()</tt>.
+
+
+\section sec_FFCONTRACTOR_opt How are the options set for the propagation?
+
+The class mc::FFContractor has a public member called mc::FFContractor::options that can be used to set/modify the options; e.g.,
+
+\code
+      HC4.options.QUEUE = mc::FFContractor<I>::Options::LIFO;
+      HC4.options.RTOL = 1e-2;
+\endcode
+
+The available options are the following:
+
+<TABLE border="1">
+<CAPTION><EM>Options in mc::FFContractor::Options: name, type and description</EM></CAPTION>
+     <TR><TH><b>Name</b>  <TD><b>Type</b><TD><b>Default</b>
+         <TD><b>Description</b>
+     <TR><TH><tt>QUEUE</tt> <TD><tt>mc::FFContractor::Options::POLICY</tt> <TD>mc::FFContractor::Options::FIFO
+         <TD>Policy of the propagation queue: the constraint revised next is either the one queued first (FIFO) or the one queued last (LIFO). A constraint already in the queue is not queued again.
+     <TR><TH><tt>RTOL</tt> <TD><tt>double</tt> <TD>0.1
+         <TD>Relative improvement cutoff: the constraints depending on a variable are queued again only if the revision of another constraint reduces the width of the range of that variable by more than this fraction. Larger values terminate the propagation sooner with a looser box.
+     <TR><TH><tt>MAXREV</tt> <TD><tt>unsigned int</tt> <TD>10
+         <TD>Maximal number of revisions per constraint in a call to <tt>contract</tt>, on average over the constraints. A value of 0 sets no limit.
+</TABLE>
+
+
+\section sec_FFCONTRACTOR_err What errors can I encounter when using mc::FFContractor?
+
+The errors are those of mc::FFGraph (see \ref sec_FFUNC_err), when the constraints or the variables are not recorded in the graph, and the exceptions of the interval type <tt>T</tt>, which may be thrown during the first forward pass when the range of a variable is outside the domain of a function.
+
+
+\section sec_FFCONTRACTOR_refs References
+
+- Benhamou, F., F. Goualard, L. Granvilliers, and J.-F. Puget, Revising hull and box consistency, <I>Proceedings of the International Conference on Logic Programming</I>, 230-244, 1999.
+- Schichl, H., and A. Neumaier, <A href="http://dx.doi.org/10.1007/s10898-005-0937-x">Interval analysis on directed acyclic graphs for global optimization</A>, <I>Journal of Global Optimization</I>, <b>33</b>(4):541-562, 2005.
+.
+
+*/
+
+#ifndef MC__FFCONTRACTOR_HPP
+#define MC__FFCONTRACTOR_HPP
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <limits>
+#include <cmath>
+#include "mcfunc.hpp"
+#include "mcop.hpp"
+#include "ffunc.hpp"
+
+namespace mc
+{
+
+//! @brief C++ class reducing boxes by forward-backward constraint propagation on factorable functions recorded in mc::FFGraph
+////////////////////////////////////////////////////////////////////////
+//! mc::FFContractor is a C++ class reducing a box subject to bounds on
+//! factorable functions recorded in a graph of type mc::FFGraph, using
+//! forward-backward constraint propagation in the interval arithmetic
+//! <tt>T</tt> scheduled with a worklist (HC4).
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class FFContractor
+////////////////////////////////////////////////////////////////////////
+{
+public:
+
+  typedef FFGraph::Exceptions Exceptions;
+
+  //! @brief Options of mc::FFContractor
+  struct Options
+  {
+    //! @brief Constructor of mc::FFContractor::Options
+    Options():
+      QUEUE(FIFO), RTOL(1e-1), MAXREV(10)
+      {}
+    //! @brief Propagation queue policy
+    enum POLICY{
+      FIFO=0,	//!< Revise the constraint queued first
+      LIFO	//!< Revise the constraint queued last
+    };
+    //! @brief Propagation queue policy - See \ref sec_FFCONTRACTOR_opt
+    POLICY QUEUE;
+    //! @brief Relative improvement cutoff for queuing constraints again - See \ref sec_FFCONTRACTOR_opt
+    double RTOL;
+    //! @brief Maximal number of revisions per constraint - See \ref sec_FFCONTRACTOR_opt
+    unsigned int MAXREV;
+  } options;
+
+  //! @brief Constructor for the <a>nctr</a> constraint functions <a>ctr</a> in graph <a>dag</a> of the <a>nvar</a> variables <a>var</a>
+  FFContractor
+    ( const FFGraph&dag, const unsigned int nctr, const FFVar*ctr,
+      const unsigned int nvar, const FFVar*var );
+
+  //! @brief Reduce the box <a>X</a> subject to the constraint functions being in the ranges <a>C</a>, returning false if the box is infeasible
+  bool contract
+    ( T*X, const T*C );
+
+  //! @brief Number of constraints
+  unsigned int nctr() const
+    { return _ctr.size(); }
+
+  //! @brief Number of variables
+  unsigned int nvar() const
+    { return _prog.nvar(); }
+
+  //! @brief Number of constraint revisions in the last call to <tt>contract</tt>
+  unsigned int nrev() const
+    { return _nrev; }
+
+private:
+
+  typedef FFProgram::t_instr t_instr;
+
+  //! @brief Program evaluating all the constraint functions
+  FFProgram _prog;
+  //! @brief Indices of the instructions of each constraint function, in a topological order
+  std::vector< std::vector<unsigned int> > _ctr;
+  //! @brief Variables of each constraint function
+  std::vector< std::vector<unsigned int> > _ctrvar;
+  //! @brief Constraint functions depending on each variable
+  std::vector< std::vector<unsigned int> > _varctr;
+  //! @brief Ranges of the variables and subexpressions, by slot of the program
+  std::vector<T> _v;
+  //! @brief Widths of the variable ranges before a revision
+  std::vector<double> _w;
+  //! @brief Number of constraint revisions in the last call to <tt>contract</tt>
+  unsigned int _nrev;
+
+  //! @brief Revise constraint <a>j</a> with range <a>C</a>, returning false if infeasible
+  bool _revise
+    ( const unsigned int j, const T&C );
+
+  //! @brief Project the range of the result of instruction <a>in</a> onto its operands, returning false if infeasible
+  bool _project
+    ( const t_instr&in );
+
+  //! @brief Intersect <a>X</a> with <a>Y</a>, returning false if empty
+  static bool _inter
+    ( T&X, const T&Y )
+    { T XIY( X ); if( !Op<T>::inter( XIY, X, Y ) ) return false; X = XIY; return true; }
+
+  //! @brief Intersect <a>X</a> with the hull of its intersections with <a>Y</a> and <a>-Y</a>, returning false if empty
+  static bool _inter_sym
+    ( T&X, const T&Y );
+
+  //! @brief Whether both bounds of <a>X</a> are finite
+  static bool _bounded
+    ( const T&X )
+    { return std::fabs( Op<T>::l(X) ) <= DBL_MAX && std::fabs( Op<T>::u(X) ) <= DBL_MAX; }
+
+  //! @brief Whether <a>X</a> is bounded and does not contain zero
+  static bool _invertible
+    ( const T&X )
+    { return _bounded( X ) && ( Op<T>::l(X) > 0. || Op<T>::u(X) < 0. ); }
+
+  //! @brief Range of the <a>n</a>th root of the nonnegative range <a>Z</a>, widened by a few units of machine precision
+  static T _root
+    ( const T&Z, const int n );
+
+  //! @brief Infinity
+  static double _inf()
+    { return std::numeric_limits<double>::infinity(); }
+};
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T> inline
+FFContractor<T>::FFContractor
+( const FFGraph&dag, const unsigned int nctr, const FFVar*ctr,
+  const unsigned int nvar, const FFVar*var ):
+  _ctr( nctr ), _ctrvar( nctr ), _varctr( nvar ), _w( nvar ), _nrev( 0 )
+{
+  // The ranges of all the subexpressions are kept between revisions, each one in its own slot
+  _prog.options.REUSE_SLOTS = false;
+  _prog.compile( dag, nctr, ctr, nvar, var );
+
+  // Instructions and variables that each constraint depends on, marked in the reverse topological order
+  const std::vector<t_instr>& instr = _prog._instr;
+  std::vector<bool> used( _prog.nslot() );
+  for( unsigned int j=0; j<nctr; j++ ){
+    std::fill( used.begin(), used.end(), false );
+    used[_prog._dep[j]] = true;
+    for( unsigned int k=instr.size(); k>0; k-- ){
+      const t_instr& in = instr[k-1];
+      if( !used[in.res] ) continue;
+      _ctr[j].push_back( k-1 );
+      const unsigned int narg = FFGraph::narg( in.op );
+      if( narg > 0 ) used[in.a1] = true;
+      if( narg > 1 ) used[in.a2] = true;
+    }
+    std::reverse( _ctr[j].begin(), _ctr[j].end() );
+    for( unsigned int i=0; i<nvar; i++ ){
+      if( !used[i] ) continue;
+      _ctrvar[j].push_back( i );
+      _varctr[i].push_back( j );
+    }
+  }
+}
+
+template <typename T> inline bool
+FFContractor<T>::contract
+( T*X, const T*C )
+{
+  // Forward pass through all the constraints for the initial ranges of the subexpressions
+  _nrev = 0;
+  if( _v.size() < _prog.nslot() ) _v.resize( _prog.nslot(), T(0.) );
+  for( unsigned int i=0; i<_prog.nvar(); i++ )
+    _v[i] = X[i];
+  for( unsigned int k=0; k<_prog._instr.size(); k++ )
+    FFProgram::_eval( _prog._instr[k], &_v[0] );
+
+  // All the constraints are queued at first
+  const unsigned int nctr = _ctr.size();
+  std::deque<unsigned int> queue;
+  std::vector<bool> queued( nctr, true );
+  for( unsigned int j=0; j<nctr; j++ ) queue.push_back( j );
+
+  while( !queue.empty() ){
+    if( options.MAXREV && _nrev >= options.MAXREV*nctr ) break;
+    unsigned int j;
+    if( options.QUEUE == Options::LIFO ){ j = queue.back(); queue.pop_back(); }
+    else{ j = queue.front(); queue.pop_front(); }
+    queued[j] = false;
+
+    for( unsigned int k=0; k<_ctrvar[j].size(); k++ ){
+      const unsigned int i = _ctrvar[j][k];
+      _w[i] = Op<T>::u(_v[i]) - Op<T>::l(_v[i]);
+    }
+    _nrev++;
+    if( !_revise( j, C[j] ) ) return false;
+
+    // Constraints queued again for the variables whose width is reduced by more than RTOL
+    for( unsigned int k=0; k<_ctrvar[j].size(); k++ ){
+      const unsigned int i = _ctrvar[j][k];
+      const double w = Op<T>::u(_v[i]) - Op<T>::l(_v[i]);
+      if( !( w < _w[i] ) ) continue;
+      if( _w[i] <= DBL_MAX && _w[i]-w <= options.RTOL*_w[i] ) continue;
+      for( unsigned int l=0; l<_varctr[i].size(); l++ ){
+        const unsigned int jl = _varctr[i][l];
+        if( jl == j || queued[jl] ) continue;
+        queue.push_back( jl );
+        queued[jl] = true;
+      }
+    }
+  }
+
+  for( unsigned int i=0; i<_prog.nvar(); i++ )
+    X[i] = _v[i];
+  return true;
+}
+
+template <typename T> inline bool
+FFContractor<T>::_revise
+( const unsigned int j, const T&C )
+{
+  const std::vector<t_instr>& instr = _prog._instr;
+  const std::vector<unsigned int>& ctr = _ctr[j];
+  T* v = &_v[0];
+
+  // Forward pass, keeping the reductions of the previous revisions
+  for( unsigned int k=0; k<ctr.size(); k++ ){
+    const t_instr& in = instr[ctr[k]];
+    const T R( v[in.res] );
+    FFProgram::_eval( in, v );
+    if( !_inter( v[in.res], R ) ) return false;
+  }
+
+  // Range of the constraint function
+  if( !_inter( v[_prog._dep[j]], C ) ) return false;
+
+  // Backward pass
+  for( unsigned int k=ctr.size(); k>0; k-- )
+    if( !_project( instr[ctr[k-1]] ) ) return false;
+  return true;
+}
+
+template <typename T> inline bool
+FFContractor<T>::_inter_sym
+( T&X, const T&Y )
+{
+  T XP, XN;
+  const bool bP = Op<T>::inter( XP, X, Y ), bN = Op<T>::inter( XN, X, -Y );
+  if( !bP && !bN ) return false;
+  X = bP && bN? Op<T>::hull( XP, XN ): ( bP? XP: XN );
+  return true;
+}
+
+template <typename T> inline T
+FFContractor<T>::_root
+( const T&Z, const int n )
+{
+  const double tol = 1e3*machprec();
+  const double l = std::pow( Op<T>::l(Z), 1./n ), u = std::pow( Op<T>::u(Z), 1./n );
+  return T( l*(1.-tol), u <= DBL_MAX? u*(1.+tol): u );
+}
+
+template <typename T> inline bool
+FFContractor<T>::_project
+( const t_instr&in )
+{
+  T* v = &_v[0];
+  T& Z = v[in.res];
+  T& X = v[in.a1];
+  const double INF = _inf();
+  switch( in.op ){
+  case FFGraph::ADD:
+    return _inter( X, Z - v[in.a2] ) && _inter( v[in.a2], Z - X );
+  case FFGraph::SUB:
+    return _inter( X, Z + v[in.a2] ) && _inter( v[in.a2], X - Z );
+  case FFGraph::MUL:
+    if( _bounded( Z ) && _invertible( v[in.a2] ) && !_inter( X, Z / v[in.a2] ) ) return false;
+    if( _bounded( Z ) && _invertible( X ) && !_inter( v[in.a2], Z / X ) ) return false;
+    return true;
+  case FFGraph::DIV:
+    if( _bounded( Z ) && _bounded( v[in.a2] ) && !_inter( X, Z * v[in.a2] ) ) return false;
+    if( _invertible( Z ) && _bounded( X ) && !_inter( v[in.a2], X / Z ) ) return false;
+    return true;
+  case FFGraph::ADDC:
+    return _inter( X, Z - in.c );
+  case FFGraph::CSUB:
+    return _inter( X, in.c - Z );
+  case FFGraph::MULC:
+    return in.c == 0. || _inter( X, Z / in.c );
+  case FFGraph::DIVC:
+    return in.c == 0. || _inter( X, Z * in.c );
+  case FFGraph::CDIV:
+    return !_invertible( Z ) || _inter( X, in.c / Z );
+  case FFGraph::NEG:
+    return _inter( X, -Z );
+  case FFGraph::SQR:
+    if( !_inter( Z, T( 0., INF ) ) ) return false;
+    return _inter_sym( X, Op<T>::sqrt( Z ) );
+  case FFGraph::SQRT:
+    if( !_inter( Z, T( 0., INF ) ) ) return false;
+    return _inter( X, Op<T>::sqr( Z ) );
+  case FFGraph::FABS:
+    if( !_inter( Z, T( 0., INF ) ) ) return false;
+    return _inter_sym( X, Z );
+  case FFGraph::EXP:
+    // The exponential of a large negative number may underflow to zero
+    if( Op<T>::u(Z) < 0. ) return false;
+    if( Op<T>::u(Z) == 0. ) return true;
+    return _inter( X, T( Op<T>::l(Z) > 0.? Op<T>::l( Op<T>::log( T( Op<T>::l(Z) ) ) ): -INF,
+                         Op<T>::u(Z) <= DBL_MAX? Op<T>::u( Op<T>::log( T( Op<T>::u(Z) ) ) ): INF ) );
+  case FFGraph::LOG:
+    return _inter( X, Op<T>::exp( Z ) );
+  case FFGraph::POWI:{
+    const int n = (int)in.c;
+    if( n <= 0 ) return true;
+    if( n%2 == 0 ){
+      if( !_inter( Z, T( 0., INF ) ) ) return false;
+      return _inter_sym( X, _root( Z, n ) );
+    }
+    // Odd powers are monotonic, with the root of each sign computed separately
+    const double l = Op<T>::l(Z), u = Op<T>::u(Z);
+    const T RN = _root( T( u < 0.? -u: 0., l < 0.? -l: 0. ), n ), RP = _root( T( l > 0.? l: 0., u > 0.? u: 0. ), n );
+    return _inter( X, T( l < 0.? -Op<T>::u(RN): Op<T>::l(RP), u > 0.? Op<T>::u(RP): -Op<T>::l(RN) ) );
+  }
+  case FFGraph::ASIN:
+    return _inter( X, Op<T>::sin( Z ) );
+  case FFGraph::ACOS:
+    return _inter( X, Op<T>::cos( Z ) );
+  case FFGraph::MIN:
+    return _inter( X, T( Op<T>::l(Z), INF ) ) && _inter( v[in.a2], T( Op<T>::l(Z), INF ) );
+  case FFGraph::MAX:
+    return _inter( X, T( -INF, Op<T>::u(Z) ) ) && _inter( v[in.a2], T( -INF, Op<T>::u(Z) ) );
+  default:
+    // No projection for the other operations
+    return true;
+  }
+}
+
+} // namespace mc
+
+#endif
@@ -0,0 +1,1355 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_FFUNC Recording and Replaying Factorable Functions with mc::FFGraph
+\author Beno&icirc;t Chachuat
+
+The arithmetics in MC++, such as mc::Interval, mc::McCormick, mc::TVar or mc::Specbnd, compute bounds or relaxations of a factorable function by executing the C++ code of that function with overloaded operators. Each execution goes through the user code again, and each elementary operation creates temporary objects, whose memory is allocated and freed in turn. In a branch-and-bound algorithm, where the same function is bounded on many boxes and often in several arithmetics, this overhead is paid at every node even though the structure of the function never changes.
+
+The class mc::FFGraph records the elementary operations of a factorable function once, as a directed acyclic graph (DAG) whose nodes are stored in the order in which they are created, hence in a topological order. The variables of the function are of type mc::FFVar, a lightweight handle holding a pointer to the graph and the index of a node; a variable not attached to any graph is a passive real constant, and operations between passive constants are computed directly. The class mc::FFProgram then compiles the part of the graph needed by a selection of dependent variables into a flat array of instructions, each one reading its operands from, and writing its result to, a preallocated array of value slots. Evaluating a program in any arithmetic <tt>U</tt> is a single loop over these instructions, where the elementary operations are applied through the structure mc::Op<U>; the slots are kept in a workspace provided by the caller, so that repeated evaluations do not allocate any memory for the slots after the first one.
+
+
+\section sec_FFUNC_use How do I record a factorable function and evaluate it in several arithmetics?
+
+Suppose we want to compute interval bounds and McCormick relaxations of the function
+\f[
+  f(x,y) = x\,\exp(x+y^2)-y^2
+\f]
+on many boxes. The function is best written as a template, so that it can be called with any type of variable:
+
+\code
+      #include "interval.hpp"
+      #include "mccormick.hpp"
+      #include "ffunc.hpp"
+      typedef mc::Interval I;
+      typedef mc::McCormick<I> MC;
+
+      struct myfct{ template <typename U> U operator()( const U&x, const U&y ) const
+        { return x*exp(x+sqr(y))-sqr(y); } };
+\endcode
+
+The function is recorded once, by calling it with independent variables of type mc::FFVar created in a graph of type mc::FFGraph, and then compiled into a program of type mc::FFProgram for the chosen dependent and independent variables:
+
+\code
+      mc::FFGraph DAG;
+      mc::FFVar X[2] = { DAG.var(), DAG.var() };
+      mc::FFVar F = myfct()( X[0], X[1] );
+      mc::FFProgram prog( DAG, 1, &F, 2, X );
+\endcode
+
+The program is then evaluated in interval arithmetic, or in any other arithmetic, for the values of the independent variables in the same order as in the compilation:
+
+\code
+      std::vector<I> wkI;
+      I IX[2] = { I(1.,2.), I(0.,1.) }, IF;
+      prog.eval( IX, &IF, wkI );
+      std::cout << "F bounds: " << IF << std::endl;
+
+      std::vector<MC> wkMC;
+      MC MCX[2] = { MC( IX[0], 1.5 ).sub( 2, 0 ), MC( IX[1], 0.5 ).sub( 2, 1 ) }, MCF;
+      prog.eval( MCX, &MCF, wkMC );
+      std::cout << "F relaxations: " << MCF << std::endl;
+\endcode
+
+The workspaces <tt>wkI</tt> and <tt>wkMC</tt> are resized to the number of slots of the program on their first use only, and should therefore be kept between evaluations. A version of <tt>eval</tt> without a workspace argument is also available, which allocates a temporary one at each call. The program may be evaluated in real arithmetic too, through the specialization of mc::Op for <tt>double</tt> in this header file.
+
+
+\section sec_FFUNC_slots How is the memory of the value slots managed?
+
+By default, a program of type mc::FFProgram does not keep one value slot for each intermediate of the function. When the program is compiled, the live range of every value is determined, from the instruction that computes it to the last instruction that reads it, and the values are assigned to slots by a linear scan over the instructions: a slot is released after the last instruction reading it, and reused for the next value computed, including the result of that same instruction. The number of slots, returned by <tt>nslot()</tt>, is then the maximal number of values live at the same time, which is often much smaller than the number of intermediates. This matters for the arithmetics whose values hold large buffers, such as mc::TVar with its polynomial coefficients or mc::McCormick with its subgradients: the assignment of a result to a slot reuses the buffer of the value that was previously held in that slot, and the workspace remains small enough to stay in cache.
+
+The reuse of the slots can be disabled by setting the option <tt>REUSE_SLOTS</tt> in the public member mc::FFProgram::options to false before compiling the program, in which case each value has its own slot for the whole evaluation:
+
+\code
+      mc::FFProgram prog;
+      prog.options.REUSE_SLOTS = false;
+      prog.compile( DAG, 1, &F, 2, X );
+\endcode
+
+
+\section sec_FFUNC_par How do I evaluate a program in parallel?
+
+The instructions of a program that do not depend on each other can be executed concurrently. This is worthwhile for wide graphs, such as the constraints of a process model sharing a few variables, or the terms of a large sum, and for the arithmetics in which each operation is expensive enough to outweigh the synchronization of the threads, such as mc::McCormick with many subgradient components or mc::Specbnd. When the option <tt>LEVEL_SCHEDULE</tt> is set before compiling the program, each instruction is assigned a level, one more than the highest level of its operands with the independent variables at level 0, and the instructions are sorted by level:
+
+\code
+      mc::FFProgram prog;
+      prog.options.LEVEL_SCHEDULE = true;
+      prog.compile( DAG, NF, F, NX, X );
+      std::cout << prog.nlevel() << " levels for " << prog.size() << " instructions" << std::endl;
+\endcode
+
+If MC++ is compiled with OpenMP support (e.g. <tt>-fopenmp</tt>, as set by the variable <tt>OPENMP</tt> in <tt>makeoptions.mk</tt>), the function <tt>eval</tt> then executes the levels one after the other, and shares the instructions of each level between <tt>NTHREADS</tt> threads by dynamic scheduling, with a value of 0 selecting the OpenMP default. The levels with fewer instructions than <tt>MINWIDTH</tt> are executed by a single thread. Otherwise, or if <tt>NTHREADS</tt> is 1, a level-scheduled program is evaluated sequentially like any other program. Each instruction computes its result from the same operands with the same operations as in the sequential evaluation, so the results are bit-for-bit identical whatever the number of threads. The reuse of the value slots, see \ref sec_FFUNC_slots, accounts for the levels, a slot released within a level only being reused in the next levels. Because the values computed in a level are all live at the same time, the number of slots is larger than for a sequential program, often by an order of magnitude for wide graphs, and the level scheduling should therefore not be used with a single thread.
+
+The temporaries of an operation are on the stack of the thread executing it, and the static scratch variables of mc::Interval and mc::McCormick are thread-local (see <tt>MC__THREAD_LOCAL</tt> in <tt>mcfunc.hpp</tt>), so these arithmetics can be evaluated in parallel, as can mc::Affine, whose noise symbols are numbered by a counter shared by all the threads. mc::Specbnd has no such variables, and can be evaluated in parallel if its underlying arithmetic can. This is not the case of mc::TVar and mc::CVar, whose operations use the work arrays of the shared mc::TModel and mc::CModel. The programs in these arithmetics, and in mc::McCormick or mc::Specbnd built upon them, are always evaluated sequentially, as given by the traits structure mc::FFThreadSafe; this structure may be specialized to false for the other arithmetics that are not safe in parallel, such as FADBAD++ types built upon mc::TVar. Since the rounding mode is set per thread too, a program is also evaluated sequentially within a verified scope of mc::Interval, see \ref sec_INTERVAL_verif. Finally, when an exception is thrown in one of the threads, the program is evaluated again sequentially, so that the exception is thrown in the calling thread.
+
+
+\section sec_FFUNC_opt How are common subexpressions and constants handled in mc::FFGraph?
+
+The same subexpression often appears several times in a model, either within a function, such as <tt>sqr(y)</tt> in the function above, or across several functions, such as an Arrhenius term in the rate expressions of a reaction network. mc::FFGraph merges these repeated subexpressions by hash-consing: before a new node is recorded, the graph looks up a node with the same opcode, operands and constant, and returns a handle to that node if it exists. The operands of the commutative operations (sum, product, minimum and maximum) are sorted first, so that <tt>x*y</tt> and <tt>y*x</tt> are recorded as the same node. Because the merging is applied to the operands of a node before the node itself, identical subtrees of any depth end up as a single node, which a program of type mc::FFProgram evaluates once per call and shares between all the dependents. Besides saving time, this can tighten the bounds or relaxations, e.g. McCormick relaxations of a shared factor are then computed once and used consistently in all the functions.
+
+Operations between passive constants are computed when they are recorded, and the operations whose result is known exactly without evaluating them are not recorded either: adding or subtracting zero, multiplying or dividing by one, multiplying by zero, the opposite of an opposite, the difference of a variable with itself, and the minimum or maximum of a variable with itself. Only folds that are exact in real arithmetic are applied, so the functions recorded in a graph are unchanged.
+
+The class mc::FFGraph has a public member called mc::FFGraph::options that can be used to turn these simplifications off, e.g. for debugging or to compare with the operator overloading approach:
+
+\code
+      DAG.options.CSE = false;
+      DAG.options.FOLD = false;
+\endcode
+
+These options apply to the nodes recorded after they are set. The available options are the following:
+
+<TABLE border="1">
+<CAPTION><EM>Options in mc::FFGraph::Options: name, type and description</EM></CAPTION>
+     <TR><TH><b>Name</b>  <TD><b>Type</b><TD><b>Default</b>
+         <TD><b>Description</b>
+     <TR><TH><tt>CSE</tt> <TD><tt>bool</tt> <TD>true
+         <TD>Whether to merge the common subexpressions by hash-consing and ordering the operands of commutative operations.
+     <TR><TH><tt>FOLD</tt> <TD><tt>bool</tt> <TD>true
+         <TD>Whether to fold the operations with a known result, such as the sum with zero or the product with one.
+</TABLE>
+
+
+\section sec_FFUNC_err What errors can I encounter when using mc::FFGraph?
+
+Errors are managed based on the exception handling mechanism of the C++ language. Each time an error is encountered, a class object of type mc::FFGraph::Exceptions is thrown, which contains the type of error. Possible errors are:
+
+<TABLE border="1">
+<CAPTION><EM>Errors during Recording and Evaluation with mc::FFGraph</EM></CAPTION>
+     <TR><TH><b>Number</b> <TD><b>Description</b>
+     <TR><TH><tt>-1</tt> <TD>Operation between variables recorded in different graphs
+     <TR><TH><tt>-2</tt> <TD>Variable not recorded in the graph, or independent variable missing from the compilation of a program
+     <TR><TH><tt>-3</tt> <TD>Missing argument array
+     <TR><TH><tt>-33</tt> <TD>Feature not yet implemented in mc::FFGraph
+</TABLE>
+
+Moreover, exceptions of the arithmetic <tt>U</tt> may be thrown during the evaluation of a program, e.g. when the range of a variable is outside the domain of a function, or when an operation is not implemented in that arithmetic.
+
+
+\section sec_FFUNC_refs References
+
+- Griewank, A., and A. Walther, <I><A href="http://dx.doi.org/10.1137/1.9780898717761">Evaluating Derivatives: Principles and Techniques of Algorithmic Differentiation</A></I>, 2nd Edition, SIAM, 2008.
+- Schichl, H., and A. Neumaier, <A href="http://dx.doi.org/10.1007/s10898-005-0937-x">Interval analysis on directed acyclic graphs for global optimization</A>, <I>Journal of Global Optimization</I>, <b>33</b>(4):541-562, 2005.
+.
+
+*/
+
+#ifndef MC__FFUNC_HPP
+#define MC__FFUNC_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <map>
+#include <cstring>
+#include <cmath>
+#include "mcfunc.hpp"
+#include "mcop.hpp"
+#ifdef _OPENMP
+  #include <omp.h>
+  #include <fenv.h>
+#endif
+
+namespace mc
+{
+
+class FFVar;
+class FFProgram;
+template <typename T> class FFContractor;
+class FFCodeGen;
+template <typename T> class McCormick;
+template <typename T> class TVar;
+template <typename T> class CVar;
+template <typename T> class Specbnd;
+
+//! @brief Traits structure indicating whether a program may be evaluated in arithmetic <tt>U</tt> by several threads at once - See \ref sec_FFUNC_par
+template <typename U> struct FFThreadSafe
+{ static const bool value = true; };
+//! @brief Taylor models share the work arrays of their mc::TModel environment
+template <typename T> struct FFThreadSafe< TVar<T> >
+{ static const bool value = false; };
+//! @brief Chebyshev models share the work arrays of their mc::CModel environment
+template <typename T> struct FFThreadSafe< CVar<T> >
+{ static const bool value = false; };
+//! @brief McCormick relaxations are safe in parallel if their underlying arithmetic is
+template <typename T> struct FFThreadSafe< McCormick<T> >
+{ static const bool value = FFThreadSafe<T>::value; };
+//! @brief Spectral bounds are safe in parallel if their underlying arithmetic is
+template <typename T> struct FFThreadSafe< Specbnd<T> >
+{ static const bool value = FFThreadSafe<T>::value; };
+
+//! @brief C++ class recording factorable functions as a directed acyclic graph
+////////////////////////////////////////////////////////////////////////
+//! mc::FFGraph is a C++ class recording the elementary operations of
+//! factorable functions as the nodes of a directed acyclic graph,
+//! stored in a topological order, for later compilation and evaluation
+//! in any arithmetic with mc::FFProgram.
+////////////////////////////////////////////////////////////////////////
+class FFGraph
+////////////////////////////////////////////////////////////////////////
+{
+  friend class FFVar;
+  friend class FFProgram;
+
+public:
+
+  //! @brief Exceptions of mc::FFGraph
+  class Exceptions
+  {
+  public:
+    //! @brief Enumeration type for FFGraph exception handling
+    enum TYPE{
+      DAG=-1,	//!< Operation between variables recorded in different graphs
+      INDEX=-2,	//!< Variable not recorded in the graph, or independent variable missing from the compilation of a program
+      SIZE=-3,	//!< Missing argument array
+      UNDEF=-33 //!< Feature not yet implemented in mc::FFGraph
+    };
+    //! @brief Constructor for error <a>ierr</a>
+    Exceptions( TYPE ierr ) : _ierr( ierr ){}
+    //! @brief Inline function returning the error flag
+    int ierr(){ return _ierr; }
+    //! @brief Error description
+    std::string what(){
+      switch( _ierr ){
+      case DAG:
+        return "mc::FFGraph\t Operation between variables recorded in different graphs";
+      case INDEX:
+        return "mc::FFGraph\t Variable not recorded in the graph, or independent variable missing from the compilation of a program";
+      case SIZE:
+        return "mc::FFGraph\t Missing argument array";
+      case UNDEF:
+        return "mc::FFGraph\t Feature not yet implemented in mc::FFGraph class";
+      default:
+        return "mc::FFGraph\t Undocumented error";
+      }
+    }
+
+  private:
+    TYPE _ierr;
+  };
+
+  //! @brief Enumeration type for the opcodes of the operations recorded in the graph
+  enum OPCODE{
+    VAR=0,	//!< Independent variable
+    CNST,	//!< Real constant
+    ADD,	//!< Sum of two variables
+    SUB,	//!< Difference of two variables
+    MUL,	//!< Product of two variables
+    DIV,	//!< Ratio of two variables
+    ADDC,	//!< Sum of a variable and a constant
+    CSUB,	//!< Difference of a constant and a variable
+    MULC,	//!< Product of a variable and a constant
+    DIVC,	//!< Ratio of a variable and a constant
+    CDIV,	//!< Ratio of a constant and a variable
+    NEG,	//!< Opposite of a variable
+    SQR,	//!< Square of a variable
+    SQRT,	//!< Square root of a variable
+    EXP,	//!< Exponential of a variable
+    LOG,	//!< Natural logarithm of a variable
+    XLOG,	//!< Variable times its natural logarithm
+    FABS,	//!< Absolute value of a variable
+    POWI,	//!< Integer power of a variable, with the exponent as constant
+    SIN,	//!< Sine of a variable
+    COS,	//!< Cosine of a variable
+    TAN,	//!< Tangent of a variable
+    ASIN,	//!< Arcsine of a variable
+    ACOS,	//!< Arccosine of a variable
+    ATAN,	//!< Arctangent of a variable
+    ERF,	//!< Error function of a variable
+    ERFC,	//!< Complementary error function of a variable
+    ARH,	//!< Arrhenius term of a variable, with the activation constant as constant
+    MIN,	//!< Minimum of two variables
+    MAX		//!< Maximum of two variables
+  };
+
+  //! @brief Options of mc::FFGraph
+  struct Options
+  {
+    //! @brief Constructor of mc::FFGraph::Options
+    Options():
+      CSE(true), FOLD(true)
+      {}
+    //! @brief Whether to merge common subexpressions - See \ref sec_FFUNC_opt
+    bool CSE;
+    //! @brief Whether to fold operations with a known result - See \ref sec_FFUNC_opt
+    bool FOLD;
+  } options;
+
+  //! @brief Default constructor
+  FFGraph():
+    _nvar(0)
+    {}
+
+  //! @brief Record a new independent variable
+  FFVar var();
+
+  //! @brief Number of independent variables in the graph
+  unsigned int nvar() const
+    { return _nvar; }
+
+  //! @brief Number of nodes in the graph, including the independent variables
+  unsigned int size() const
+    { return _node.size(); }
+
+  //! @brief Clear the graph (the variables previously recorded become invalid)
+  void clear()
+    { _node.clear(); _cse.clear(); _nvar = 0; }
+
+  //! @brief Number of operands of a node with opcode <a>op</a>
+  static unsigned int narg
+    ( const OPCODE op )
+    {
+      switch( op ){
+      case VAR: case CNST:
+        return 0;
+      case ADD: case SUB: case MUL: case DIV: case MIN: case MAX:
+        return 2;
+      default:
+        return 1;
+      }
+    }
+
+private:
+
+  //! @brief Structure storing the opcode, operands and real constant of a node
+  struct t_node{
+    OPCODE op;
+    unsigned int a1;
+    unsigned int a2;
+    double c;
+  };
+
+  //! @brief Strict ordering of the nodes by opcode, operands and bit pattern of the constant, for hash-consing
+  struct lt_node{
+    bool operator()
+      ( const t_node&N1, const t_node&N2 ) const
+      {
+        if( N1.op != N2.op ) return N1.op < N2.op;
+        if( N1.a1 != N2.a1 ) return N1.a1 < N2.a1;
+        if( N1.a2 != N2.a2 ) return N1.a2 < N2.a2;
+        return std::memcmp( &N1.c, &N2.c, sizeof(double) ) < 0;
+      }
+  };
+
+  //! @brief Nodes recorded in the graph, in a topological order
+  std::vector<t_node> _node;
+  //! @brief Index of the nodes recorded in the graph other than independent variables, for hash-consing
+  std::map<t_node,unsigned int,lt_node> _cse;
+  //! @brief Number of independent variables in the graph
+  unsigned int _nvar;
+
+  //! @brief Fold the operation with opcode <a>op</a>, operands <a>a1</a> and <a>a2</a> and constant <a>c</a> if its result is known, returning true in that case with the result in <a>X</a>
+  bool _fold
+    ( const OPCODE op, const unsigned int a1, const unsigned int a2,
+      const double c, FFVar&X );
+
+  //! @brief Record a new node with opcode <a>op</a>, operands <a>a1</a> and <a>a2</a> and constant <a>c</a>
+  FFVar _record
+    ( const OPCODE op, const unsigned int a1=0, const unsigned int a2=0,
+      const double c=0. );
+
+  //! @brief Private copy constructor (the variables recorded in a graph hold pointers to it)
+  FFGraph
+    ( const FFGraph& );
+  //! @brief Private assignment operator
+  FFGraph& operator=
+    ( const FFGraph& );
+};
+
+//! @brief C++ class for variables recorded in a graph of type mc::FFGraph
+////////////////////////////////////////////////////////////////////////
+//! mc::FFVar is a C++ class for the variables of a factorable function
+//! recorded in a graph of type mc::FFGraph. A variable not attached to
+//! any graph is a passive real constant.
+////////////////////////////////////////////////////////////////////////
+class FFVar
+////////////////////////////////////////////////////////////////////////
+{
+  friend class FFGraph;
+  friend class FFProgram;
+
+  friend FFVar operator-
+    ( const FFVar& );
+  friend FFVar operator+
+    ( const FFVar&, const FFVar& );
+  friend FFVar operator+
+    ( const double, const FFVar& );
+  friend FFVar operator-
+    ( const FFVar&, const FFVar& );
+  friend FFVar operator-
+    ( const double, const FFVar& );
+  friend FFVar operator*
+    ( const FFVar&, const FFVar& );
+  friend FFVar operator*
+    ( const double, const FFVar& );
+  friend FFVar operator/
+    ( const FFVar&, const FFVar& );
+  friend FFVar operator/
+    ( const FFVar&, const double );
+  friend FFVar operator/
+    ( const double, const FFVar& );
+  friend FFVar sqr
+    ( const FFVar& );
+  friend FFVar sqrt
+    ( const FFVar& );
+  friend FFVar exp
+    ( const FFVar& );
+  friend FFVar log
+    ( const FFVar& );
+  friend FFVar xlog
+    ( const FFVar& );
+  friend FFVar fabs
+    ( const FFVar& );
+  friend FFVar pow
+    ( const FFVar&, const int );
+  friend FFVar sin
+    ( const FFVar& );
+  friend FFVar cos
+    ( const FFVar& );
+  friend FFVar tan
+    ( const FFVar& );
+  friend FFVar asin
+    ( const FFVar& );
+  friend FFVar acos
+    ( const FFVar& );
+  friend FFVar atan
+    ( const FFVar& );
+  friend FFVar erf
+    ( const FFVar& );
+  friend FFVar erfc
+    ( const FFVar& );
+  friend FFVar arh
+    ( const FFVar&, const double );
+  friend FFVar min
+    ( const FFVar&, const FFVar& );
+  friend FFVar max
+    ( const FFVar&, const FFVar& );
+
+public:
+
+  typedef FFGraph::Exceptions Exceptions;
+  typedef FFGraph::OPCODE OPCODE;
+
+  //! @brief Constructor for passive real constant <a>c</a>
+  FFVar
+    ( const double c=0. ):
+    _dag(0), _ndx(0), _cst(c)
+    {}
+
+  //! @brief Graph in which the variable is recorded (NULL for a passive constant)
+  const FFGraph* dag() const
+    { return _dag; }
+
+  //! @brief Index of the node of the variable in its graph
+  unsigned int index() const
+    { return _ndx; }
+
+  //! @brief Value of a passive constant
+  double cst() const
+    { return _cst; }
+
+  FFVar& operator+=
+    ( const FFVar&X )
+    { return *this = *this + X; }
+  FFVar& operator-=
+    ( const FFVar&X )
+    { return *this = *this - X; }
+  FFVar& operator*=
+    ( const FFVar&X )
+    { return *this = *this * X; }
+  FFVar& operator/=
+    ( const FFVar&X )
+    { return *this = *this / X; }
+
+private:
+
+  //! @brief Constructor for node <a>ndx</a> in graph <a>dag</a>
+  FFVar
+    ( FFGraph*dag, const unsigned int ndx ):
+    _dag(dag), _ndx(ndx), _cst(0.)
+    {}
+
+  //! @brief Pointer to the graph (NULL for a passive constant)
+  FFGraph* _dag;
+  //! @brief Index of the node in the graph
+  unsigned int _ndx;
+  //! @brief Value of a passive constant
+  double _cst;
+
+  //! @brief Record a new node in graph <a>dag</a> (see mc::FFGraph::_record)
+  static FFVar _record
+    ( FFGraph*dag, const OPCODE op, const unsigned int a1,
+      const unsigned int a2=0, const double c=0. )
+    { return dag->_record( op, a1, a2, c ); }
+
+  //! @brief Common graph of the variables <a>X1</a> and <a>X2</a>
+  static FFGraph* _dag_check
+    ( const FFVar&X1, const FFVar&X2 )
+    {
+      if( X1._dag != X2._dag ) throw Exceptions( FFGraph::Exceptions::DAG );
+      return X1._dag;
+    }
+
+  //! @brief Node of the variable <a>X</a> in graph <a>dag</a>, recording a constant node for a passive constant
+  static unsigned int _node
+    ( FFGraph*dag, const FFVar&X )
+    {
+      if( !X._dag ) return dag->_record( FFGraph::CNST, 0, 0, X._cst )._ndx;
+      if( X._dag != dag ) throw Exceptions( FFGraph::Exceptions::DAG );
+      return X._ndx;
+    }
+};
+
+//! @brief C++ class for the evaluation of a factorable function recorded in mc::FFGraph in any arithmetic
+////////////////////////////////////////////////////////////////////////
+//! mc::FFProgram is a C++ class compiling the nodes of a graph of type
+//! mc::FFGraph that a selection of dependent variables depends on into
+//! a flat array of instructions on preallocated value slots, for their
+//! evaluation in any arithmetic supported by mc::Op.
+////////////////////////////////////////////////////////////////////////
+class FFProgram
+////////////////////////////////////////////////////////////////////////
+{
+  template <typename T> friend class FFContractor;
+  friend class FFCodeGen;
+
+public:
+
+  typedef FFGraph::Exceptions Exceptions;
+  typedef FFGraph::OPCODE OPCODE;
+
+  //! @brief Options of mc::FFProgram
+  struct Options
+  {
+    //! @brief Constructor of mc::FFProgram::Options
+    Options():
+      REUSE_SLOTS(true), LEVEL_SCHEDULE(false), NTHREADS(0), MINWIDTH(64)
+      {}
+    //! @brief Whether to reuse the value slots of the intermediates past their last use - See \ref sec_FFUNC_slots
+    bool REUSE_SLOTS;
+    //! @brief Whether to order the instructions by level, for their parallel evaluation - See \ref sec_FFUNC_par
+    bool LEVEL_SCHEDULE;
+    //! @brief Number of threads for the evaluation of a level-scheduled program, with 0 for the OpenMP default - See \ref sec_FFUNC_par
+    unsigned int NTHREADS;
+    //! @brief Minimal number of instructions in a level for its instructions to be shared between the threads - See \ref sec_FFUNC_par
+    unsigned int MINWIDTH;
+  } options;
+
+  //! @brief Default constructor, for an empty program
+  FFProgram():
+    _nvar(0), _nslot(0)
+    {}
+
+  //! @brief Constructor compiling the <a>ndep</a> dependents <a>dep</a> in graph <a>dag</a> as functions of the <a>nvar</a> independents <a>var</a>
+  FFProgram
+    ( const FFGraph&dag, const unsigned int ndep, const FFVar*dep,
+      const unsigned int nvar, const FFVar*var ):
+    _nvar(0), _nslot(0)
+    { compile( dag, ndep, dep, nvar, var ); }
+
+  //! @brief Compile the <a>ndep</a> dependents <a>dep</a> in graph <a>dag</a> as functions of the <a>nvar</a> independents <a>var</a>
+  void compile
+    ( const FFGraph&dag, const unsigned int ndep, const FFVar*dep,
+      const unsigned int nvar, const FFVar*var );
+
+  //! @brief Evaluate the dependents <a>vdep</a> for the independents <a>vvar</a> in arithmetic <tt>U</tt>, with the value slots in workspace <a>work</a>
+  template <typename U> void eval
+    ( const U*vvar, U*vdep, std::vector<U>&work ) const;
+
+  //! @brief Evaluate the dependents <a>vdep</a> for the independents <a>vvar</a> in arithmetic <tt>U</tt>, with a temporary workspace
+  template <typename U> void eval
+    ( const U*vvar, U*vdep ) const
+    { std::vector<U> work; eval( vvar, vdep, work ); }
+
+  //! @brief Number of independent variables
+  unsigned int nvar() const
+    { return _nvar; }
+
+  //! @brief Number of dependent variables
+  unsigned int ndep() const
+    { return _dep.size(); }
+
+  //! @brief Number of instructions
+  unsigned int size() const
+    { return _instr.size(); }
+
+  //! @brief Number of value slots, including those of the independent variables
+  unsigned int nslot() const
+    { return _nslot; }
+
+  //! @brief Number of levels of a level-scheduled program, 0 otherwise
+  unsigned int nlevel() const
+    { return _level.empty()? 0: _level.size()-1; }
+
+private:
+
+  //! @brief Structure storing the opcode, result and operand slots, and real constant of an instruction
+  struct t_instr{
+    OPCODE op;
+    unsigned int res;
+    unsigned int a1;
+    unsigned int a2;
+    double c;
+  };
+
+  //! @brief Instructions, in a topological order
+  std::vector<t_instr> _instr;
+  //! @brief Slots of the dependent variables
+  std::vector<unsigned int> _dep;
+  //! @brief Number of independent variables, whose values are in the first slots
+  unsigned int _nvar;
+  //! @brief Number of value slots
+  unsigned int _nslot;
+  //! @brief Offsets of the levels in the instructions of a level-scheduled program, empty otherwise
+  std::vector<unsigned int> _level;
+
+  //! @brief Order the instructions by level, with the independent variables at level 0
+  void _schedule();
+
+  //! @brief Assign the values to a minimal set of slots, based on the live range of each value
+  void _plan();
+
+  //! @brief Execute instruction <a>in</a> on the value slots <a>v</a> in arithmetic <tt>U</tt>
+  template <typename U> static void _eval
+    ( const t_instr&in, U*v );
+
+#ifdef _OPENMP
+  //! @brief Execute the levels in parallel on the value slots <a>v</a> for the independents <a>vvar</a>, and return false if the evaluation is to be repeated sequentially
+  template <typename U> bool _eval_levels
+    ( const U*vvar, U*v ) const;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline FFVar
+FFGraph::_record
+( const OPCODE op, const unsigned int a1, const unsigned int a2,
+  const double c )
+{
+  FFVar X;
+  if( options.FOLD && _fold( op, a1, a2, c, X ) ) return X;
+
+  t_node node;
+  node.op = op; node.a1 = a1; node.a2 = a2; node.c = c;
+  if( options.CSE && op != VAR ){
+    switch( op ){
+    case ADD: case MUL: case MIN: case MAX:
+      if( a1 > a2 ){ node.a1 = a2; node.a2 = a1; }
+      break;
+    default:
+      break;
+    }
+    std::pair<std::map<t_node,unsigned int,lt_node>::iterator,bool> ins
+      = _cse.insert( std::make_pair( node, (unsigned int)_node.size() ) );
+    if( !ins.second ) return FFVar( this, ins.first->second );
+  }
+  _node.push_back( node );
+  return FFVar( this, _node.size()-1 );
+}
+
+inline bool
+FFGraph::_fold
+( const OPCODE op, const unsigned int a1, const unsigned int a2,
+  const double c, FFVar&X )
+{
+  switch( op ){
+  case ADDC: case SUB:
+    if( op == ADDC && c == 0. ){ X = FFVar( this, a1 ); return true; }
+    if( op == SUB && a1 == a2 ){ X = 0.; return true; }
+    return false;
+  case CSUB:
+    if( c == 0. ){ X = _record( NEG, a1 ); return true; }
+    return false;
+  case MULC:
+    if( c == 0. ){ X = 0.; return true; }
+    // no break
+  case DIVC:
+    if( c == 1. ){ X = FFVar( this, a1 ); return true; }
+    if( c == -1. ){ X = _record( NEG, a1 ); return true; }
+    return false;
+  case NEG:
+    if( _node[a1].op == NEG ){ X = FFVar( this, _node[a1].a1 ); return true; }
+    return false;
+  case MIN: case MAX:
+    if( a1 == a2 ){ X = FFVar( this, a1 ); return true; }
+    return false;
+  default:
+    return false;
+  }
+}
+
+inline FFVar
+FFGraph::var()
+{
+  _nvar++;
+  return _record( VAR );
+}
+
+////////////////////////////////////////////////////////////////////////
+
+inline void
+FFProgram::compile
+( const FFGraph&dag, const unsigned int ndep, const FFVar*dep,
+  const unsigned int nvar, const FFVar*var )
+{
+  const unsigned int nnode = dag._node.size(), NONE = nnode+nvar+ndep;
+  std::vector<unsigned int> slot( nnode, NONE );
+  for( unsigned int i=0; i<nvar; i++ ){
+    if( var[i]._dag != &dag || var[i]._ndx >= nnode || dag._node[var[i]._ndx].op != FFGraph::VAR )
+      throw Exceptions( Exceptions::INDEX );
+    slot[var[i]._ndx] = i;
+  }
+
+  // Mark the nodes that the dependents depend on, in the reverse topological order
+  std::vector<bool> used( nnode, false );
+  for( unsigned int j=0; j<ndep; j++ ){
+    if( !dep[j]._dag ) continue;
+    if( dep[j]._dag != &dag || dep[j]._ndx >= nnode )
+      throw Exceptions( Exceptions::INDEX );
+    used[dep[j]._ndx] = true;
+  }
+  for( unsigned int i=nnode; i>0; i-- ){
+    if( !used[i-1] ) continue;
+    const FFGraph::t_node& node = dag._node[i-1];
+    if( node.op == FFGraph::VAR && slot[i-1] == NONE )
+      throw Exceptions( Exceptions::INDEX );
+    const unsigned int narg = FFGraph::narg( node.op );
+    if( narg > 0 ) used[node.a1] = true;
+    if( narg > 1 ) used[node.a2] = true;
+  }
+
+  // One instruction and one slot for each marked node, after the slots of the independents
+  _nvar = _nslot = nvar;
+  _instr.clear();
+  for( unsigned int i=0; i<nnode; i++ ){
+    const FFGraph::t_node& node = dag._node[i];
+    if( !used[i] || node.op == FFGraph::VAR ) continue;
+    const unsigned int narg = FFGraph::narg( node.op );
+    t_instr in;
+    in.op = node.op; in.res = _nslot; in.c = node.c;
+    in.a1 = narg > 0? slot[node.a1]: 0;
+    in.a2 = narg > 1? slot[node.a2]: 0;
+    _instr.push_back( in );
+    slot[i] = _nslot++;
+  }
+
+  // Passive constants among the dependents are set by a constant instruction
+  _dep.resize( ndep );
+  for( unsigned int j=0; j<ndep; j++ ){
+    if( dep[j]._dag ){ _dep[j] = slot[dep[j]._ndx]; continue; }
+    t_instr in;
+    in.op = FFGraph::CNST; in.res = _nslot; in.a1 = in.a2 = 0; in.c = dep[j]._cst;
+    _instr.push_back( in );
+    _dep[j] = _nslot++;
+  }
+
+  _level.clear();
+  if( options.LEVEL_SCHEDULE ) _schedule();
+  if( options.REUSE_SLOTS ) _plan();
+}
+
+inline void
+FFProgram::_schedule()
+{
+  // Level of each slot, one more than the highest level of the operands
+  const unsigned int ninstr = _instr.size();
+  std::vector<unsigned int> lev( _nslot, 0 ), cnt( 1, 0 );
+  for( unsigned int k=0; k<ninstr; k++ ){
+    const t_instr& in = _instr[k];
+    const unsigned int narg = FFGraph::narg( in.op );
+    unsigned int l = 1;
+    if( narg > 0 && lev[in.a1] >= l ) l = lev[in.a1]+1;
+    if( narg > 1 && lev[in.a2] >= l ) l = lev[in.a2]+1;
+    lev[in.res] = l;
+    if( cnt.size() <= l ) cnt.resize( l+1, 0 );
+    cnt[l]++;
+  }
+
+  // Stable counting sort of the instructions by level
+  _level.assign( cnt.size(), 0 );
+  for( unsigned int l=1; l<cnt.size(); l++ )
+    _level[l] = _level[l-1] + cnt[l];
+  std::vector<unsigned int> pos( _level.begin(), _level.end()-1 );
+  std::vector<t_instr> instr( ninstr );
+  for( unsigned int k=0; k<ninstr; k++ )
+    instr[pos[lev[_instr[k].res]-1]++] = _instr[k];
+  _instr.swap( instr );
+}
+
+inline void
+FFProgram::_plan()
+{
+  // Last instruction reading each slot, past the end for the dependents and NONE for the unread slots
+  const unsigned int ninstr = _instr.size(), NONE = ninstr+1;
+  std::vector<unsigned int> last( _nslot, NONE );
+  for( unsigned int k=0; k<ninstr; k++ ){
+    const t_instr& in = _instr[k];
+    const unsigned int narg = FFGraph::narg( in.op );
+    if( narg > 0 ) last[in.a1] = k;
+    if( narg > 1 ) last[in.a2] = k;
+  }
+  for( unsigned int j=0; j<_dep.size(); j++ )
+    last[_dep[j]] = ninstr;
+
+  // Linear scan in the order of the instructions, with the slots released by the operands
+  // at their last use available to the result of the same instruction; in a level-scheduled
+  // program, these slots are only available past the end of the level, so that the
+  // instructions of a level never write to a slot that another one reads
+  std::vector<unsigned int> slot( _nslot ), avail, pend;
+  std::vector<unsigned int>& rel = _level.empty()? avail: pend;
+  for( unsigned int i=0; i<_nvar; i++ ){
+    slot[i] = i;
+    if( last[i] == NONE ) avail.push_back( i );
+  }
+  _nslot = _nvar;
+  for( unsigned int k=0, l=1; k<ninstr; k++ ){
+    t_instr& in = _instr[k];
+    const unsigned int narg = FFGraph::narg( in.op ), a1 = in.a1, a2 = in.a2, res = in.res;
+    if( narg > 0 ){
+      in.a1 = slot[a1];
+      if( last[a1] == k ) rel.push_back( slot[a1] );
+    }
+    if( narg > 1 ){
+      in.a2 = slot[a2];
+      if( last[a2] == k && a2 != a1 ) rel.push_back( slot[a2] );
+    }
+    if( avail.empty() ) slot[res] = _nslot++;
+    else{ slot[res] = avail.back(); avail.pop_back(); }
+    in.res = slot[res];
+    if( _level.empty() || k+1 < _level[l] ) continue;
+    avail.insert( avail.end(), pend.begin(), pend.end() );
+    pend.clear();
+    l++;
+  }
+  for( unsigned int j=0; j<_dep.size(); j++ )
+    _dep[j] = slot[_dep[j]];
+}
+
+template <typename U> inline void
+FFProgram::eval
+( const U*vvar, U*vdep, std::vector<U>&work ) const
+{
+  if( !_nslot ) return;
+  if( work.size() < _nslot ) work.resize( _nslot, U(0.) );
+  U* v = &work[0];
+#ifdef _OPENMP
+  if( _level.empty() || !_eval_levels( vvar, v ) )
+#endif
+  {
+    for( unsigned int i=0; i<_nvar; i++ )
+      v[i] = vvar[i];
+    typename std::vector<t_instr>::const_iterator it = _instr.begin();
+    for( ; it != _instr.end(); ++it )
+      _eval( *it, v );
+  }
+  for( unsigned int j=0; j<_dep.size(); j++ )
+    vdep[j] = v[_dep[j]];
+}
+
+#ifdef _OPENMP
+template <typename U> inline bool
+FFProgram::_eval_levels
+( const U*vvar, U*v ) const
+{
+  // Neither the rounding mode nor a verified scope of mc::Interval carry over to the
+  // other threads, so that the evaluation remains in the calling thread unless the
+  // rounding is to nearest
+#ifdef MC__SINGLE_THREAD
+  // The static work variables of the arithmetics are shared by all the threads
+  return false;
+#endif
+  if( !FFThreadSafe<U>::value ) return false;
+  const int nthreads = options.NTHREADS? options.NTHREADS: omp_get_max_threads();
+  if( nthreads < 2 || fegetround() != FE_TONEAREST ) return false;
+
+  for( unsigned int i=0; i<_nvar; i++ )
+    v[i] = vvar[i];
+  const unsigned int nlevel = _level.size()-1, minwidth = options.MINWIDTH;
+  // Flag shared by the threads, only accessed atomically within the parallel region
+  int fail = 0;
+  #pragma omp parallel num_threads(nthreads)
+  {
+    for( unsigned int l=0; l<nlevel; ){
+      // Consecutive narrow levels are executed by a single thread
+      const bool wide = _level[l+1]-_level[l] >= minwidth;
+      unsigned int l1 = l+1;
+      if( !wide )
+        while( l1 < nlevel && _level[l1+1]-_level[l1] < minwidth ) l1++;
+      const long k0 = _level[l], k1 = _level[l1];
+      if( !wide ){
+        #pragma omp single
+        for( long k=k0; k<k1; k++ ){
+          int failed;
+          #pragma omp atomic read
+          failed = fail;
+          if( failed ) break;
+          try{ _eval( _instr[k], v ); }
+          catch(...){
+            #pragma omp atomic write
+            fail = 1;
+          }
+        }
+      }
+      else{
+        #pragma omp for schedule(dynamic,16)
+        for( long k=k0; k<k1; k++ ){
+          int failed;
+          #pragma omp atomic read
+          failed = fail;
+          if( failed ) continue;
+          try{ _eval( _instr[k], v ); }
+          catch(...){
+            #pragma omp atomic write
+            fail = 1;
+          }
+        }
+      }
+      l = l1;
+    }
+  }
+
+  // An exception in a thread is thrown again by the sequential evaluation
+  return !fail;
+}
+#endif
+
+template <typename U> inline void
+FFProgram::_eval
+( const t_instr&in, U*v )
+{
+  U& r = v[in.res];
+  switch( in.op ){
+  case FFGraph::VAR:
+    break;
+  case FFGraph::CNST:
+    r = U( in.c );
+    break;
+  case FFGraph::ADD:
+    r = v[in.a1] + v[in.a2];
+    break;
+  case FFGraph::SUB:
+    r = v[in.a1] - v[in.a2];
+    break;
+  case FFGraph::MUL:
+    r = v[in.a1] * v[in.a2];
+    break;
+  case FFGraph::DIV:
+    r = v[in.a1] / v[in.a2];
+    break;
+  case FFGraph::ADDC:
+    r = in.c + v[in.a1];
+    break;
+  case FFGraph::CSUB:
+    r = in.c - v[in.a1];
+    break;
+  case FFGraph::MULC:
+    r = in.c * v[in.a1];
+    break;
+  case FFGraph::DIVC:
+    r = v[in.a1] / in.c;
+    break;
+  case FFGraph::CDIV:
+    r = in.c / v[in.a1];
+    break;
+  case FFGraph::NEG:
+    r = -v[in.a1];
+    break;
+  case FFGraph::SQR:
+    r = Op<U>::sqr( v[in.a1] );
+    break;
+  case FFGraph::SQRT:
+    r = Op<U>::sqrt( v[in.a1] );
+    break;
+  case FFGraph::EXP:
+    r = Op<U>::exp( v[in.a1] );
+    break;
+  case FFGraph::LOG:
+    r = Op<U>::log( v[in.a1] );
+    break;
+  case FFGraph::XLOG:
+    r = Op<U>::xlog( v[in.a1] );
+    break;
+  case FFGraph::FABS:
+    r = Op<U>::fabs( v[in.a1] );
+    break;
+  case FFGraph::POWI:
+    r = Op<U>::pow( v[in.a1], (int)in.c );
+    break;
+  case FFGraph::SIN:
+    r = Op<U>::sin( v[in.a1] );
+    break;
+  case FFGraph::COS:
+    r = Op<U>::cos( v[in.a1] );
+    break;
+  case FFGraph::TAN:
+    r = Op<U>::tan( v[in.a1] );
+    break;
+  case FFGraph::ASIN:
+    r = Op<U>::asin( v[in.a1] );
+    break;
+  case FFGraph::ACOS:
+    r = Op<U>::acos( v[in.a1] );
+    break;
+  case FFGraph::ATAN:
+    r = Op<U>::atan( v[in.a1] );
+    break;
+  case FFGraph::ERF:
+    r = Op<U>::erf( v[in.a1] );
+    break;
+  case FFGraph::ERFC:
+    r = Op<U>::erfc( v[in.a1] );
+    break;
+  case FFGraph::ARH:
+    r = Op<U>::arh( v[in.a1], in.c );
+    break;
+  case FFGraph::MIN:
+    r = Op<U>::min( v[in.a1], v[in.a2] );
+    break;
+  case FFGraph::MAX:
+    r = Op<U>::max( v[in.a1], v[in.a2] );
+    break;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+
+inline FFVar
+operator+
+( const FFVar&X )
+{
+  return X;
+}
+
+inline FFVar
+operator-
+( const FFVar&X )
+{
+  if( !X._dag ) return -X._cst;
+  return FFVar::_record( X._dag, FFGraph::NEG, X._ndx );
+}
+
+inline FFVar
+operator+
+( const FFVar&X1, const FFVar&X2 )
+{
+  if( !X1._dag ) return X1._cst + X2;
+  if( !X2._dag ) return X2._cst + X1;
+  FFGraph* dag = FFVar::_dag_check( X1, X2 );
+  return FFVar::_record( dag, FFGraph::ADD, X1._ndx, X2._ndx );
+}
+
+inline FFVar
+operator+
+( const double c, const FFVar&X )
+{
+  if( !X._dag ) return c + X._cst;
+  return FFVar::_record( X._dag, FFGraph::ADDC, X._ndx, 0, c );
+}
+
+inline FFVar
+operator+
+( const FFVar&X, const double c )
+{
+  return c + X;
+}
+
+inline FFVar
+operator-
+( const FFVar&X1, const FFVar&X2 )
+{
+  if( !X1._dag ) return X1._cst - X2;
+  if( !X2._dag ) return X1 + (-X2._cst);
+  FFGraph* dag = FFVar::_dag_check( X1, X2 );
+  return FFVar::_record( dag, FFGraph::SUB, X1._ndx, X2._ndx );
+}
+
+inline FFVar
+operator-
+( const double c, const FFVar&X )
+{
+  if( !X._dag ) return c - X._cst;
+  return FFVar::_record( X._dag, FFGraph::CSUB, X._ndx, 0, c );
+}
+
+inline FFVar
+operator-
+( const FFVar&X, const double c )
+{
+  return (-c) + X;
+}
+
+inline FFVar
+operator*
+( const FFVar&X1, const FFVar&X2 )
+{
+  if( !X1._dag ) return X1._cst * X2;
+  if( !X2._dag ) return X2._cst * X1;
+  FFGraph* dag = FFVar::_dag_check( X1, X2 );
+  return FFVar::_record( dag, FFGraph::MUL, X1._ndx, X2._ndx );
+}
+
+inline FFVar
+operator*
+( const double c, const FFVar&X )
+{
+  if( !X._dag ) return c * X._cst;
+  return FFVar::_record( X._dag, FFGraph::MULC, X._ndx, 0, c );
+}
+
+inline FFVar
+operator*
+( const FFVar&X, const double c )
+{
+  return c * X;
+}
+
+inline FFVar
+operator/
+( const FFVar&X1, const FFVar&X2 )
+{
+  if( !X1._dag ) return X1._cst / X2;
+  if( !X2._dag ) return X1 / X2._cst;
+  FFGraph* dag = FFVar::_dag_check( X1, X2 );
+  return FFVar::_record( dag, FFGraph::DIV, X1._ndx, X2._ndx );
+}
+
+inline FFVar
+operator/
+( const FFVar&X, const double c )
+{
+  if( !X._dag ) return X._cst / c;
+  return FFVar::_record( X._dag, FFGraph::DIVC, X._ndx, 0, c );
+}
+
+inline FFVar
+operator/
+( const double c, const FFVar&X )
+{
+  if( !X._dag ) return c / X._cst;
+  return FFVar::_record( X._dag, FFGraph::CDIV, X._ndx, 0, c );
+}
+
+inline FFVar
+inv
+( const FFVar&X )
+{
+  return 1. / X;
+}
+
+inline FFVar
+sqr
+( const FFVar&X )
+{
+  if( !X._dag ) return X._cst * X._cst;
+  return FFVar::_record( X._dag, FFGraph::SQR, X._ndx );
+}
+
+inline FFVar
+sqrt
+( const FFVar&X )
+{
+  if( !X._dag ) return std::sqrt( X._cst );
+  return FFVar::_record( X._dag, FFGraph::SQRT, X._ndx );
+}
+
+inline FFVar
+exp
+( const FFVar&X )
+{
+  if( !X._dag ) return std::exp( X._cst );
+  return FFVar::_record( X._dag, FFGraph::EXP, X._ndx );
+}
+
+inline FFVar
+log
+( const FFVar&X )
+{
+  if( !X._dag ) return std::log( X._cst );
+  return FFVar::_record( X._dag, FFGraph::LOG, X._ndx );
+}
+
+inline FFVar
+xlog
+( const FFVar&X )
+{
+  if( !X._dag ) return mc::xlog( X._cst );
+  return FFVar::_record( X._dag, FFGraph::XLOG, X._ndx );
+}
+
+inline FFVar
+fabs
+( const FFVar&X )
+{
+  if( !X._dag ) return std::fabs( X._cst );
+  return FFVar::_record( X._dag, FFGraph::FABS, X._ndx );
+}
+
+inline FFVar
+pow
+( const FFVar&X, const int n )
+{
+  if( !X._dag ) return std::pow( X._cst, n );
+  if( n == 0 ) return 1.;
+  if( n == 1 ) return X;
+  if( n == 2 ) return sqr( X );
+  return FFVar::_record( X._dag, FFGraph::POWI, X._ndx, 0, n );
+}
+
+inline FFVar
+pow
+( const FFVar&X, const double a )
+{
+  return exp( a * log( X ) );
+}
+
+inline FFVar
+pow
+( const double a, const FFVar&X )
+{
+  return exp( std::log( a ) * X );
+}
+
+inline FFVar
+pow
+( const FFVar&X1, const FFVar&X2 )
+{
+  return exp( X2 * log( X1 ) );
+}
+
+inline FFVar
+sin
+( const FFVar&X )
+{
+  if( !X._dag ) return std::sin( X._cst );
+  return FFVar::_record( X._dag, FFGraph::SIN, X._ndx );
+}
+
+inline FFVar
+cos
+( const FFVar&X )
+{
+  if( !X._dag ) return std::cos( X._cst );
+  return FFVar::_record( X._dag, FFGraph::COS, X._ndx );
+}
+
+inline FFVar
+tan
+( const FFVar&X )
+{
+  if( !X._dag ) return std::tan( X._cst );
+  return FFVar::_record( X._dag, FFGraph::TAN, X._ndx );
+}
+
+inline FFVar
+asin
+( const FFVar&X )
+{
+  if( !X._dag ) return std::asin( X._cst );
+  return FFVar::_record( X._dag, FFGraph::ASIN, X._ndx );
+}
+
+inline FFVar
+acos
+( const FFVar&X )
+{
+  if( !X._dag ) return std::acos( X._cst );
+  return FFVar::_record( X._dag, FFGraph::ACOS, X._ndx );
+}
+
+inline FFVar
+atan
+( const FFVar&X )
+{
+  if( !X._dag ) return std::atan( X._cst );
+  return FFVar::_record( X._dag, FFGraph::ATAN, X._ndx );
+}
+
+inline FFVar
+erf
+( const FFVar&X )
+{
+  if( !X._dag ) return ::erf( X._cst );
+  return FFVar::_record( X._dag, FFGraph::ERF, X._ndx );
+}
+
+inline FFVar
+erfc
+( const FFVar&X )
+{
+  if( !X._dag ) return ::erfc( X._cst );
+  return FFVar::_record( X._dag, FFGraph::ERFC, X._ndx );
+}
+
+inline FFVar
+arh
+( const FFVar&X, const double k )
+{
+  if( !X._dag ) return mc::arh( X._cst, k );
+  return FFVar::_record( X._dag, FFGraph::ARH, X._ndx, 0, k );
+}
+
+inline FFVar
+min
+( const FFVar&X1, const FFVar&X2 )
+{
+  if( !X1._dag && !X2._dag ) return std::min( X1._cst, X2._cst );
+  FFGraph* dag = X1._dag? X1._dag: X2._dag;
+  const unsigned int a1 = FFVar::_node( dag, X1 ), a2 = FFVar::_node( dag, X2 );
+  return FFVar::_record( dag, FFGraph::MIN, a1, a2 );
+}
+
+inline FFVar
+max
+( const FFVar&X1, const FFVar&X2 )
+{
+  if( !X1._dag && !X2._dag ) return std::max( X1._cst, X2._cst );
+  FFGraph* dag = X1._dag? X1._dag: X2._dag;
+  const unsigned int a1 = FFVar::_node( dag, X1 ), a2 = FFVar::_node( dag, X2 );
+  return FFVar::_record( dag, FFGraph::MAX, a1, a2 );
+}
+
+////////////////////////////////////////////////////////////////////////
+
+//! @brief Specialization of the structure mc::Op for the evaluation of mc::FFProgram in real arithmetic
+template <> struct Op<double>
+{
+  typedef double T;
+  static T point( const double c ) { return c; }
+  static double l(const T& x) { return x; }
+  static double u(const T& x) { return x; }
+  static double abs (const T& x) { return std::fabs(x); }
+  static double mid (const T& x) { return x; }
+  static double diam(const T& x) { return 0.; }
+  static T inv (const T& x) { return 1./x; }
+  static T sqr (const T& x) { return x*x; }
+  static T sqrt(const T& x) { return std::sqrt(x); }
+  static T log (const T& x) { return std::log(x); }
+  static T xlog(const T& x) { return mc::xlog(x); }
+  static T fabs(const T& x) { return std::fabs(x); }
+  static T exp (const T& x) { return std::exp(x); }
+  static T sin (const T& x) { return std::sin(x); }
+  static T cos (const T& x) { return std::cos(x); }
+  static T tan (const T& x) { return std::tan(x); }
+  static T asin(const T& x) { return std::asin(x); }
+  static T acos(const T& x) { return std::acos(x); }
+  static T atan(const T& x) { return std::atan(x); }
+  static T erf (const T& x) { return ::erf(x); }
+  static T erfc(const T& x) { return ::erfc(x); }
+  static T min (const T& x, const T& y) { return std::min(x,y); }
+  static T max (const T& x, const T& y) { return std::max(x,y); }
+  static T arh (const T& x, const double k) { return mc::arh(x,k); }
+  template <typename X, typename Y> static T pow(const X& x, const Y& y) { return std::pow(x,y); }
+  static T monomial (const unsigned int n, const T* x, const int* k) { return mc::monomial(n,x,k); }
+  static bool eq(const T& x, const T& y) { return x==y; }
+  static bool ne(const T& x, const T& y) { return x!=y; }
+  static bool lt(const T& x, const T& y) { return x<y;  }
+  static bool le(const T& x, const T& y) { return x<=y; }
+  static bool gt(const T& x, const T& y) { return x>y;  }
+  static bool ge(const T& x, const T& y) { return x>=y; }
+};
+
+} // namespace mc
+
+#endif
@@ -0,0 +1,628 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_HESSPATTERN Hessian Sparsity Detection and Compression
+\author Beno&icirc;t Chachuat
+
+Computing an interval Hessian matrix with forward-forward or forward-reverse AD, as needed by mc::Specbnd::spectral_bound (see \ref page_SPECBND), costs a number of operations proportional to the number \f$n\f$ of independent variables (forward-reverse) or to \f$n^2\f$ (forward-forward) per elementary operation, even when the Hessian matrix is sparse. This cost can be reduced by seeding the inner AD layer with a compressed set of directions, one per color of a suitable coloring of the adjacency graph of the Hessian sparsity pattern [Gebremedhin <I>et al.</I>, 2005].
+
+The class mc::HessPattern propagates the sparsity patterns of the gradient and Hessian of a factorable function. Nonlinear interactions are detected as in [Walther, 2008]: linear operations merge the patterns of their operands; products add the cross terms between the gradient patterns of their operands; and nonlinear univariate terms add all the pairwise interactions in the gradient pattern of their operand. The resulting pattern is an overestimate of the actual sparsity pattern of the Hessian matrix.
+
+The class mc::HessColoring computes a star coloring of the adjacency graph of the Hessian sparsity pattern with a greedy heuristic, namely a coloring such that adjacent vertices get distinct colors and every path on four vertices uses at least three colors. Given the compressed Hessian matrix \f$B=HS\f$, with \f$S\f$ the seed matrix whose column \f$c\f$ is the sum of the unit vectors of the variables with color \f$c\f$, every nonzero entry of \f$H\f$ can then be recovered directly from an entry of \f$B\f$ by symmetry.
+
+
+\section sec_HESSPATTERN_use How do I compute a spectral bound from a compressed interval Hessian matrix?
+
+Consider the function \f$f(x)=\sum_{i=1}^{n-1}\exp(x_i x_{i+1})\f$ for \f$x\in [-1,1]^n\f$, whose Hessian matrix is tridiagonal. Its Hessian sparsity pattern is first detected and colored as follows:
+
+\code
+      #include "interval.hpp"
+      #include "mcfadbad.hpp"
+      #include "hesspattern.hpp"
+      typedef mc::Interval I;
+      typedef fadbad::F<I> FI;
+      typedef fadbad::B<FI> BFI;
+
+      const unsigned int NX = 500;
+      mc::HessPattern PX[NX], PF = 0.;
+      for( unsigned int i=0; i<NX; i++ ) PX[i].set( i, NX );
+      for( unsigned int i=0; i<NX-1; i++ ) PF += exp( PX[i]*PX[i+1] );
+      mc::HessColoring HC( PF );
+\endcode
+
+The number of colors is given by <tt>HC.ncolor()</tt>, here equal to 3. The compressed interval Hessian matrix is then computed with forward-reverse AD, by seeding the variable <tt>i</tt> in the inner forward layer with the direction <tt>HC.color(i)</tt> among <tt>HC.ncolor()</tt>:
+
+\code
+      BFI BFX[NX], BFF = 0.;
+      for( unsigned int i=0; i<NX; i++ ){
+        FI FXi = I(-1.,1.);
+        FXi.diff( HC.color(i), HC.ncolor() );
+        BFX[i] = FXi;
+      }
+      for( unsigned int i=0; i<NX-1; i++ ) BFF += exp( BFX[i]*BFX[i+1] );
+      BFF.diff( 0, 1 );
+      std::pair<double,double> spbnd = mc::Specbnd<I>::spectral_bound( BFX, HC );
+\endcode
+
+The same is possible with forward-forward AD, by seeding the variable <tt>i</tt> with the direction <tt>HC.color(i)</tt> among <tt>HC.ncolor()</tt> in the inner layer and with the direction <tt>i</tt> among <tt>NX</tt> in the outer layer. The options of mc::Specbnd::spectral_bound apply unchanged to a compressed Hessian matrix. With mc::Specbnd::Options::GERSHGORIN, only the nonzero entries of the Hessian matrix are visited.
+
+
+\section sec_HESSPATTERN_err What errors can I encounter during the detection of a Hessian sparsity pattern?
+
+Errors are managed based on the exception handling mechanism of the C++ language. Each time an error is encountered, a class object of type mc::HessPattern::Exceptions is thrown, which contains the type of error. Possible errors are:
+
+<TABLE border="1">
+<CAPTION><EM>Errors during the Detection of a Hessian Sparsity Pattern</EM></CAPTION>
+     <TR><TH><b>Number</b> <TD><b>Description</b>
+     <TR><TH><tt>-1</tt> <TD>Operation between variables with different numbers of dependents
+     <TR><TH><tt>-2</tt> <TD>Variable index out of range
+     <TR><TH><tt>-33</tt> <TD>Feature not yet implemented in mc::HessPattern
+</TABLE>
+
+
+\section sec_HESSPATTERN_refs References
+
+- Gebremedhin, A.H., Manne, F., and A. Pothen, <A href="http://dx.doi.org/10.1137/S0036144504444711">What color is your Jacobian? Graph coloring for computing derivatives</A>, <i>SIAM Review</i>, <b>47</b>(4):629-705, 2005.
+- Walther, A., <A href="http://dx.doi.org/10.1007/s10589-007-9127-4">Computing sparse Hessians with automatic differentiation</A>, <i>Computational Optimization and Applications</i>, <b>40</b>(3):445-459, 2008.
+.
+
+*/
+
+#ifndef MC__HESSPATTERN_HPP
+#define MC__HESSPATTERN_HPP
+
+#include <iostream>
+#include <string>
+#include <set>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace mc
+{
+//! @brief C++ class propagating the gradient and Hessian sparsity patterns of a factorable function
+////////////////////////////////////////////////////////////////////////
+//! mc::HessPattern is a C++ class propagating the sparsity patterns of
+//! the gradient and Hessian matrix of a factorable function, by
+//! detecting the nonlinear interactions between its independent
+//! variables.
+////////////////////////////////////////////////////////////////////////
+class HessPattern
+////////////////////////////////////////////////////////////////////////
+{
+  friend HessPattern operator+( const HessPattern&, const HessPattern& );
+  friend HessPattern operator*( const HessPattern&, const HessPattern& );
+  friend std::ostream& operator<<( std::ostream&, const HessPattern& );
+
+public:
+
+  //! @brief Type of a Hessian entry, with row index no greater than column index
+  typedef std::pair<unsigned int,unsigned int> t_entry;
+
+  //! @brief Exceptions of mc::HessPattern
+  class Exceptions
+  {
+  public:
+    //! @brief Enumeration type for HessPattern exception handling
+    enum TYPE{
+      SIZE=-1,	//!< Operation between variables with different numbers of dependents
+      INDEX=-2,	//!< Variable index out of range
+      UNDEF=-33 //!< Feature not yet implemented in mc::HessPattern
+    };
+    //! @brief Constructor for error <a>ierr</a>
+    Exceptions( TYPE ierr ) : _ierr( ierr ){}
+    //! @brief Inline function returning the error flag
+    int ierr(){ return _ierr; }
+    //! @brief Error description
+    std::string what(){
+      switch( _ierr ){
+      case SIZE:
+        return "mc::HessPattern\t Operation between variables with different numbers of dependents";
+      case INDEX:
+        return "mc::HessPattern\t Variable index out of range";
+      case UNDEF:
+        return "mc::HessPattern\t Feature not yet implemented in mc::HessPattern class";
+      default:
+        return "mc::HessPattern\t Undocumented error";
+      }
+    }
+
+  private:
+    TYPE _ierr;
+  };
+
+  //! @brief Default constructor (needed to declare arrays of HessPattern)
+  HessPattern():
+    _n(0)
+  {}
+
+  //! @brief Constructor for real scalar <tt>c</tt>
+  HessPattern( const double c ):
+    _n(0)
+  {}
+
+  //! @brief Constructor for a variable with index <a>i</a> of <a>n</a> independent variables
+  HessPattern( const unsigned int i, const unsigned int n ):
+    _n(0)
+  {
+    set( i, n );
+  }
+
+  //! @brief Destructor
+  ~HessPattern()
+  {}
+
+  //! @brief Set variable with index <a>i</a> of <a>n</a> independent variables
+  HessPattern& set( const unsigned int i, const unsigned int n )
+  {
+    if( i >= n ) throw Exceptions( Exceptions::INDEX );
+    _n = n;
+    _grad.clear(); _grad.insert( i );
+    _hess.clear();
+    return *this;
+  }
+
+  //! @brief Return number of independent variables
+  unsigned int dep() const
+  {
+    return _n;
+  }
+
+  //! @brief Return gradient sparsity pattern
+  const std::set<unsigned int>& grad() const
+  {
+    return _grad;
+  }
+
+  //! @brief Return Hessian sparsity pattern (upper triangular part, including diagonal)
+  const std::set<t_entry>& hess() const
+  {
+    return _hess;
+  }
+
+  HessPattern& operator=
+    ( const double c )
+    { _n = 0; _grad.clear(); _hess.clear(); return *this; }
+  HessPattern& operator+=
+    ( const HessPattern&y )
+    { _merge( y ); return *this; }
+  HessPattern& operator+=
+    ( const double c )
+    { return *this; }
+  HessPattern& operator-=
+    ( const HessPattern&y )
+    { _merge( y ); return *this; }
+  HessPattern& operator-=
+    ( const double c )
+    { return *this; }
+  HessPattern& operator*=
+    ( const HessPattern&y );
+  HessPattern& operator*=
+    ( const double c )
+    { return *this; }
+  HessPattern& operator/=
+    ( const HessPattern&y );
+  HessPattern& operator/=
+    ( const double c )
+    { return *this; }
+
+  //! @brief Pattern of a nonlinear univariate term in <tt>x</tt>
+  static HessPattern nonlinear
+    ( const HessPattern&x )
+    { HessPattern z( x ); z._cross( x._grad, x._grad ); return z; }
+
+private:
+
+  //! @brief Number of independent variables
+  unsigned int _n;
+  //! @brief Gradient sparsity pattern
+  std::set<unsigned int> _grad;
+  //! @brief Hessian sparsity pattern (upper triangular part)
+  std::set<t_entry> _hess;
+
+  //! @brief Merge the gradient and Hessian patterns of <tt>y</tt> into the current pattern
+  void _merge
+    ( const HessPattern&y )
+    {
+      if( _n && y._n && _n != y._n ) throw Exceptions( Exceptions::SIZE );
+      if( !_n ) _n = y._n;
+      _grad.insert( y._grad.begin(), y._grad.end() );
+      _hess.insert( y._hess.begin(), y._hess.end() );
+    }
+
+  //! @brief Add the interactions between the variables in <tt>gx</tt> and <tt>gy</tt> to the Hessian pattern
+  void _cross
+    ( const std::set<unsigned int>&gx, const std::set<unsigned int>&gy )
+    {
+      std::set<unsigned int>::const_iterator ix = gx.begin();
+      for( ; ix != gx.end(); ++ix ){
+        std::set<unsigned int>::const_iterator iy = gy.begin();
+        for( ; iy != gy.end(); ++iy )
+          _hess.insert( *ix<*iy? t_entry(*ix,*iy): t_entry(*iy,*ix) );
+      }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline std::ostream&
+operator<<
+( std::ostream&out, const HessPattern&x )
+{
+  out << "  gradient: {";
+  std::set<unsigned int>::const_iterator ig = x._grad.begin();
+  for( ; ig != x._grad.end(); ++ig ) out << " " << *ig;
+  out << " }" << std::endl << "  Hessian:  {";
+  std::set<HessPattern::t_entry>::const_iterator ih = x._hess.begin();
+  for( ; ih != x._hess.end(); ++ih ) out << " (" << ih->first << "," << ih->second << ")";
+  out << " }" << std::endl;
+  return out;
+}
+
+inline HessPattern
+operator+
+( const HessPattern&x )
+{
+  return x;
+}
+
+inline HessPattern
+operator+
+( const HessPattern&x, const HessPattern&y )
+{
+  HessPattern z( x );
+  z._merge( y );
+  return z;
+}
+
+inline HessPattern
+operator+
+( const HessPattern&x, const double c )
+{
+  return x;
+}
+
+inline HessPattern
+operator+
+( const double c, const HessPattern&x )
+{
+  return x;
+}
+
+inline HessPattern
+operator-
+( const HessPattern&x )
+{
+  return x;
+}
+
+inline HessPattern
+operator-
+( const HessPattern&x, const HessPattern&y )
+{
+  return x + y;
+}
+
+inline HessPattern
+operator-
+( const HessPattern&x, const double c )
+{
+  return x;
+}
+
+inline HessPattern
+operator-
+( const double c, const HessPattern&x )
+{
+  return x;
+}
+
+inline HessPattern
+operator*
+( const HessPattern&x, const HessPattern&y )
+{
+  HessPattern z( x );
+  z._merge( y );
+  z._cross( x._grad, y._grad );
+  return z;
+}
+
+inline HessPattern
+operator*
+( const HessPattern&x, const double c )
+{
+  return x;
+}
+
+inline HessPattern
+operator*
+( const double c, const HessPattern&x )
+{
+  return x;
+}
+
+inline HessPattern
+inv
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+operator/
+( const HessPattern&x, const HessPattern&y )
+{
+  return x * inv( y );
+}
+
+inline HessPattern
+operator/
+( const HessPattern&x, const double c )
+{
+  return x;
+}
+
+inline HessPattern
+operator/
+( const double c, const HessPattern&x )
+{
+  return inv( x );
+}
+
+inline HessPattern&
+HessPattern::operator*=
+( const HessPattern&y )
+{
+  *this = *this * y;
+  return *this;
+}
+
+inline HessPattern&
+HessPattern::operator/=
+( const HessPattern&y )
+{
+  *this = *this * inv( y );
+  return *this;
+}
+
+inline HessPattern
+sqr
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+pow
+( const HessPattern&x, const int m )
+{
+  if( m == 0 ) return HessPattern( 0. );
+  if( m == 1 ) return x;
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+pow
+( const HessPattern&x, const double c )
+{
+  if( c == 0. ) return HessPattern( 0. );
+  if( c == 1. ) return x;
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+pow
+( const HessPattern&x, const HessPattern&y )
+{
+  return HessPattern::nonlinear( x + y );
+}
+
+inline HessPattern
+pow
+( const double c, const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+sqrt
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+exp
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+log
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+xlog
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+cos
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+sin
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+tan
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+acos
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+asin
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+inline HessPattern
+atan
+( const HessPattern&x )
+{
+  return HessPattern::nonlinear( x );
+}
+
+//! @brief C++ class computing a star coloring of the adjacency graph of a Hessian sparsity pattern
+////////////////////////////////////////////////////////////////////////
+//! mc::HessColoring is a C++ class computing a star coloring of the
+//! adjacency graph of a Hessian sparsity pattern given by
+//! mc::HessPattern, along with the locations of the nonzero Hessian
+//! entries in the corresponding compressed Hessian matrix.
+////////////////////////////////////////////////////////////////////////
+class HessColoring
+////////////////////////////////////////////////////////////////////////
+{
+public:
+
+  //! @brief Type of a Hessian entry, with row index no greater than column index
+  typedef HessPattern::t_entry t_entry;
+
+  //! @brief Constructor of a star coloring for the Hessian sparsity pattern of <tt>P</tt>
+  HessColoring
+    ( const HessPattern&P )
+    { _color_star( P.dep(), P.hess() ); }
+
+  //! @brief Destructor
+  ~HessColoring()
+    {}
+
+  //! @brief Number of independent variables
+  unsigned int n() const
+    { return _color.size(); }
+  //! @brief Number of colors
+  unsigned int ncolor() const
+    { return _ncolor; }
+  //! @brief Color of variable <tt>i</tt>
+  unsigned int color
+    ( const unsigned int i ) const
+    { return _color[i]; }
+  //! @brief Number of nonzero entries in upper triangular part of Hessian matrix
+  unsigned int nnz() const
+    { return _entry.size(); }
+  //! @brief Row and column indices of <tt>k</tt>th nonzero entry in upper triangular part of Hessian matrix
+  const t_entry& entry
+    ( const unsigned int k ) const
+    { return _entry[k]; }
+  //! @brief Row and color indices in the compressed Hessian matrix holding the <tt>k</tt>th nonzero entry
+  const std::pair<unsigned int,unsigned int>& source
+    ( const unsigned int k ) const
+    { return _source[k]; }
+
+private:
+
+  //! @brief Colors of the independent variables
+  std::vector<unsigned int> _color;
+  //! @brief Number of colors
+  unsigned int _ncolor;
+  //! @brief Nonzero entries in upper triangular part of Hessian matrix
+  std::vector<t_entry> _entry;
+  //! @brief Locations of the nonzero entries in the compressed Hessian matrix
+  std::vector< std::pair<unsigned int,unsigned int> > _source;
+
+  //! @brief Greedy star coloring of the adjacency graph of the Hessian pattern <tt>hess</tt> in <tt>n</tt> variables
+  void _color_star
+    ( const unsigned int n, const std::set<t_entry>&hess );
+};
+
+inline void
+HessColoring::_color_star
+( const unsigned int n, const std::set<t_entry>&hess )
+{
+  // Adjacency lists of the off-diagonal pattern
+  std::vector< std::vector<unsigned int> > adj( n );
+  std::set<t_entry>::const_iterator it = hess.begin();
+  for( ; it != hess.end(); ++it ){
+    if( it->first == it->second ) continue;
+    adj[it->first].push_back( it->second );
+    adj[it->second].push_back( it->first );
+  }
+
+  // Greedy coloring: the color of vertex v must differ from the colors of
+  // its neighbors, and must not create a two-colored path on four vertices
+  // with the vertices already colored, with v either at an end (v-w-x-y)
+  // or inside (u-v-w-x)
+  const unsigned int NOCOLOR = n;
+  _color.assign( n, NOCOLOR );
+  _ncolor = 0;
+  std::vector<unsigned int> forbid( n+1, NOCOLOR ), nbcol( n+1, 0 );
+  for( unsigned int v=0; v<n; v++ ){
+    for( unsigned int k=0; k<adj[v].size(); k++ ){
+      const unsigned int cw = _color[adj[v][k]];
+      if( cw == NOCOLOR ) continue;
+      forbid[cw] = v;
+      nbcol[cw]++;
+    }
+    for( unsigned int k=0; k<adj[v].size(); k++ ){
+      const unsigned int w = adj[v][k], cw = _color[w];
+      if( cw == NOCOLOR ) continue;
+      for( unsigned int l=0; l<adj[w].size(); l++ ){
+        const unsigned int x = adj[w][l], cx = _color[x];
+        if( x == v || cx == NOCOLOR || forbid[cx] == v ) continue;
+        if( nbcol[cw] > 1 ){ forbid[cx] = v; continue; }
+        for( unsigned int m=0; m<adj[x].size(); m++ ){
+          const unsigned int y = adj[x][m];
+          if( y != w && _color[y] == cw ){ forbid[cx] = v; break; }
+        }
+      }
+    }
+    unsigned int cv = 0;
+    while( forbid[cv] == v ) cv++;
+    _color[v] = cv;
+    if( cv >= _ncolor ) _ncolor = cv+1;
+    for( unsigned int k=0; k<adj[v].size(); k++ ){
+      const unsigned int cw = _color[adj[v][k]];
+      if( cw != NOCOLOR ) nbcol[cw] = 0;
+    }
+  }
+
+  // Direct recovery: entry (i,j) is read from row i of the compressed
+  // column of color(j) unless another neighbor of i shares that color, in
+  // which case the star property guarantees that row j of the compressed
+  // column of color(i) can be used instead
+  _entry.assign( hess.begin(), hess.end() );
+  _source.resize( _entry.size() );
+  for( unsigned int k=0; k<_entry.size(); k++ ){
+    const unsigned int i = _entry[k].first, j = _entry[k].second;
+    bool unique = true;
+    for( unsigned int l=0; unique && l<adj[i].size(); l++ )
+      if( adj[i][l] != j && _color[adj[i][l]] == _color[j] ) unique = false;
+    _source[k] = unique? std::make_pair( i, _color[j] ): std::make_pair( j, _color[i] );
+  }
+}
+
+} // namespace mc
+
+#endif
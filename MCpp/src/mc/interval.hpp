@@ -5,7 +5,7 @@
 \page page_INTERVAL Non-Verified Interval Arithmetic for Factorable Functions
 \author Beno&icirc;t Chachuat
 
-Computational methods for enclosing the range of functions find their origins in interval analysis back in the early 1960s [Moore, 1966; Moore <I>et al.</I>, 2009]. For functions whose expressions can be broken down into a finite number of elementary unary and binary operations, namely factorable functions, interval bounding can be readily automated. The class mc::Interval provides a basic implementation of interval arithmetic, which is <B>not a verified implementation</B> in the sense that rounding errors are not accounted for. For verified interval computations, it is strongly recommended to use third-party libraries such as <A href="http://www.ti3.tu-harburg.de/Software/PROFILEnglisch.html">PROFIL</A> or <A href="http://www.math.uni-wuppertal.de/~xsc/software/filib.html">FILIB++</A>.
+Computational methods for enclosing the range of functions find their origins in interval analysis back in the early 1960s [Moore, 1966; Moore <I>et al.</I>, 2009]. For functions whose expressions can be broken down into a finite number of elementary unary and binary operations, namely factorable functions, interval bounding can be readily automated. The class mc::Interval provides a basic implementation of interval arithmetic, which is <B>not a verified implementation</B> in the sense that rounding errors are not accounted for. For verified interval computations, the computations can be performed in a verified scope of mc::Interval (see \ref sec_INTERVAL_verif), or using third-party libraries such as <A href="http://www.ti3.tu-harburg.de/Software/PROFILEnglisch.html">PROFIL</A> or <A href="http://www.math.uni-wuppertal.de/~xsc/software/filib.html">FILIB++</A>.
 
 The implementation of mc::Interval relies on the operator/function overloading mechanism of C++. This makes the computation of bounds both simple and intuitive, similar to computing function values in real arithmetics. Moreover, mc::Interval can be used as the underlying interval type in other classes of MC++ via templates; e.g., mc::McCormick<mc::Interval>, mc::TModel<mc::Interval>, mc::TVar<mc::Interval>.
 
@@ -52,6 +52,21 @@ Moreover, the upper and lower bounds in the interval bound <a>F</a> can be retri
 \endcode <tt>exp</tt>,
 
 
+\section sec_INTERVAL_verif How do I compute verified bounds with mc::Interval?
+
+The bounds computed with mc::Interval account for round-off errors while an object of type mc::Interval::Verified exists in the current thread:
+
+\code
+      I F;
+      {
+        mc::Interval::Verified scope;
+        F = X*pow(exp(X)-Y,2);
+      }
+\endcode
+
+The constructor of mc::Interval::Verified switches the rounding mode of the floating-point unit upward, and its destructor restores the previous rounding mode, so that the rounding mode is switched only twice per evaluation rather than twice per operation. The lower bounds are then computed with upward rounding too, as the opposite of an upper bound; e.g., the lower bound of \f$X+Y\f$ is computed as \f$-((-\underline{x})-\underline{y})\f$. In the default rounding mode, to nearest, these expressions produce the same results as the usual ones, so that the arithmetic operations of mc::Interval have the same cost inside and outside a verified scope. Moreover, the results of the elementary functions of the C math library, such as <tt>exp</tt>, <tt>log</tt> or <tt>sin</tt>, are widened by their maximal error, set by the option mc::Interval::Options::LIBM_ULPS, as well as by the error in the reduction of the argument of the trigonometric functions. The operands and results of the rounded operations are hidden from the optimizer by empty assembly statements, or volatile temporaries for compilers other than GCC and compatible ones, so that these operations are neither evaluated at compile time nor moved across the changes of rounding mode; the bounds are thus verified without the flag <tt>-frounding-math</tt> of GCC, the test suite being built without it by the target <tt>test_noround</tt> of <tt>test.mk</tt>. On 32-bit x86 platforms, <tt>-ffloat-store</tt> or <tt>-mfpmath=sse</tt> is still needed to avoid the extended precision of the x87 registers. Note that the relaxations in the classes that are templated on the interval type, such as mc::McCormick, are not verified.
+
+
 \section sec_INTERVAL_fct Which functions are overloaded in mc::Interval?
 
 mc::Interval overloads the usual functions <tt>exp</tt>, <tt>log</tt>, <tt>sqr</tt>, <tt>sqrt</tt>, <tt>pow</tt>, <tt>inv</tt>, <tt>cos</tt>, <tt>sin</tt>, <tt>tan</tt>, <tt>acos</tt>, <tt>asin</tt>, <tt>atan</tt>, <tt>erf</tt>, <tt>erfc</tt>, <tt>min</tt>, <tt>max</tt>, <tt>fabs</tt>. mc::Interval also defines the following functions:
@@ -79,6 +94,8 @@ The available options are as follows:
          <TD><b>Description</b>
      <TR><TH><tt>DISPLAY_DIGITS</tt> <TD><tt>unsigned int</tt> <TD>5
          <TD>Number of digits in output stream
+     <TR><TH><tt>LIBM_ULPS</tt> <TD><tt>unsigned int</tt> <TD>8
+         <TD>Maximal error of the functions of the C math library with upward rounding, in units in the last place, for the outward rounding of their results in a verified scope
 </TABLE>
 
 
@@ -114,17 +131,19 @@ Possible errors encountered in using mc::Interval are:
 #include <iostream>
 #include <iomanip>
 #include <stdarg.h>
+#include <limits>
+#include <fenv.h>
 
 #include "mcfunc.hpp"
 
 namespace mc
 {
-//! @brief C++ class for (non-verified) interval bounding of factorable function
+//! @brief C++ class for interval bounding of factorable function
 ////////////////////////////////////////////////////////////////////////
 //! mc::Interval is a C++ class for interval bounding of factorable
 //! functions on a box based on natural interval extensions. Round-off
-//! errors are not accounted for in the computations (non-verified
-//! implementation).
+//! errors are accounted for in the computations only while an object
+//! of type mc::Interval::Verified exists (verified scope).
 ////////////////////////////////////////////////////////////////////////
 class Interval
 ////////////////////////////////////////////////////////////////////////
@@ -253,30 +272,30 @@ public:
   Interval& operator+=
     ( const double c )
     {
-      _l += c;
-      _u += c;
+      _l = _add_dn( _l, c );
+      _u = _add_up( _u, c );
       return *this;
     }
   Interval& operator+=
     ( const Interval&I )
     {
-      _l += I._l;
-      _u += I._u;
+      _l = _add_dn( _l, I._l );
+      _u = _add_up( _u, I._u );
       return *this;
     }
   Interval& operator-=
     ( const double c )
     {
-      _l -= c;
-      _u -= c;
+      _l = _sub_dn( _l, c );
+      _u = _sub_up( _u, c );
       return *this;
     }
   Interval& operator-=
     ( const Interval&I )
     {
       Interval I2( _l, _u );
-      _l = I2._l - I._u;
-      _u = I2._u - I._l;
+      _l = _sub_dn( I2._l, I._u );
+      _u = _sub_up( I2._u, I._l );
       return *this;
     }
   Interval& operator*=
@@ -320,12 +339,46 @@ public:
   {
     //! @brief Constructor
     Options():
-      DISPLAY_DIGITS(5)
+      DISPLAY_DIGITS(5), LIBM_ULPS(8)
       {}
     //! @brief Number of digits displayed with << operator (default=5)
     unsigned int DISPLAY_DIGITS;
+    //! @brief Maximal error of the C math library functions with upward rounding, in units in the last place (default=8)
+    unsigned int LIBM_ULPS;
   } options;
 
+  //! @brief Scope of verified computations with mc::Interval
+  ////////////////////////////////////////////////////////////////////////
+  //! mc::Interval::Verified sets the rounding mode upward on construction
+  //! and restores the previous rounding mode on destruction. The bounds
+  //! computed with mc::Interval in the current thread account for
+  //! round-off errors while such an object exists.
+  ////////////////////////////////////////////////////////////////////////
+  class Verified
+  {
+  public:
+    //! @brief Constructor, setting the rounding mode upward
+    Verified():
+      _round( fegetround() )
+      { fesetround( FE_UPWARD ); _depth++; }
+    //! @brief Destructor, restoring the previous rounding mode
+    ~Verified()
+      { _depth--; fesetround( _round ); }
+    //! @brief Whether a verified scope exists in the current thread
+    static bool active()
+      { return _depth > 0; }
+
+  private:
+    //! @brief Rounding mode before construction
+    const int _round;
+    //! @brief Number of nested verified scopes in the current thread
+    static MC__THREAD_LOCAL unsigned int _depth;
+    //! @brief Private copy constructor
+    Verified( const Verified& );
+    //! @brief Private assignment operator
+    Verified& operator=( const Verified& );
+  };
+
   //! @brief Exceptions of mc::Interval
   class Exceptions
   {
@@ -420,11 +473,98 @@ private:
   double _l;
   //! @brief Upper bound
   double _u;
+
+  //! @brief Value <a>v</a> hidden from the optimizer, so that the operations on it are neither evaluated at compile time nor moved across a change of rounding mode
+  static double _opaque
+    ( double v )
+    {
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__SSE2_MATH__) )
+      __asm__ __volatile__( "" : "+x"(v) );
+#elif defined(__GNUC__) && defined(__aarch64__)
+      __asm__ __volatile__( "" : "+w"(v) );
+#elif defined(__GNUC__)
+      __asm__ __volatile__( "" : "+m"(v) );
+#else
+      volatile double w = v;
+      v = w;
+#endif
+      return v;
+    }
+  //! @brief Sum <a>a</a>+<a>b</a>, rounded upward in a verified scope
+  static double _add_up
+    ( const double a, const double b )
+    { return _opaque( _opaque(a) + _opaque(b) ); }
+  //! @brief Sum <a>a</a>+<a>b</a>, rounded downward in a verified scope
+  static double _add_dn
+    ( const double a, const double b )
+    { return -_add_up( -a, -b ); }
+  //! @brief Difference <a>a</a>-<a>b</a>, rounded upward in a verified scope
+  static double _sub_up
+    ( const double a, const double b )
+    { return _opaque( _opaque(a) - _opaque(b) ); }
+  //! @brief Difference <a>a</a>-<a>b</a>, rounded downward in a verified scope
+  static double _sub_dn
+    ( const double a, const double b )
+    { return -_sub_up( b, a ); }
+  //! @brief Product <a>a</a>*<a>b</a>, rounded upward in a verified scope
+  static double _mul_up
+    ( const double a, const double b )
+    { return _opaque( _opaque(a) * _opaque(b) ); }
+  //! @brief Product <a>a</a>*<a>b</a>, rounded downward in a verified scope
+  static double _mul_dn
+    ( const double a, const double b )
+    { return -_mul_up( -a, b ); }
+  //! @brief Ratio <a>a</a>/<a>b</a>, rounded upward in a verified scope
+  static double _div_up
+    ( const double a, const double b )
+    { return _opaque( _opaque(a) / _opaque(b) ); }
+  //! @brief Ratio <a>a</a>/<a>b</a>, rounded downward in a verified scope
+  static double _div_dn
+    ( const double a, const double b )
+    { return -_div_up( -a, b ); }
+
+  //! @brief Bound on the error of a C math library function with value <a>v</a>, plus the absolute error <a>a</a>
+  static double _liberr
+    ( const double v, const double a )
+    {
+      return _add_up( _mul_up( _add_up( _mul_up( std::fabs(v), std::numeric_limits<double>::epsilon() ),
+                                        std::numeric_limits<double>::denorm_min() ),
+                               options.LIBM_ULPS ), a );
+    }
+  //! @brief Lower bound on the value <a>v</a> of a C math library function, outward rounded by its error and the absolute error <a>a</a> in a verified scope
+  static double _down
+    ( const double v, const double a=0. )
+    {
+      if( !Verified::active() ) return v;
+      return _sub_dn( v, _liberr( v, a ) );
+    }
+  //! @brief Upper bound on the value <a>v</a> of a C math library function, outward rounded by its error and the absolute error <a>a</a> in a verified scope
+  static double _up
+    ( const double v, const double a=0. )
+    {
+      if( !Verified::active() ) return v;
+      return _add_up( v, _liberr( v, a ) );
+    }
+  //! @brief Bound on the error in the reduction of the argument <a>x</a> of a trigonometric function
+  static double _trigerr
+    ( const double x )
+    {
+      return ( std::fabs(x) + 2.*PI ) * 4. * std::numeric_limits<double>::epsilon();
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////
 
 Interval::Options Interval::options;
+MC__THREAD_LOCAL unsigned int Interval::Verified::_depth = 0;
+
+// The lower bounds are computed as the opposite of upper bounds, e.g.
+// l1+l2 as -((-l1)-l2), so as to be rounded outward in a verified scope
+// where the rounding mode is upward. In rounding to nearest, these
+// expressions are exact counterparts of the usual ones. The operands and
+// results are hidden from the optimizer by Interval::_opaque, so that
+// these expressions are neither simplified nor moved across the changes
+// of rounding mode without -frounding-math.
 
 inline Interval
 operator+
@@ -445,7 +585,7 @@ inline Interval
 operator+
 ( const double c, const Interval&I )
 {
-  Interval I2( c + I._l, c + I._u );
+  Interval I2( Interval::_add_dn( c, I._l ), Interval::_add_up( c, I._u ) );
   return I2;
 }
 
@@ -453,7 +593,7 @@ inline Interval
 operator+
 ( const Interval&I, const double c )
 {
-  Interval I2( c + I._l, c + I._u );
+  Interval I2( Interval::_add_dn( c, I._l ), Interval::_add_up( c, I._u ) );
   return I2;
 }
 
@@ -461,7 +601,7 @@ inline Interval
 operator+
 ( const Interval&I1, const Interval&I2 )
 {
-  Interval I3( I1._l+I2._l, I1._u+I2._u );
+  Interval I3( Interval::_add_dn( I1._l, I2._l ), Interval::_add_up( I1._u, I2._u ) );
   return I3;
 }
 
@@ -469,7 +609,7 @@ inline Interval
 operator-
 ( const double c, const Interval&I )
 {
-  Interval I2( c - I._u, c - I._l );
+  Interval I2( Interval::_sub_dn( c, I._u ), Interval::_sub_up( c, I._l ) );
   return I2;
 }
 
@@ -477,7 +617,7 @@ inline Interval
 operator-
 ( const Interval&I, const double c )
 {
-  Interval I2( I._l-c, I._u-c );
+  Interval I2( Interval::_sub_dn( I._l, c ), Interval::_sub_up( I._u, c ) );
   return I2;
 }
 
@@ -485,7 +625,7 @@ inline Interval
 operator-
 ( const Interval&I1, const Interval&I2 )
 {
-  Interval I3( I1._l-I2._u, I1._u-I2._l );
+  Interval I3( Interval::_sub_dn( I1._l, I2._u ), Interval::_sub_up( I1._u, I2._l ) );
   return I3;
 }
 
@@ -493,7 +633,8 @@ inline Interval
 operator*
 ( const double c, const Interval&I )
 {
-  Interval I2( c>=0? c*I._l: c*I._u, c>=0? c*I._u: c*I._l );
+  Interval I2( c>=0? Interval::_mul_dn( c, I._l ): Interval::_mul_dn( c, I._u ),
+               c>=0? Interval::_mul_up( c, I._u ): Interval::_mul_up( c, I._l ) );
   return I2;
 }
 
@@ -501,7 +642,8 @@ inline Interval
 operator*
 ( const Interval&I, const double c )
 {
-  Interval I2( c>=0? c*I._l: c*I._u, c>=0? c*I._u: c*I._l );
+  Interval I2( c>=0? Interval::_mul_dn( c, I._l ): Interval::_mul_dn( c, I._u ),
+               c>=0? Interval::_mul_up( c, I._u ): Interval::_mul_up( c, I._l ) );
   return I2;
 }
 
@@ -509,10 +651,10 @@ inline Interval
 operator*
 ( const Interval&I1, const Interval&I2 )
 {
-  Interval I3( std::min(std::min(I1._l*I2._l,I1._l*I2._u),
-                        std::min(I1._u*I2._l,I1._u*I2._u)),
-               std::max(std::max(I1._l*I2._l,I1._l*I2._u),
-                        std::max(I1._u*I2._l,I1._u*I2._u)) );
+  Interval I3( std::min(std::min(Interval::_mul_dn(I1._l,I2._l),Interval::_mul_dn(I1._l,I2._u)),
+                        std::min(Interval::_mul_dn(I1._u,I2._l),Interval::_mul_dn(I1._u,I2._u))),
+               std::max(std::max(Interval::_mul_up(I1._l,I2._l),Interval::_mul_up(I1._l,I2._u)),
+                        std::max(Interval::_mul_up(I1._u,I2._l),Interval::_mul_up(I1._u,I2._u))) );
   return I3;
 }
 
@@ -521,7 +663,9 @@ operator/
 ( const Interval &I, const double c )
 {
   if( isequal(c,0.) ) throw Interval::Exceptions( Interval::Exceptions::DIV );
-  return (1./c)*I;
+  Interval I2( c>0? Interval::_div_dn( I._l, c ): Interval::_div_dn( I._u, c ),
+               c>0? Interval::_div_up( I._u, c ): Interval::_div_up( I._l, c ) );
+  return I2;
 }
 
 inline Interval
@@ -564,7 +708,7 @@ inv
 ( const Interval &I )
 {
   if ( I._l <= 0. && I._u >= 0. ) throw Interval::Exceptions( Interval::Exceptions::INV );
-  Interval I2( 1./I._u, 1./I._l );
+  Interval I2( Interval::_div_dn( 1., I._u ), Interval::_div_up( 1., I._l ) );
   return I2;
 }
 
@@ -573,8 +717,8 @@ sqr
 ( const Interval&I )
 {
   int imid = -1;
-  Interval I2( mc::sqr( mid(I._l,I._u,0.,imid) ),
-               std::max(mc::sqr(I._l),mc::sqr(I._u)) );
+  const double m = mid(I._l,I._u,0.,imid);
+  Interval I2( Interval::_mul_dn( m, m ), std::max( Interval::_mul_up( I._l, I._l ), Interval::_mul_up( I._u, I._u ) ) );
   return I2;
 }
 
@@ -582,7 +726,7 @@ inline Interval
 exp
 ( const Interval &I )
 {
-  Interval I2( std::exp(I._l), std::exp(I._u) );
+  Interval I2( std::max( 0., Interval::_down( std::exp(I._l) ) ), Interval::_up( std::exp(I._u) ) );
   return I2;
 }
 
@@ -598,7 +742,7 @@ log
 ( const Interval &I )
 {
   if ( I._l <= 0. ) throw Interval::Exceptions( Interval::Exceptions::LOG );
-  Interval I2( std::log(I._l), std::log(I._u) );
+  Interval I2( Interval::_down( std::log(I._l) ), Interval::_up( std::log(I._u) ) );
   return I2;
 }
 
@@ -608,8 +752,8 @@ xlog
 {
   if ( I._l <= 0. ) throw Interval::Exceptions( Interval::Exceptions::LOG );
   int imid = -1;
-  Interval I2( xlog(mid(I._l,I._u,std::exp(-1.),imid)),
-               std::max(xlog(I._l),xlog(I._u)) );
+  Interval I2( Interval::_down( xlog(mid(I._l,I._u,std::exp(-1.),imid)) ),
+               Interval::_up( std::max(xlog(I._l),xlog(I._u)) ) );
   return I2;
 }
 
@@ -617,7 +761,8 @@ inline Interval
 erf
 ( const Interval &I )
 {
-  Interval I2( ::erf(I._l), ::erf(I._u) );
+  Interval I2( std::max( -1., Interval::_down( ::erf(I._l) ) ),
+               std::min( 1., Interval::_up( ::erf(I._u) ) ) );
   return I2;
 }
 
@@ -625,7 +770,8 @@ inline Interval
 erfc
 ( const Interval &I )
 {
-  Interval I2( ::erfc(I._u), ::erfc(I._l) );
+  Interval I2( std::max( 0., Interval::_down( ::erfc(I._u) ) ),
+               std::min( 2., Interval::_up( ::erfc(I._l) ) ) );
   return I2;
 }
 
@@ -634,7 +780,7 @@ sqrt
 ( const Interval&I )
 {
   if ( I._l < 0. ) throw Interval::Exceptions( Interval::Exceptions::SQRT );
-  Interval I2( std::sqrt(I._l), std::sqrt(I._u) );
+  Interval I2( std::max( 0., Interval::_down( std::sqrt(I._l) ) ), Interval::_opaque( std::sqrt( Interval::_opaque(I._u) ) ) );
   return I2;
 }
 
@@ -660,12 +806,12 @@ pow
   }
   if( n >= 2 && n%2 == 0 ){ 
     int imid = -1;
-    Interval I2( std::pow(mid(I._l,I._u,0.,imid),n),
-                 std::max(std::pow(I._l,n),std::pow(I._u,n)) );
+    Interval I2( std::max( 0., Interval::_down( std::pow(mid(I._l,I._u,0.,imid),n) ) ),
+                 Interval::_up( std::max(std::pow(I._l,n),std::pow(I._u,n)) ) );
     return I2;
   }
   if ( n >= 3 ){
-    Interval I2( std::pow(I._l,n), std::pow(I._u,n) );
+    Interval I2( Interval::_down( std::pow(I._l,n) ), Interval::_up( std::pow(I._u,n) ) );
     return I2;
   }
   return inv( pow( I, -n ) );
@@ -746,27 +892,18 @@ cos
 {
   const int k = std::ceil(-(1.+I._l/PI)/2.); // -pi <= xL+2*k*pi < pi
   const double l = I._l+2.*PI*k, u = I._u+2.*PI*k;
+  double cl, cu;
   if( l <= 0 ){
-    if( u <= 0 ){
-      Interval I2( std::cos(l), std::cos(u) );
-      return I2;
-    }
-    if( u >= PI ){
-      Interval I2( -1., 1. );
-      return I2;
-    }
-    Interval I2( std::min(std::cos(l), std::cos(u)), 1. );
-    return I2;
-  }
-  if( u <= PI ){
-    Interval I2( std::cos(u), std::cos(l) );
-    return I2;
-  }
-  if( u >= 2.*PI ){
-    Interval I2( -1., 1. );
-    return I2;
+    if( u <= 0 ){ cl = std::cos(l); cu = std::cos(u); }
+    else if( u >= PI ){ cl = -1.; cu = 1.; }
+    else{ cl = std::min(std::cos(l), std::cos(u)); cu = 1.; }
   }
-  Interval I2( -1., std::max(std::cos(l), std::cos(u)));
+  else if( u <= PI ){ cl = std::cos(u); cu = std::cos(l); }
+  else if( u >= 2.*PI ){ cl = -1.; cu = 1.; }
+  else{ cl = -1.; cu = std::max(std::cos(l), std::cos(u)); }
+  // Error in the reduced argument, accounted for in a verified scope
+  const double a = Interval::_trigerr( std::max( std::fabs(I._l), std::fabs(I._u) ) );
+  Interval I2( std::max( -1., Interval::_down( cl, a ) ), std::min( 1., Interval::_up( cu, a ) ) );
   return I2;
 }
 
@@ -784,7 +921,10 @@ tan
   const int k = std::ceil(-0.5-I._l/PI); // -pi/2 <= xL+k*pi < pi/2
   const double l = I._l+PI*k, u = I._u+PI*k;
   if( u >= 0.5*PI ) throw Interval::Exceptions( Interval::Exceptions::TAN );
-  Interval I2( std::tan(l), std::tan(u) );
+  // Error in the reduced argument, amplified by the derivative of tan
+  const double a = Interval::_trigerr( std::max( std::fabs(I._l), std::fabs(I._u) ) );
+  const double tl = std::tan(l), tu = std::tan(u);
+  Interval I2( Interval::_down( tl, 2.*a*(1.+tl*tl) ), Interval::_up( tu, 2.*a*(1.+tu*tu) ) );
   return I2;
 }
 
@@ -793,7 +933,7 @@ acos
 ( const Interval &I )
 {
   if ( I._l < -1. || I._u > 1. ) throw Interval::Exceptions( Interval::Exceptions::ACOS );
-  Interval I2( std::acos(I._u), std::acos(I._l) );
+  Interval I2( std::max( 0., Interval::_down( std::acos(I._u) ) ), Interval::_up( std::acos(I._l) ) );
   return I2;
 }
 
@@ -802,7 +942,7 @@ asin
 ( const Interval &I )
 {
   if ( I._l < -1. || I._u > 1. ) throw Interval::Exceptions( Interval::Exceptions::ASIN );
-  Interval I2( std::asin(I._l), std::asin(I._u) );
+  Interval I2( Interval::_down( std::asin(I._l) ), Interval::_up( std::asin(I._u) ) );
   return I2;
 }
 
@@ -810,7 +950,7 @@ inline Interval
 atan
 ( const Interval &I )
 {
-  Interval I2( std::atan(I._l), std::atan(I._u) );
+  Interval I2( Interval::_down( std::atan(I._l) ), Interval::_up( std::atan(I._u) ) );
   return I2;
 }
 
@@ -0,0 +1,279 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_INTERVALBLAS Interval Linear Algebra Kernels
+\author Beno&icirc;t Chachuat
+
+Interval vectors and matrices arise, e.g., with interval Jacobians and Hessians, or in the preconditioning step of an interval Newton method. Computing their products with the scalar operators of an interval type is simple, but each scalar product selects its bounds among four real products, and none of the blocking and vectorization of an optimized BLAS is available.
+
+The class mc::IntervalBLAS provides the dot product, matrix-vector product and matrix-matrix product for vectors and matrices whose entries are of an interval type <tt>T</tt>, as well as the product of a real matrix with an interval matrix or vector. The interval type <tt>T</tt> is accessed only through the class mc::Op<T>, so that the types of PROFIL and FILIB++ may be used besides mc::Interval. Two algorithms are available:
+- The <B>infimum-supremum</B> algorithm computes the sums of products with the operators of <tt>T</tt>. It gives the tightest bounds, and they are verified if the operators of <tt>T</tt> are.
+- The <B>midpoint-radius</B> algorithm by Rump (1999) represents each interval \f$[\underline{x},\overline{x}]\f$ by a midpoint \f$m_x\f$ and a radius \f$r_x\f$, and bounds the product \f$C=AB\f$ as
+\f[ C \subseteq \left[ m_Am_B - R, m_Am_B + R\right], \quad \text{with} \quad R = (|m_A|+r_A)r_B + r_A|m_B|. \f]
+Thus, the bounds are computed with four products of real matrices, for which the routine <tt>dgemm</tt> of BLAS is called. These products are computed with upward rounding, with the lower bound obtained as \f$-((-m_A)m_B+R)\f$, inside a scope of type mc::Interval::Verified, so that the bounds are verified regardless of the type <tt>T</tt>. The overestimation compared to the infimum-supremum algorithm is by a factor 1.5 at most, and in practice much less when the intervals are narrow.
+.
+The midpoint-radius algorithm is used if the option mc::IntervalBLAS::Options::MIDRAD is set and the number of scalar products exceeds the threshold in mc::IntervalBLAS::Options::MIDRAD_MIN, or else the infimum-supremum algorithm is used. The latter is used too if any of the bounds exceeds half the largest double in magnitude, or if the midpoint-radius bounds overflow.
+
+Since the rounding mode is set per thread, the BLAS library must perform the products on the calling thread for the bounds to be verified. With a multithreaded BLAS, such as OpenBLAS, this requires to restrict it to a single thread, e.g. by setting the environment variable <tt>OPENBLAS_NUM_THREADS=1</tt>. Moreover, the code of MC++ must be compiled with the flag <tt>-frounding-math</tt> of GCC, as explained in \ref sec_INTERVAL_verif.
+
+
+\section sec_INTERVALBLAS_use How do I multiply interval matrices with mc::IntervalBLAS?
+
+Matrices are stored in column-major order, as in BLAS and LAPACK. Suppose we want to compute the product of an interval matrix \f$A\f$ of size \f$m\times k\f$ and an interval matrix \f$B\f$ of size \f$k\times n\f$. The relevant header file and type are:
+
+\code
+      #include "intervalblas.hpp"
+      typedef mc::Interval I;
+      typedef mc::IntervalBLAS<I> IBLAS;
+\endcode
+
+The entries of <a>A</a> and <a>B</a> are stored in arrays <a>A</a> of size <a>m*k</a> and <a>B</a> of size <a>k*n</a>, and the product is written in the array <a>C</a> of size <a>m*n</a> as
+
+\code
+      IBLAS::gemm( m, n, k, A, B, C );
+\endcode
+
+Likewise, the product of the matrix <a>A</a> with the interval vector <a>x</a> of size <a>k</a>, and the dot product of two interval vectors <a>x</a> and <a>y</a> of size <a>k</a>, are computed as
+
+\code
+      IBLAS::gemv( m, k, A, x, y );
+      I d = IBLAS::dot( k, x, y );
+\endcode
+
+The same functions take a real matrix <a>A</a> of type <tt>double*</tt> as first operand, e.g. for preconditioning an interval Jacobian matrix with the inverse of its midpoint matrix.
+
+
+\section sec_INTERVALBLAS_err What errors can I encounter when using mc::IntervalBLAS?
+
+No exception is thrown by mc::IntervalBLAS itself. Exceptions of the interval type <tt>T</tt> may be thrown by the infimum-supremum algorithm.
+
+
+\section sec_INTERVALBLAS_refs References
+
+- Rump, S.M., <A href="http://dx.doi.org/10.1023/A:1022374804152">Fast and parallel interval arithmetic</A>, <I>BIT Numerical Mathematics</I>, <b>39</b>(3):534-554, 1999.
+.
+
+*/
+
+#ifndef MC__INTERVALBLAS_HPP
+#define MC__INTERVALBLAS_HPP
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "mcop.hpp"
+#include "interval.hpp"
+
+extern "C" void dgemm_
+( const char*transa, const char*transb, const int*m, const int*n,
+  const int*k, const double*alpha, const double*a, const int*lda,
+  const double*b, const int*ldb, const double*beta, double*c,
+  const int*ldc );
+
+namespace mc
+{
+
+//! @brief C++ class for products of interval vectors and matrices
+////////////////////////////////////////////////////////////////////////
+//! mc::IntervalBLAS is a C++ class computing dot products,
+//! matrix-vector products and matrix-matrix products of vectors and
+//! matrices in column-major order, whose entries are of the interval
+//! type <tt>T</tt>, using either the infimum-supremum or the
+//! midpoint-radius algorithm.
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class IntervalBLAS
+////////////////////////////////////////////////////////////////////////
+{
+public:
+
+  //! @brief Options of mc::IntervalBLAS
+  static struct Options
+  {
+    //! @brief Constructor
+    Options():
+      MIDRAD(true), MIDRAD_MIN(1500)
+      {}
+    //! @brief Whether to use the midpoint-radius algorithm with BLAS for large products
+    bool MIDRAD;
+    //! @brief Minimal number of scalar products <tt>m*n*k</tt> for the midpoint-radius algorithm to be used
+    unsigned long MIDRAD_MIN;
+  } options;
+
+  //! @brief Dot product of the interval vectors <a>x</a> and <a>y</a> of size <a>n</a>
+  static T dot
+    ( const unsigned int n, const T*x, const T*y )
+    { T d; gemm( 1, 1, n, x, y, &d ); return d; }
+
+  //! @brief Product <a>y</a> of size <a>m</a> of the <a>m</a>-by-<a>n</a> interval matrix <a>A</a> with the interval vector <a>x</a> of size <a>n</a>
+  static void gemv
+    ( const unsigned int m, const unsigned int n, const T*A, const T*x,
+      T*y )
+    { gemm( m, 1, n, A, x, y ); }
+  //! @brief Product <a>y</a> of size <a>m</a> of the <a>m</a>-by-<a>n</a> real matrix <a>A</a> with the interval vector <a>x</a> of size <a>n</a>
+  static void gemv
+    ( const unsigned int m, const unsigned int n, const double*A,
+      const T*x, T*y )
+    { gemm( m, 1, n, A, x, y ); }
+
+  //! @brief Product <a>C</a> of the <a>m</a>-by-<a>k</a> interval matrix <a>A</a> with the <a>k</a>-by-<a>n</a> interval matrix <a>B</a>
+  static void gemm
+    ( const unsigned int m, const unsigned int n, const unsigned int k,
+      const T*A, const T*B, T*C );
+  //! @brief Product <a>C</a> of the <a>m</a>-by-<a>k</a> real matrix <a>A</a> with the <a>k</a>-by-<a>n</a> interval matrix <a>B</a>
+  static void gemm
+    ( const unsigned int m, const unsigned int n, const unsigned int k,
+      const double*A, const T*B, T*C );
+
+private:
+
+  //! @brief Whether to use the midpoint-radius algorithm for a product of size <a>m</a>-by-<a>k</a> times <a>k</a>-by-<a>n</a>
+  static bool _use_midrad
+    ( const unsigned int m, const unsigned int n, const unsigned int k )
+    { return options.MIDRAD && m && n && k && (unsigned long)m*n*k >= options.MIDRAD_MIN; }
+
+  //! @brief Whether all the bounds of the <a>n</a> intervals in <a>X</a> are less than half the largest double in magnitude
+  static bool _finite
+    ( const unsigned int n, const T*X );
+
+  //! @brief Midpoints <a>M</a> and radii <a>R</a> of the <a>n</a> intervals in <a>X</a> -- to be called with upward rounding
+  static void _convert
+    ( const unsigned int n, const T*X, double*M, double*R );
+
+  //! @brief Infimum-supremum product <a>C</a> of the <a>m</a>-by-<a>k</a> matrix <a>A</a> with the <a>k</a>-by-<a>n</a> interval matrix <a>B</a>
+  template <typename U> static void _infsup
+    ( const unsigned int m, const unsigned int n, const unsigned int k,
+      const U*A, const T*B, T*C );
+
+  //! @brief Midpoint-radius product <a>C</a> of the <a>m</a>-by-<a>k</a> matrix <a>MA</a>&plusmn;<a>RA</a> with the <a>k</a>-by-<a>n</a> matrix <a>MB</a>&plusmn;<a>RB</a>, with <a>RA</a> omitted when null -- <a>MA</a> is altered, the rounding mode must be upward, and the return value is <tt>false</tt> if the bounds overflowed
+  static bool _midrad
+    ( const unsigned int m, const unsigned int n, const unsigned int k,
+      double*MA, const double*RA, const double*MB, const double*RB, T*C );
+
+  //! @brief Real matrix product <a>C</a> = <a>A</a>*<a>B</a> + <a>beta</a>*<a>C</a> using BLAS
+  static void _dgemm
+    ( const unsigned int m, const unsigned int n, const unsigned int k,
+      const double*A, const double*B, const double beta, double*C )
+    {
+      const int M = m, N = n, K = k;
+      const char TR = 'N';
+      const double ONE = 1.;
+      dgemm_( &TR, &TR, &M, &N, &K, &ONE, A, &M, B, &K, &beta, C, &M );
+    }
+};
+
+template <typename T> typename IntervalBLAS<T>::Options IntervalBLAS<T>::options;
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T> inline bool
+IntervalBLAS<T>::_finite
+( const unsigned int n, const T*X )
+{
+  // The radii are then finite too
+  const double bnd = 0.5 * std::numeric_limits<double>::max();
+  for( unsigned int i=0; i<n; i++ )
+    if( !( std::fabs( Op<T>::l( X[i] ) ) <= bnd && std::fabs( Op<T>::u( X[i] ) ) <= bnd ) )
+      return false;
+  return true;
+}
+
+template <typename T> inline void
+IntervalBLAS<T>::_convert
+( const unsigned int n, const T*X, double*M, double*R )
+{
+  // With upward rounding, the midpoint is no less than the exact one
+  // so that the upper bound is within the radius M-l
+  for( unsigned int i=0; i<n; i++ ){
+    const double l = Op<T>::l( X[i] );
+    M[i] = 0.5 * l + 0.5 * Op<T>::u( X[i] );
+    R[i] = M[i] - l;
+  }
+}
+
+template <typename T> template <typename U> inline void
+IntervalBLAS<T>::_infsup
+( const unsigned int m, const unsigned int n, const unsigned int k,
+  const U*A, const T*B, T*C )
+{
+  for( unsigned int j=0; j<n; j++ ){
+    T*Cj = C+j*m;
+    for( unsigned int i=0; i<m; i++ ) Cj[i] = Op<T>::point( 0. );
+    for( unsigned int l=0; l<k; l++ ){
+      const T&Blj = B[l+j*k];
+      const U*Al = A+l*m;
+      for( unsigned int i=0; i<m; i++ ) Cj[i] += Al[i] * Blj;
+    }
+  }
+}
+
+template <typename T> inline bool
+IntervalBLAS<T>::_midrad
+( const unsigned int m, const unsigned int n, const unsigned int k,
+  double*MA, const double*RA, const double*MB, const double*RB, T*C )
+{
+  // Radius R = (|MA|+RA)*RB + RA*|MB|, computed with upward rounding
+  std::vector<double> W( std::max( m*k, k*n ) ), R( m*n ), CU( m*n );
+  for( unsigned int i=0; i<m*k; i++ ) W[i] = std::fabs( MA[i] ) + ( RA? RA[i]: 0. );
+  _dgemm( m, n, k, &W[0], RB, 0., &R[0] );
+  if( RA ){
+    for( unsigned int i=0; i<k*n; i++ ) W[i] = std::fabs( MB[i] );
+    _dgemm( m, n, k, RA, &W[0], 1., &R[0] );
+  }
+
+  // Upper bound MA*MB+R, and lower bound -((-MA)*MB+R)
+  std::copy( R.begin(), R.end(), CU.begin() );
+  _dgemm( m, n, k, MA, MB, 1., &CU[0] );
+  for( unsigned int i=0; i<m*k; i++ ) MA[i] = -MA[i];
+  _dgemm( m, n, k, MA, MB, 1., &R[0] );
+
+  for( unsigned int i=0; i<m*n; i++ ){
+    if( R[i] != R[i] || CU[i] != CU[i] ) return false;
+    C[i] = Op<T>::hull( Op<T>::point( -R[i] ), Op<T>::point( CU[i] ) );
+  }
+  return true;
+}
+
+template <typename T> inline void
+IntervalBLAS<T>::gemm
+( const unsigned int m, const unsigned int n, const unsigned int k,
+  const T*A, const T*B, T*C )
+{
+  if( !_use_midrad( m, n, k ) || !_finite( m*k, A ) || !_finite( k*n, B ) ){
+    _infsup( m, n, k, A, B, C );
+    return;
+  }
+
+  std::vector<double> MA( m*k ), RA( m*k ), MB( k*n ), RB( k*n );
+  bool midrad;
+  { Interval::Verified scope;
+    _convert( m*k, A, &MA[0], &RA[0] );
+    _convert( k*n, B, &MB[0], &RB[0] );
+    midrad = _midrad( m, n, k, &MA[0], &RA[0], &MB[0], &RB[0], C ); }
+  if( !midrad ) _infsup( m, n, k, A, B, C );
+}
+
+template <typename T> inline void
+IntervalBLAS<T>::gemm
+( const unsigned int m, const unsigned int n, const unsigned int k,
+  const double*A, const T*B, T*C )
+{
+  if( !_use_midrad( m, n, k ) || !_finite( k*n, B ) ){
+    _infsup( m, n, k, A, B, C );
+    return;
+  }
+
+  std::vector<double> MA( A, A+m*k ), MB( k*n ), RB( k*n );
+  bool midrad;
+  { Interval::Verified scope;
+    _convert( k*n, B, &MB[0], &RB[0] );
+    midrad = _midrad( m, n, k, &MA[0], 0, &MB[0], &RB[0], C ); }
+  if( !midrad ) _infsup( m, n, k, A, B, C );
+}
+
+} // namespace mc
+
+#endif
@@ -0,0 +1,694 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_INTERVALPACK Packed Interval Arithmetic for Batches of Boxes
+\author Beno&icirc;t Chachuat
+
+Many applications of interval arithmetic evaluate the same factorable function on a large number of boxes, e.g. when computing bounds on a grid of subdomains as in the examples <tt>MC-2D</tt> and <tt>SB-2D</tt>, or when processing the nodes of a branch-and-bound tree. With mc::Interval, these boxes are processed one at a time, and the interval product, which selects its bounds among four real products, does not lend itself to vectorization by the compiler.
+
+The class mc::IntervalPack provides a packed interval type, which holds <tt>W</tt> intervals, or lanes, with their lower and upper bounds stored in two separate arrays (structure-of-arrays layout). The arithmetic operations and functions are applied lane by lane, so that one evaluation of a factorable function in mc::IntervalPack<W> arithmetic produces the same bounds as <tt>W</tt> evaluations in mc::Interval arithmetic. The sum, difference, product, square and inverse are implemented without branching on the signs of the bounds; in particular, the product takes the minimum and maximum of the four products of the bounds in every lane. These operations use AVX/AVX2 or AVX-512 intrinsics when the code is compiled with the corresponding instruction sets enabled (e.g., with the flag <tt>-mavx2</tt> or <tt>-march=native</tt> of GCC), and plain loops otherwise. The other functions are applied lane by lane using their implementation in mc::Interval. Like mc::Interval, mc::IntervalPack is <B>not a verified implementation</B>.
+
+mc::IntervalPack can be used as the template parameter of other classes of MC++, e.g. mc::McCormick<mc::IntervalPack<W>> or mc::TModel<mc::IntervalPack<W>>, for which a specialization of mc::Op is provided. Since the relaxations and polynomial coefficients of these classes are real-valued, the queries <tt>mc::Op::l</tt>, <tt>mc::Op::u</tt>, <tt>mc::Op::mid</tt>, <tt>mc::Op::diam</tt> and <tt>mc::Op::abs</tt> refer to the hull of the lanes, and the inclusion tests of mc::Op hold when they hold in every lane. The interval bounds propagated by these classes remain lane-wise.
+
+
+\section sec_INTERVALPACK_use How do I compute interval bounds on a batch of boxes?
+
+Suppose we want to calculate bounds on the range of the real-valued function \f$f(x,y)=x(\exp(x)-y)^2\f$ on the four boxes of a \f$2\times 2\f$ grid on \f$[-2,1]^2\f$. The relevant header file and type are:
+
+\code
+      #include "intervalpack.hpp"
+      typedef mc::Interval I;
+      typedef mc::IntervalPack<4> IP;
+\endcode
+
+The variables are defined lane by lane, either from an mc::Interval or from a pair of bounds:
+
+\code
+      IP X, Y;
+      for( unsigned int i=0; i<2; i++ )
+        for( unsigned int j=0; j<2; j++ ){
+          X.set( 2*i+j, I( -2.+1.5*i, -0.5+1.5*i ) );
+          Y.set( 2*i+j, I( -2.+1.5*j, -0.5+1.5*j ) );
+        }
+\endcode
+
+The bounds on the range of \f$f\f$ on the four boxes are then calculated and displayed as
+
+\code
+      IP F = X*pow(exp(X)-Y,2);
+      for( unsigned int k=0; k<4; k++ )
+        std::cout << "F bounds on box " << k << ": " << F[k] << std::endl;
+\endcode
+
+
+\section sec_INTERVALPACK_err What errors can I encounter when using mc::IntervalPack?
+
+Errors are managed based on the exception handling mechanism of the C++ language. The errors are the same as those of mc::Interval, and an object of type mc::Interval::Exceptions is thrown as soon as an error occurs in any of the lanes; e.g., when the inverse is taken of a packed interval that contains zero in one of its lanes.
+
+*/
+
+#ifndef MC__INTERVALPACK_HPP
+#define MC__INTERVALPACK_HPP
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#if defined(__AVX__) || defined(__AVX512F__)
+  #include <immintrin.h>
+#endif
+#include "interval.hpp"
+
+namespace mc
+{
+
+//! @brief C++ class for packed interval arithmetic on <tt>W</tt> intervals at once
+////////////////////////////////////////////////////////////////////////
+//! mc::IntervalPack is a C++ class holding <tt>W</tt> intervals in
+//! structure-of-arrays layout, whose arithmetic applies the operations
+//! of mc::Interval lane by lane.
+////////////////////////////////////////////////////////////////////////
+template <unsigned int W>
+class IntervalPack
+////////////////////////////////////////////////////////////////////////
+{
+  template <unsigned int N> friend IntervalPack<N> operator-
+    ( const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> operator+
+    ( const double, const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> operator+
+    ( const IntervalPack<N>&, const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> operator-
+    ( const double, const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> operator-
+    ( const IntervalPack<N>&, const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> operator*
+    ( const double, const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> operator*
+    ( const IntervalPack<N>&, const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> operator/
+    ( const IntervalPack<N>&, const double );
+  template <unsigned int N> friend IntervalPack<N> inv
+    ( const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> sqr
+    ( const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> exp
+    ( const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> hull
+    ( const IntervalPack<N>&, const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> min
+    ( const IntervalPack<N>&, const IntervalPack<N>& );
+  template <unsigned int N> friend IntervalPack<N> max
+    ( const IntervalPack<N>&, const IntervalPack<N>& );
+  template <unsigned int N> friend bool inter
+    ( IntervalPack<N>&, const IntervalPack<N>&, const IntervalPack<N>& );
+  template <unsigned int N> friend bool operator==
+    ( const IntervalPack<N>&, const IntervalPack<N>& );
+  template <unsigned int N> friend bool operator<=
+    ( const IntervalPack<N>&, const IntervalPack<N>& );
+  template <unsigned int N> friend bool operator<
+    ( const IntervalPack<N>&, const IntervalPack<N>& );
+
+public:
+
+  //! @brief Exceptions of mc::IntervalPack, the same as those of mc::Interval
+  typedef Interval::Exceptions Exceptions;
+
+  //! @brief Number of lanes
+  static const unsigned int width = W;
+
+  //! @brief Default constructor (needed for arrays of mc::IntervalPack elements)
+  IntervalPack()
+    {}
+  //! @brief Constructor for a constant value <a>c</a> in all the lanes
+  IntervalPack
+    ( const double c )
+    { std::fill( _l, _l+W, c ); std::fill( _u, _u+W, c ); }
+  //! @brief Constructor for the interval [<a>l</a>,<a>u</a>] in all the lanes
+  IntervalPack
+    ( const double l, const double u )
+    { std::fill( _l, _l+W, std::min(l,u) ); std::fill( _u, _u+W, std::max(l,u) ); }
+  //! @brief Constructor for the interval <a>I</a> in all the lanes
+  IntervalPack
+    ( const Interval&I )
+    { std::fill( _l, _l+W, I.l() ); std::fill( _u, _u+W, I.u() ); }
+
+  IntervalPack<W>& operator=
+    ( const double c )
+    { return *this = IntervalPack<W>( c ); }
+  IntervalPack<W>& operator+=
+    ( const IntervalPack<W>&I )
+    { return *this = *this + I; }
+  IntervalPack<W>& operator-=
+    ( const IntervalPack<W>&I )
+    { return *this = *this - I; }
+  IntervalPack<W>& operator*=
+    ( const IntervalPack<W>&I )
+    { return *this = *this * I; }
+  IntervalPack<W>& operator/=
+    ( const IntervalPack<W>&I )
+    { return *this = *this / I; }
+
+  //! @brief Interval in lane <a>i</a>
+  Interval operator[]
+    ( const unsigned int i ) const
+    { return Interval( _l[i], _u[i] ); }
+  //! @brief Set the interval in lane <a>i</a> to <a>I</a>
+  void set
+    ( const unsigned int i, const Interval&I )
+    { _l[i] = I.l(); _u[i] = I.u(); }
+  //! @brief Lower bound in lane <a>i</a>
+  double l
+    ( const unsigned int i ) const
+    { return _l[i]; }
+  //! @brief Upper bound in lane <a>i</a>
+  double u
+    ( const unsigned int i ) const
+    { return _u[i]; }
+  //! @brief Lower bound of the hull of all the lanes
+  double l() const
+    { return *std::min_element( _l, _l+W ); }
+  //! @brief Upper bound of the hull of all the lanes
+  double u() const
+    { return *std::max_element( _u, _u+W ); }
+
+  //! @brief Apply the univariate function <a>f</a> of mc::Interval in every lane of <a>I</a>
+  static IntervalPack<W> apply
+    ( const IntervalPack<W>&I, Interval (*f)( const Interval& ) )
+    {
+      IntervalPack<W> I2;
+      for( unsigned int i=0; i<W; i++ ) I2.set( i, f( I[i] ) );
+      return I2;
+    }
+  //! @brief Apply the function <a>f</a> of mc::Interval with real parameter <a>a</a> in every lane of <a>I</a>
+  template <typename U> static IntervalPack<W> apply
+    ( const IntervalPack<W>&I, const U a, Interval (*f)( const Interval&, const U ) )
+    {
+      IntervalPack<W> I2;
+      for( unsigned int i=0; i<W; i++ ) I2.set( i, f( I[i], a ) );
+      return I2;
+    }
+
+private:
+
+  //! @brief Lower bounds
+  double _l[W];
+  //! @brief Upper bounds
+  double _u[W];
+
+  //! @brief Lane-wise product [<a>l</a>,<a>u</a>] of [<a>l1</a>,<a>u1</a>] and [<a>l2</a>,<a>u2</a>], as the minimum and maximum of the four products of bounds
+  static void _mul
+    ( const double*l1, const double*u1, const double*l2, const double*u2,
+      double*l, double*u );
+};
+
+////////////////////////////////////////////////////////////////////////
+
+template <unsigned int W> inline void
+IntervalPack<W>::_mul
+( const double*l1, const double*u1, const double*l2, const double*u2,
+  double*l, double*u )
+{
+  unsigned int i = 0;
+#ifdef __AVX512F__
+  for( ; i+8<=W; i+=8 ){
+    const __m512d a = _mm512_loadu_pd( l1+i ), b = _mm512_loadu_pd( u1+i ),
+                  c = _mm512_loadu_pd( l2+i ), d = _mm512_loadu_pd( u2+i );
+    const __m512d p1 = _mm512_mul_pd( a, c ), p2 = _mm512_mul_pd( a, d ),
+                  p3 = _mm512_mul_pd( b, c ), p4 = _mm512_mul_pd( b, d );
+    _mm512_storeu_pd( l+i, _mm512_min_pd( _mm512_min_pd( p1, p2 ), _mm512_min_pd( p3, p4 ) ) );
+    _mm512_storeu_pd( u+i, _mm512_max_pd( _mm512_max_pd( p1, p2 ), _mm512_max_pd( p3, p4 ) ) );
+  }
+#endif
+#ifdef __AVX__
+  for( ; i+4<=W; i+=4 ){
+    const __m256d a = _mm256_loadu_pd( l1+i ), b = _mm256_loadu_pd( u1+i ),
+                  c = _mm256_loadu_pd( l2+i ), d = _mm256_loadu_pd( u2+i );
+    const __m256d p1 = _mm256_mul_pd( a, c ), p2 = _mm256_mul_pd( a, d ),
+                  p3 = _mm256_mul_pd( b, c ), p4 = _mm256_mul_pd( b, d );
+    _mm256_storeu_pd( l+i, _mm256_min_pd( _mm256_min_pd( p1, p2 ), _mm256_min_pd( p3, p4 ) ) );
+    _mm256_storeu_pd( u+i, _mm256_max_pd( _mm256_max_pd( p1, p2 ), _mm256_max_pd( p3, p4 ) ) );
+  }
+#endif
+  for( ; i<W; i++ ){
+    const double p1 = l1[i]*l2[i], p2 = l1[i]*u2[i], p3 = u1[i]*l2[i], p4 = u1[i]*u2[i];
+    l[i] = std::min( std::min( p1, p2 ), std::min( p3, p4 ) );
+    u[i] = std::max( std::max( p1, p2 ), std::max( p3, p4 ) );
+  }
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator+
+( const IntervalPack<W>&I )
+{
+  return I;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator-
+( const IntervalPack<W>&I )
+{
+  IntervalPack<W> I2;
+  for( unsigned int i=0; i<W; i++ ){ I2._l[i] = -I._u[i]; I2._u[i] = -I._l[i]; }
+  return I2;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator+
+( const double c, const IntervalPack<W>&I )
+{
+  IntervalPack<W> I2;
+  for( unsigned int i=0; i<W; i++ ){ I2._l[i] = c + I._l[i]; I2._u[i] = c + I._u[i]; }
+  return I2;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator+
+( const IntervalPack<W>&I, const double c )
+{
+  return c + I;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator+
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  IntervalPack<W> I3;
+  for( unsigned int i=0; i<W; i++ ){ I3._l[i] = I1._l[i] + I2._l[i]; I3._u[i] = I1._u[i] + I2._u[i]; }
+  return I3;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator-
+( const double c, const IntervalPack<W>&I )
+{
+  IntervalPack<W> I2;
+  for( unsigned int i=0; i<W; i++ ){ I2._l[i] = c - I._u[i]; I2._u[i] = c - I._l[i]; }
+  return I2;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator-
+( const IntervalPack<W>&I, const double c )
+{
+  return (-c) + I;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator-
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  IntervalPack<W> I3;
+  for( unsigned int i=0; i<W; i++ ){ I3._l[i] = I1._l[i] - I2._u[i]; I3._u[i] = I1._u[i] - I2._l[i]; }
+  return I3;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator*
+( const double c, const IntervalPack<W>&I )
+{
+  IntervalPack<W> I2;
+  if( c >= 0 )
+    for( unsigned int i=0; i<W; i++ ){ I2._l[i] = c*I._l[i]; I2._u[i] = c*I._u[i]; }
+  else
+    for( unsigned int i=0; i<W; i++ ){ I2._l[i] = c*I._u[i]; I2._u[i] = c*I._l[i]; }
+  return I2;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator*
+( const IntervalPack<W>&I, const double c )
+{
+  return c * I;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator*
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  IntervalPack<W> I3;
+  IntervalPack<W>::_mul( I1._l, I1._u, I2._l, I2._u, I3._l, I3._u );
+  return I3;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator/
+( const IntervalPack<W>&I, const double c )
+{
+  if( isequal(c,0.) ) throw typename IntervalPack<W>::Exceptions( Interval::Exceptions::DIV );
+  return (1./c)*I;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator/
+( const double c, const IntervalPack<W>&I )
+{
+  return c*inv(I);
+}
+
+template <unsigned int W> inline IntervalPack<W>
+operator/
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  return I1*inv(I2);
+}
+
+template <unsigned int W> inline double
+diam
+( const IntervalPack<W> &I )
+{
+  return I.u()-I.l();
+}
+
+template <unsigned int W> inline double
+mid
+( const IntervalPack<W> &I )
+{
+  return 0.5*(I.u()+I.l());
+}
+
+template <unsigned int W> inline double
+abs
+( const IntervalPack<W> &I )
+{
+  return std::max(std::fabs(I.l()),std::fabs(I.u()));
+}
+
+template <unsigned int W> inline IntervalPack<W>
+inv
+( const IntervalPack<W> &I )
+{
+  // Zero in any lane is detected without branching in the loop
+  bool zero = false;
+  for( unsigned int i=0; i<W; i++ ) zero |= ( I._l[i] <= 0. && I._u[i] >= 0. );
+  if( zero ) throw typename IntervalPack<W>::Exceptions( Interval::Exceptions::INV );
+  IntervalPack<W> I2;
+  for( unsigned int i=0; i<W; i++ ){ I2._l[i] = 1./I._u[i]; I2._u[i] = 1./I._l[i]; }
+  return I2;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+sqr
+( const IntervalPack<W>&I )
+{
+  // The lower bound is zero in the lanes containing zero, and the square of the bound closest to zero otherwise
+  IntervalPack<W> I2;
+  for( unsigned int i=0; i<W; i++ ){
+    const double m = std::max( 0., std::max( I._l[i], -I._u[i] ) );
+    I2._l[i] = m*m;
+    I2._u[i] = std::max( I._l[i]*I._l[i], I._u[i]*I._u[i] );
+  }
+  return I2;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+exp
+( const IntervalPack<W> &I )
+{
+  IntervalPack<W> I2;
+  for( unsigned int i=0; i<W; i++ ){ I2._l[i] = std::exp(I._l[i]); I2._u[i] = std::exp(I._u[i]); }
+  return I2;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+arh
+( const IntervalPack<W> &I, const double a )
+{
+  return exp(-a/I);
+}
+
+template <unsigned int W> inline IntervalPack<W>
+log
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::log );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+xlog
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::xlog );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+erf
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::erf );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+erfc
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::erfc );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+sqrt
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::sqrt );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+fabs
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::fabs );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+cos
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::cos );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+sin
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::sin );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+tan
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::tan );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+acos
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::acos );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+asin
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::asin );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+atan
+( const IntervalPack<W> &I )
+{
+  return IntervalPack<W>::apply( I, mc::atan );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+pow
+( const IntervalPack<W>&I, const int n )
+{
+  if( n == 2 ) return sqr( I );
+  return IntervalPack<W>::apply( I, n, mc::pow );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+pow
+( const IntervalPack<W>&I, const double a )
+{
+  return exp( a * log( I ) );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+pow
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  return exp( I2 * log( I1 ) );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+monomial
+(const unsigned int n, const IntervalPack<W>*I, const int*k)
+{
+  if( n == 0 ){
+    return 1.;
+  }
+  if( n == 1 ){
+    return pow( I[0], k[0] );
+  }
+  return pow( I[0], k[0] ) * monomial( n-1, I+1, k+1 );
+}
+
+template <unsigned int W> inline IntervalPack<W>
+hull
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  IntervalPack<W> I3;
+  for( unsigned int i=0; i<W; i++ ){
+    I3._l[i] = std::min( I1._l[i], I2._l[i] ); I3._u[i] = std::max( I1._u[i], I2._u[i] );
+  }
+  return I3;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+min
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  IntervalPack<W> I3;
+  for( unsigned int i=0; i<W; i++ ){
+    I3._l[i] = std::min( I1._l[i], I2._l[i] ); I3._u[i] = std::min( I1._u[i], I2._u[i] );
+  }
+  return I3;
+}
+
+template <unsigned int W> inline IntervalPack<W>
+max
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  IntervalPack<W> I3;
+  for( unsigned int i=0; i<W; i++ ){
+    I3._l[i] = std::max( I1._l[i], I2._l[i] ); I3._u[i] = std::max( I1._u[i], I2._u[i] );
+  }
+  return I3;
+}
+
+template <unsigned int W> inline std::ostream&
+operator<<
+( std::ostream&out, const IntervalPack<W>&I)
+{
+  out << "{ ";
+  for( unsigned int i=0; i<W; i++ ) out << I[i] << " ";
+  return out << "}";
+}
+
+template <unsigned int W> inline bool
+inter
+( IntervalPack<W> &XIY, const IntervalPack<W> &X, const IntervalPack<W> &Y )
+{
+  // Empty intersection in any lane leaves XIY unchanged
+  bool empty = false;
+  for( unsigned int i=0; i<W; i++ ) empty |= ( X._l[i] > Y._u[i] || Y._l[i] > X._u[i] );
+  if( empty ) return false;
+  for( unsigned int i=0; i<W; i++ ){
+    XIY._l[i] = std::max( X._l[i], Y._l[i] ); XIY._u[i] = std::min( X._u[i], Y._u[i] );
+  }
+  return true;
+}
+
+template <unsigned int W> inline bool
+operator==
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  for( unsigned int i=0; i<W; i++ )
+    if( I1._l[i] != I2._l[i] || I1._u[i] != I2._u[i] ) return false;
+  return true;
+}
+
+template <unsigned int W> inline bool
+operator!=
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  return !( I1 == I2 );
+}
+
+template <unsigned int W> inline bool
+operator<=
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  for( unsigned int i=0; i<W; i++ )
+    if( I1._l[i] < I2._l[i] || I1._u[i] > I2._u[i] ) return false;
+  return true;
+}
+
+template <unsigned int W> inline bool
+operator>=
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  return I2 <= I1;
+}
+
+template <unsigned int W> inline bool
+operator<
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  for( unsigned int i=0; i<W; i++ )
+    if( I1._l[i] <= I2._l[i] || I1._u[i] >= I2._u[i] ) return false;
+  return true;
+}
+
+template <unsigned int W> inline bool
+operator>
+( const IntervalPack<W>&I1, const IntervalPack<W>&I2 )
+{
+  return I2 < I1;
+}
+
+} // namespace mc
+
+#include "mcop.hpp"
+
+namespace mc
+{
+
+//! @brief Specialization of the structure mc::Op to allow usage of the type mc::IntervalPack as a template parameter in the classes mc::McCormick, mc::TModel and mc::TVar, with real-valued queries referring to the hull of the lanes
+template <unsigned int W> struct Op< mc::IntervalPack<W> >
+{
+  typedef mc::IntervalPack<W> T;
+  static T point( const double c ) { return T(c); }
+  static T zeroone() { return T(0.,1.); }
+  static void I(T& x, const T&y) { x = y; }
+  static double l(const T& x) { return x.l(); }
+  static double u(const T& x) { return x.u(); }
+  static double abs (const T& x) { return mc::abs(x);  }
+  static double mid (const T& x) { return mc::mid(x);  }
+  static double diam(const T& x) { return mc::diam(x); }
+  static T inv (const T& x) { return mc::inv(x);  }
+  static T sqr (const T& x) { return mc::sqr(x);  }
+  static T sqrt(const T& x) { return mc::sqrt(x); }
+  static T log (const T& x) { return mc::log(x);  }
+  static T xlog(const T& x) { return mc::xlog(x); }
+  static T fabs(const T& x) { return mc::fabs(x); }
+  static T exp (const T& x) { return mc::exp(x);  }
+  static T sin (const T& x) { return mc::sin(x);  }
+  static T cos (const T& x) { return mc::cos(x);  }
+  static T tan (const T& x) { return mc::tan(x);  }
+  static T asin(const T& x) { return mc::asin(x); }
+  static T acos(const T& x) { return mc::acos(x); }
+  static T atan(const T& x) { return mc::atan(x); }
+  static T erf (const T& x) { return mc::erf(x);  }
+  static T erfc(const T& x) { return mc::erfc(x); }
+  static T hull(const T& x, const T& y) { return mc::hull(x,y); }
+  static T min (const T& x, const T& y) { return mc::min(x,y);  }
+  static T max (const T& x, const T& y) { return mc::max(x,y);  }
+  static T arh (const T& x, const double k) { return mc::arh(x,k); }
+  template <typename X, typename Y> static T pow(const X& x, const Y& y) { return mc::pow(x,y); }
+  static T monomial (const unsigned int n, const T* x, const int* k) { return mc::monomial(n,x,k); }
+  static bool inter(T& xIy, const T& x, const T& y) { return mc::inter(xIy,x,y); }
+  static bool eq(const T& x, const T& y) { return x==y; }
+  static bool ne(const T& x, const T& y) { return x!=y; }
+  static bool lt(const T& x, const T& y) { return x<y;  }
+  static bool le(const T& x, const T& y) { return x<=y; }
+  static bool gt(const T& x, const T& y) { return x>y;  }
+  static bool ge(const T& x, const T& y) { return x>=y; }
+};
+
+} // namespace mc
+
+#endif
@@ -0,0 +1,847 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_ITTAPE Interval Taylor Coefficients on a Contiguous Tape
+\author Beno&icirc;t Chachuat
+
+Bounds on the Taylor coefficients of a factorable function, such as the right-hand side of an ordinary differential equation (ODE), are commonly computed with the class <tt>fadbad::T</tt> of FADBAD++ [Bendtsen & Stauning, 1996] in interval arithmetic. Each elementary operation then allocates a node on the heap, which holds an array of interval objects for the coefficients of all orders, and the coefficients are propagated with the generic interval operators, one product at a time. For the high orders (20 and above) needed by Taylor-based ODE bounding methods, the time spent in memory allocation and in these generic operators dominates the arithmetic.
+
+The classes mc::ITTape and mc::ITVar record the elementary operations of a factorable function on a tape, then propagate the Taylor coefficients of every entry on that tape with the usual recurrences of automatic differentiation [Griewank & Walther, 2008]. The lower and upper bounds of the coefficients of all orders and entries are stored in two contiguous arrays of <tt>double</tt>. The Cauchy products that appear in these recurrences, \f$\sum_{j} u_j\,w_{k-j}\f$, are computed in two passes: the first pass computes the interval products of all pairs of coefficients as the minimum and maximum of four real products, in a loop that the compiler can vectorize; the second pass adds up these products in the interval arithmetic <tt>T</tt>. Besides these sums, only the division by the zeroth-order coefficient at the end of a recurrence, and the zeroth-order coefficients themselves, are computed in <tt>T</tt>. The template parameter <tt>T</tt> can be any of the interval types supported by MC++, namely mc::Interval and the interval types of PROFIL or FILIB++ through the specializations in <tt>mcprofil.hpp</tt> and <tt>mcfilib.hpp</tt>. The bounds of the products of the first pass are computed in the current rounding mode, and their sum is widened by an a priori bound on their rounding errors, which holds in any rounding mode, so that the coefficients are verified whenever the arithmetic of <tt>T</tt> is, e.g. in the scope of an object of type mc::Interval::Verified, without any particular compiler flags.
+
+The tape keeps its memory when it is reset, so recording the same function repeatedly does not allocate memory after the first evaluation. The coefficients of an entry do not depend on those of the entries recorded after it, so the coefficients of order \f$k\f$ of the independent variables may be set after the coefficients of order \f$k-1\f$ of the dependents have been computed, as required by the Taylor series expansion of an ODE solution.
+
+
+\section sec_ITTAPE_use How do I compute Taylor coefficients of the solution of an ODE with mc::ITTape?
+
+Suppose we want to compute interval bounds on the Taylor coefficients, up to order 20, of the solutions of the ODE system \f$\dot x_0 = x_0\,(1-x_1), \dot x_1 = -x_1\,(1-x_0)\f$ with initial values in \f$[0.9,1]\times[1,1.1]\f$. The relevant header files are:
+
+\code
+      #include "interval.hpp"
+      #include "ittape.hpp"
+      typedef mc::Interval I;
+\endcode
+
+The tape is constructed for a maximal order of 20, after which the states are recorded as independent variables with their initial values, and the right-hand side is recorded using variables of type mc::ITVar:
+
+\code
+      const unsigned int NORD = 20;
+      mc::ITTape<I> tape( NORD );
+      mc::ITVar<I> X[2] = { tape.var( I(0.9,1.) ), tape.var( I(1.,1.1) ) };
+      mc::ITVar<I> F[2] = { X[0]*(1.-X[1]), -X[1]*(1.-X[0]) };
+\endcode
+
+The Taylor coefficients of order \f$k+1\f$ of the states are obtained from the coefficients of order \f$k\f$ of the right-hand side:
+
+\code
+      for( unsigned int k=0; k<NORD; k++ ){
+        tape.eval( k );
+        for( unsigned int i=0; i<2; i++ )
+          tape.set( X[i], k+1, tape.coef( F[i], k ) / (k+1.) );
+      }
+      for( unsigned int k=0; k<=NORD; k++ )
+        std::cout << "X0[" << k << "] = " << tape.coef( X[0], k ) << std::endl;
+\endcode
+
+Setting a coefficient of order \f$k\f$ invalidates the coefficients of order \f$k\f$ and above of all the entries, which are recomputed by the next call to <tt>eval</tt>. In particular, the coefficients for another box of initial values are obtained by setting the zeroth-order coefficients of the states to their new values and repeating the above loop, without recording the right-hand side again.
+
+
+\section sec_ITTAPE_err What errors can I encounter when using mc::ITTape?
+
+Errors are managed based on the exception handling mechanism of the C++ language. Each time an error is encountered, a class object of type mc::ITTape::Exceptions is thrown, which contains the type of error. Possible errors are:
+
+<TABLE border="1">
+<CAPTION><EM>Errors during Taylor Coefficient Propagation with mc::ITTape</EM></CAPTION>
+     <TR><TH><b>Number</b> <TD><b>Description</b>
+     <TR><TH><tt>-1</tt> <TD>Operation between variables recorded on different tapes
+     <TR><TH><tt>-2</tt> <TD>Variable not recorded on the current tape or not an independent variable
+     <TR><TH><tt>-3</tt> <TD>Taylor coefficient of order greater than the maximal order or not yet evaluated
+     <TR><TH><tt>-33</tt> <TD>Feature not yet implemented in mc::ITTape
+</TABLE>
+
+Moreover, exceptions of the interval type <tt>T</tt> may be thrown during the evaluation of the zeroth-order coefficients or the division by the zeroth-order coefficient of an operand, e.g. when the latter contains zero.
+
+
+\section sec_ITTAPE_refs References
+
+- Bendtsen, C., and O. Stauning, <A href="http://www.fadbad.com/download/fadbad.ps.gz">FADBAD, a flexible C++ package for automatic differentiation</A>, Technical Report IMM-REP-1996-17, Technical University of Denmark, 1996.
+- Griewank, A., and A. Walther, <I><A href="http://dx.doi.org/10.1137/1.9780898717761">Evaluating Derivatives: Principles and Techniques of Algorithmic Differentiation</A></I>, 2nd Edition, SIAM, 2008.
+- Nedialkov, N.S., K.R. Jackson, and G.F. Corliss, <A href="http://dx.doi.org/10.1016/S0096-3003(98)10083-8">Validated solutions of initial value problems for ordinary differential equations</A>, <I>Applied Mathematics and Computation</I>, <b>105</b>(1):21-68, 1999.
+.
+
+*/
+
+#ifndef MC__ITTAPE_HPP
+#define MC__ITTAPE_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "mcop.hpp"
+
+namespace mc
+{
+
+template <typename T> class ITVar;
+
+//! @brief C++ class propagating interval Taylor coefficients of factorable functions recorded on a contiguous tape
+////////////////////////////////////////////////////////////////////////
+//! mc::ITTape is a C++ class recording the elementary operations of a
+//! factorable function on a contiguous tape, in order to compute
+//! bounds on its Taylor coefficients up to a given maximal order in
+//! the interval arithmetic <tt>T</tt>.
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class ITTape
+////////////////////////////////////////////////////////////////////////
+{
+  friend class ITVar<T>;
+
+public:
+
+  //! @brief Exceptions of mc::ITTape
+  class Exceptions
+  {
+  public:
+    //! @brief Enumeration type for ITTape exception handling
+    enum TYPE{
+      TAPE=-1,	//!< Operation between variables recorded on different tapes
+      INDEX=-2,	//!< Variable not recorded on the current tape or not an independent variable
+      ORDER=-3,	//!< Taylor coefficient of order greater than the maximal order or not yet evaluated
+      UNDEF=-33 //!< Feature not yet implemented in mc::ITTape
+    };
+    //! @brief Constructor for error <a>ierr</a>
+    Exceptions( TYPE ierr ) : _ierr( ierr ){}
+    //! @brief Inline function returning the error flag
+    int ierr(){ return _ierr; }
+    //! @brief Error description
+    std::string what(){
+      switch( _ierr ){
+      case TAPE:
+        return "mc::ITTape\t Operation between variables recorded on different tapes";
+      case INDEX:
+        return "mc::ITTape\t Variable not recorded on the current tape or not an independent variable";
+      case ORDER:
+        return "mc::ITTape\t Taylor coefficient of order greater than the maximal order or not yet evaluated";
+      case UNDEF:
+        return "mc::ITTape\t Feature not yet implemented in mc::ITTape class";
+      default:
+        return "mc::ITTape\t Undocumented error";
+      }
+    }
+
+  private:
+    TYPE _ierr;
+  };
+
+  //! @brief Enumeration type for the opcodes of the operations recorded on the tape
+  enum OPCODE{
+    VAR=0,	//!< Independent variable
+    ADD,	//!< Sum of two variables
+    SUB,	//!< Difference of two variables
+    MUL,	//!< Product of two variables
+    DIV,	//!< Ratio of two variables
+    ADDC,	//!< Sum of a variable and a constant
+    CSUB,	//!< Difference of a constant and a variable
+    MULC,	//!< Product of a variable and a constant
+    DIVC,	//!< Ratio of a variable and a constant
+    CDIV,	//!< Ratio of a constant and a variable
+    NEG,	//!< Opposite of a variable
+    SQR,	//!< Square of a variable
+    SQRT,	//!< Square root of a variable
+    EXP,	//!< Exponential of a variable
+    LOG,	//!< Natural logarithm of a variable
+    SIN,	//!< Sine of a variable, with the cosine of the same variable as second operand
+    COS,	//!< Cosine of a variable, with the sine of the same variable as second operand
+    ASIN,	//!< Arcsine of a variable, with the square root of one minus its square as second operand
+    ACOS,	//!< Arccosine of a variable, with the square root of one minus its square as second operand
+    ATAN	//!< Arctangent of a variable, with one plus its square as second operand
+  };
+
+  //! @brief Constructor for Taylor coefficients up to order <a>nord</a>
+  ITTape
+    ( const unsigned int nord ):
+    _nord(nord), _size(0), _neval(0), _wL(nord+1), _wU(nord+1), _jdx(nord+1)
+    { for( unsigned int j=0; j<=nord; j++ ) _jdx[j] = j; }
+
+  //! @brief Record a new independent variable with zeroth-order coefficient <a>X</a> and higher-order coefficients equal to zero
+  ITVar<T> var
+    ( const T&X );
+
+  //! @brief Set the Taylor coefficient of order <a>k</a> of the independent variable <a>X</a> to <a>C</a>
+  void set
+    ( const ITVar<T>&X, const unsigned int k, const T&C );
+
+  //! @brief Compute the Taylor coefficients of all the entries on the tape up to order <a>k</a>
+  void eval
+    ( const unsigned int k );
+
+  //! @brief Taylor coefficient of order <a>k</a> of the variable <a>X</a>
+  T coef
+    ( const ITVar<T>&X, const unsigned int k ) const;
+
+  //! @brief Reset the tape, keeping the memory allocated for its entries
+  void reset()
+    { _size = _neval = 0; }
+
+  //! @brief Maximal order of the Taylor coefficients
+  unsigned int nord() const
+    { return _nord; }
+
+  //! @brief Number of entries on the tape
+  unsigned int size() const
+    { return _size; }
+
+private:
+
+  //! @brief Structure storing the opcode, operands and real constant of a tape entry
+  struct t_node{
+    OPCODE op;
+    unsigned int a1;
+    unsigned int a2;
+    double c;
+  };
+
+  //! @brief Maximal order of the Taylor coefficients
+  const unsigned int _nord;
+  //! @brief Entries recorded on the tape, valid up to index <tt>_size</tt>
+  std::vector<t_node> _node;
+  //! @brief Lower bounds of the Taylor coefficients, by entry then by order
+  std::vector<double> _L;
+  //! @brief Upper bounds of the Taylor coefficients, by entry then by order
+  std::vector<double> _U;
+  //! @brief Number of entries recorded on the tape
+  unsigned int _size;
+  //! @brief Number of orders of the Taylor coefficients computed for all the entries
+  unsigned int _neval;
+  //! @brief Lower bounds of the products in a Cauchy sum
+  std::vector<double> _wL;
+  //! @brief Upper bounds of the products in a Cauchy sum
+  std::vector<double> _wU;
+  //! @brief Indices 0,...,<tt>_nord</tt> as real weights
+  std::vector<double> _jdx;
+
+  //! @brief Record a new entry with opcode <a>op</a>, operands <a>a1</a> and <a>a2</a> and constant <a>c</a>
+  ITVar<T> _record
+    ( const OPCODE op, const unsigned int a1, const unsigned int a2=0,
+      const double c=0. );
+
+  //! @brief Taylor coefficient of order <a>k</a> of entry <a>i</a>
+  T _get
+    ( const unsigned int i, const unsigned int k ) const
+    { const unsigned int ik = i*(_nord+1)+k; return T( _L[ik], _U[ik] ); }
+
+  //! @brief Set the Taylor coefficient of order <a>k</a> of entry <a>i</a> to <a>C</a>
+  void _put
+    ( const unsigned int i, const unsigned int k, const T&C )
+    { const unsigned int ik = i*(_nord+1)+k; _L[ik] = Op<T>::l(C); _U[ik] = Op<T>::u(C); }
+
+  //! @brief Bounds on the Cauchy sum \f$\sum_{j=j_0}^{j_1} u_j\,w_{k-j}\f$, with <a>u</a> and <a>w</a> the coefficients of entries <a>iu</a> and <a>iw</a>, and with \f$u_j\f$ weighted by \f$j\f$ if <a>wgt</a> is true
+  T _cauchy
+    ( const unsigned int iu, const unsigned int iw, const unsigned int j0,
+      const unsigned int j1, const unsigned int k, const bool wgt );
+
+  //! @brief Bounds on the Cauchy sum \f$\sum_{j=j_0}^{k-j_0} u_j\,u_{k-j}\f$ of the coefficients of entry <a>iu</a>
+  T _symcauchy
+    ( const unsigned int iu, const unsigned int j0, const unsigned int k );
+
+  //! @brief Compute the Taylor coefficient of order <a>k</a> of entry <a>i</a>
+  void _eval
+    ( const unsigned int i, const unsigned int k );
+
+  //! @brief Private copy constructor (the variables recorded on a tape hold pointers to it)
+  ITTape
+    ( const ITTape<T>& );
+  //! @brief Private assignment operator
+  ITTape<T>& operator=
+    ( const ITTape<T>& );
+};
+
+//! @brief C++ class for variables recorded on a tape of type mc::ITTape
+////////////////////////////////////////////////////////////////////////
+//! mc::ITVar is a C++ class for the variables of a factorable function
+//! recorded on a tape of type mc::ITTape. A variable not attached to
+//! any tape is a passive real constant.
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class ITVar
+////////////////////////////////////////////////////////////////////////
+{
+  friend class ITTape<T>;
+
+  template <typename U> friend ITVar<U> operator-
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> operator+
+    ( const ITVar<U>&, const ITVar<U>& );
+  template <typename U> friend ITVar<U> operator+
+    ( const double, const ITVar<U>& );
+  template <typename U> friend ITVar<U> operator-
+    ( const ITVar<U>&, const ITVar<U>& );
+  template <typename U> friend ITVar<U> operator-
+    ( const double, const ITVar<U>& );
+  template <typename U> friend ITVar<U> operator*
+    ( const ITVar<U>&, const ITVar<U>& );
+  template <typename U> friend ITVar<U> operator*
+    ( const double, const ITVar<U>& );
+  template <typename U> friend ITVar<U> operator/
+    ( const ITVar<U>&, const ITVar<U>& );
+  template <typename U> friend ITVar<U> operator/
+    ( const ITVar<U>&, const double );
+  template <typename U> friend ITVar<U> operator/
+    ( const double, const ITVar<U>& );
+  template <typename U> friend ITVar<U> sqr
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> sqrt
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> exp
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> log
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> sin
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> cos
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> tan
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> asin
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> acos
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> atan
+    ( const ITVar<U>& );
+  template <typename U> friend ITVar<U> pow
+    ( const ITVar<U>&, const int );
+
+public:
+
+  typedef typename ITTape<T>::Exceptions Exceptions;
+  typedef typename ITTape<T>::OPCODE OPCODE;
+
+  //! @brief Constructor for passive real constant <a>c</a>
+  ITVar
+    ( const double c=0. ):
+    _tape(0), _ndx(0), _cst(c)
+    {}
+
+  //! @brief Tape on which the variable is recorded (NULL for a passive constant)
+  const ITTape<T>* tape() const
+    { return _tape; }
+
+  //! @brief Taylor coefficient of order <a>k</a> of the variable
+  T operator[]
+    ( const unsigned int k ) const
+    { return _tape? _tape->coef( *this, k ): T( k? 0.: _cst ); }
+
+  ITVar<T>& operator+=
+    ( const ITVar<T>&X )
+    { return *this = *this + X; }
+  ITVar<T>& operator-=
+    ( const ITVar<T>&X )
+    { return *this = *this - X; }
+  ITVar<T>& operator*=
+    ( const ITVar<T>&X )
+    { return *this = *this * X; }
+  ITVar<T>& operator/=
+    ( const ITVar<T>&X )
+    { return *this = *this / X; }
+
+private:
+
+  //! @brief Constructor for entry <a>ndx</a> on tape <a>tape</a>
+  ITVar
+    ( ITTape<T>*tape, const unsigned int ndx ):
+    _tape(tape), _ndx(ndx), _cst(0.)
+    {}
+
+  //! @brief Pointer to the tape (NULL for a passive constant)
+  ITTape<T>* _tape;
+  //! @brief Index of the entry on the tape
+  unsigned int _ndx;
+  //! @brief Value of a passive constant
+  double _cst;
+
+  //! @brief Record a new entry on tape <a>tape</a> (see mc::ITTape::_record)
+  static ITVar<T> _record
+    ( ITTape<T>*tape, const OPCODE op, const unsigned int a1,
+      const unsigned int a2=0, const double c=0. )
+    { return tape->_record( op, a1, a2, c ); }
+
+  //! @brief Common tape of the variables <a>X1</a> and <a>X2</a>
+  static ITTape<T>* _tape_check
+    ( const ITVar<T>&X1, const ITVar<T>&X2 )
+    {
+      if( X1._tape != X2._tape ) throw Exceptions( ITTape<T>::Exceptions::TAPE );
+      return X1._tape;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T> inline ITVar<T>
+ITTape<T>::_record
+( const OPCODE op, const unsigned int a1, const unsigned int a2,
+  const double c )
+{
+  t_node node;
+  node.op = op; node.a1 = a1; node.a2 = a2; node.c = c;
+  if( _size < _node.size() )
+    _node[_size] = node;
+  else{
+    _node.push_back( node );
+    _L.resize( _L.size()+_nord+1 );
+    _U.resize( _U.size()+_nord+1 );
+  }
+  _neval = 0;
+  return ITVar<T>( this, _size++ );
+}
+
+template <typename T> inline ITVar<T>
+ITTape<T>::var
+( const T&X )
+{
+  ITVar<T> V = _record( VAR, 0 );
+  const unsigned int i0 = V._ndx*(_nord+1);
+  _L[i0] = Op<T>::l(X); _U[i0] = Op<T>::u(X);
+  std::fill( _L.begin()+i0+1, _L.begin()+i0+_nord+1, 0. );
+  std::fill( _U.begin()+i0+1, _U.begin()+i0+_nord+1, 0. );
+  return V;
+}
+
+template <typename T> inline void
+ITTape<T>::set
+( const ITVar<T>&X, const unsigned int k, const T&C )
+{
+  if( X._tape != this || X._ndx >= _size || _node[X._ndx].op != VAR )
+    throw Exceptions( Exceptions::INDEX );
+  if( k > _nord )
+    throw Exceptions( Exceptions::ORDER );
+  _put( X._ndx, k, C );
+  if( k < _neval ) _neval = k;
+}
+
+template <typename T> inline T
+ITTape<T>::coef
+( const ITVar<T>&X, const unsigned int k ) const
+{
+  if( X._tape != this || X._ndx >= _size )
+    throw Exceptions( Exceptions::INDEX );
+  if( k >= _neval && _node[X._ndx].op != VAR )
+    throw Exceptions( Exceptions::ORDER );
+  if( k > _nord )
+    throw Exceptions( Exceptions::ORDER );
+  return _get( X._ndx, k );
+}
+
+template <typename T> inline void
+ITTape<T>::eval
+( const unsigned int k )
+{
+  if( k > _nord )
+    throw Exceptions( Exceptions::ORDER );
+  for( ; _neval<=k; _neval++ )
+    for( unsigned int i=0; i<_size; i++ )
+      _eval( i, _neval );
+}
+
+template <typename T> inline T
+ITTape<T>::_cauchy
+( const unsigned int iu, const unsigned int iw, const unsigned int j0,
+  const unsigned int j1, const unsigned int k, const bool wgt )
+{
+  if( j0 > j1 ) return T( 0. );
+  const double *uL = &_L[iu*(_nord+1)], *uU = &_U[iu*(_nord+1)];
+  const double *wL = &_L[iw*(_nord+1)], *wU = &_U[iw*(_nord+1)];
+  double *pL = &_wL[0], *pU = &_wU[0];
+  // Signed indices, so that the reversed access to w does not prevent vectorization
+  const int jb = j0, je = j1, kk = k;
+
+  // Interval products, as the minimum and maximum of four real products
+  if( wgt ){
+    const double *jdx = &_jdx[0];
+    for( int j=jb; j<=je; j++ ){
+      const double ul = jdx[j]*uL[j], uu = jdx[j]*uU[j], wl = wL[kk-j], wu = wU[kk-j];
+      const double p1 = ul*wl, p2 = ul*wu, p3 = uu*wl, p4 = uu*wu;
+      pL[j] = std::min( std::min( p1, p2 ), std::min( p3, p4 ) );
+      pU[j] = std::max( std::max( p1, p2 ), std::max( p3, p4 ) );
+    }
+  }
+  else{
+    for( int j=jb; j<=je; j++ ){
+      const double ul = uL[j], uu = uU[j], wl = wL[kk-j], wu = wU[kk-j];
+      const double p1 = ul*wl, p2 = ul*wu, p3 = uu*wl, p4 = uu*wu;
+      pL[j] = std::min( std::min( p1, p2 ), std::min( p3, p4 ) );
+      pU[j] = std::max( std::max( p1, p2 ), std::max( p3, p4 ) );
+    }
+  }
+
+  // Sum of the interval products in the arithmetic of T, widened by the
+  // rounding errors of the products: whatever the rounding mode, the error
+  // on each term is at most 2 eps (including the weight) relative to the
+  // largest magnitude of its four real products, plus twice the smallest
+  // subnormal; the factor 3 also covers the rounding of sA and err
+  T S( 0. );
+  double sA = 0.;
+  for( int j=jb; j<=je; j++ ){
+    S += T( pL[j], pU[j] );
+    sA += std::max( std::fabs( pL[j] ), std::fabs( pU[j] ) );
+  }
+  const double err = 3.*std::numeric_limits<double>::epsilon()*sA
+                   + 2.*(je-jb+1)*std::numeric_limits<double>::denorm_min();
+  return S + T( -err, err );
+}
+
+template <typename T> inline T
+ITTape<T>::_symcauchy
+( const unsigned int iu, const unsigned int j0, const unsigned int k )
+{
+  // Pairs (j,k-j) and (k-j,j) counted once, plus middle term squared
+  T S = 2.*_cauchy( iu, iu, j0, (k-1)/2, k, false );
+  if( !(k%2) ) S += Op<T>::sqr( _get( iu, k/2 ) );
+  return S;
+}
+
+template <typename T> inline void
+ITTape<T>::_eval
+( const unsigned int i, const unsigned int k )
+{
+  const t_node& node = _node[i];
+  switch( node.op ){
+  case VAR:
+    break;
+  case ADD:
+    _put( i, k, _get( node.a1, k ) + _get( node.a2, k ) );
+    break;
+  case SUB:
+    _put( i, k, _get( node.a1, k ) - _get( node.a2, k ) );
+    break;
+  case MUL:
+    _put( i, k, _cauchy( node.a1, node.a2, 0, k, k, false ) );
+    break;
+  case DIV:
+    if( !k ) _put( i, k, _get( node.a1, 0 ) / _get( node.a2, 0 ) );
+    else     _put( i, k, ( _get( node.a1, k ) - _cauchy( node.a2, i, 1, k, k, false ) )
+                         / _get( node.a2, 0 ) );
+    break;
+  case ADDC:
+    _put( i, k, k? _get( node.a1, k ): node.c + _get( node.a1, k ) );
+    break;
+  case CSUB:
+    _put( i, k, k? -_get( node.a1, k ): node.c - _get( node.a1, k ) );
+    break;
+  case MULC:
+    _put( i, k, node.c * _get( node.a1, k ) );
+    break;
+  case DIVC:
+    _put( i, k, _get( node.a1, k ) / node.c );
+    break;
+  case CDIV:
+    if( !k ) _put( i, k, node.c / _get( node.a1, 0 ) );
+    else     _put( i, k, -_cauchy( node.a1, i, 1, k, k, false ) / _get( node.a1, 0 ) );
+    break;
+  case NEG:
+    _put( i, k, -_get( node.a1, k ) );
+    break;
+  case SQR:
+    if( !k ) _put( i, k, Op<T>::sqr( _get( node.a1, 0 ) ) );
+    else     _put( i, k, _symcauchy( node.a1, 0, k ) );
+    break;
+  case SQRT:
+    if( !k ) _put( i, k, Op<T>::sqrt( _get( node.a1, 0 ) ) );
+    else     _put( i, k, ( _get( node.a1, k ) - ( k>1? _symcauchy( i, 1, k ): T( 0. ) ) )
+                         / ( 2.*_get( i, 0 ) ) );
+    break;
+  case EXP:
+    if( !k ) _put( i, k, Op<T>::exp( _get( node.a1, 0 ) ) );
+    else     _put( i, k, _cauchy( node.a1, i, 1, k, k, true ) / (double)k );
+    break;
+  case LOG:
+    if( !k ) _put( i, k, Op<T>::log( _get( node.a1, 0 ) ) );
+    else     _put( i, k, ( _get( node.a1, k ) - _cauchy( i, node.a1, 1, k-1, k, true ) / (double)k )
+                         / _get( node.a1, 0 ) );
+    break;
+  case SIN:
+    if( !k ) _put( i, k, Op<T>::sin( _get( node.a1, 0 ) ) );
+    else     _put( i, k, _cauchy( node.a1, node.a2, 1, k, k, true ) / (double)k );
+    break;
+  case COS:
+    if( !k ) _put( i, k, Op<T>::cos( _get( node.a1, 0 ) ) );
+    else     _put( i, k, _cauchy( node.a1, node.a2, 1, k, k, true ) / -(double)k );
+    break;
+  case ASIN:
+    if( !k ) _put( i, k, Op<T>::asin( _get( node.a1, 0 ) ) );
+    else     _put( i, k, ( _get( node.a1, k ) - _cauchy( i, node.a2, 1, k-1, k, true ) / (double)k )
+                         / _get( node.a2, 0 ) );
+    break;
+  case ACOS:
+    if( !k ) _put( i, k, Op<T>::acos( _get( node.a1, 0 ) ) );
+    else     _put( i, k, ( -_get( node.a1, k ) - _cauchy( i, node.a2, 1, k-1, k, true ) / (double)k )
+                         / _get( node.a2, 0 ) );
+    break;
+  case ATAN:
+    if( !k ) _put( i, k, Op<T>::atan( _get( node.a1, 0 ) ) );
+    else     _put( i, k, ( _get( node.a1, k ) - _cauchy( i, node.a2, 1, k-1, k, true ) / (double)k )
+                         / _get( node.a2, 0 ) );
+    break;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T> inline ITVar<T>
+operator+
+( const ITVar<T>&X )
+{
+  return X;
+}
+
+template <typename T> inline ITVar<T>
+operator-
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return -X._cst;
+  return ITVar<T>::_record( X._tape, ITTape<T>::NEG, X._ndx );
+}
+
+template <typename T> inline ITVar<T>
+operator+
+( const ITVar<T>&X1, const ITVar<T>&X2 )
+{
+  if( !X1._tape ) return X1._cst + X2;
+  if( !X2._tape ) return X2._cst + X1;
+  ITTape<T>* tape = ITVar<T>::_tape_check( X1, X2 );
+  return ITVar<T>::_record( tape, ITTape<T>::ADD, X1._ndx, X2._ndx );
+}
+
+template <typename T> inline ITVar<T>
+operator+
+( const double c, const ITVar<T>&X )
+{
+  if( !X._tape ) return c + X._cst;
+  return ITVar<T>::_record( X._tape, ITTape<T>::ADDC, X._ndx, 0, c );
+}
+
+template <typename T> inline ITVar<T>
+operator+
+( const ITVar<T>&X, const double c )
+{
+  return c + X;
+}
+
+template <typename T> inline ITVar<T>
+operator-
+( const ITVar<T>&X1, const ITVar<T>&X2 )
+{
+  if( !X1._tape ) return X1._cst - X2;
+  if( !X2._tape ) return X1 + (-X2._cst);
+  ITTape<T>* tape = ITVar<T>::_tape_check( X1, X2 );
+  return ITVar<T>::_record( tape, ITTape<T>::SUB, X1._ndx, X2._ndx );
+}
+
+template <typename T> inline ITVar<T>
+operator-
+( const double c, const ITVar<T>&X )
+{
+  if( !X._tape ) return c - X._cst;
+  return ITVar<T>::_record( X._tape, ITTape<T>::CSUB, X._ndx, 0, c );
+}
+
+template <typename T> inline ITVar<T>
+operator-
+( const ITVar<T>&X, const double c )
+{
+  return (-c) + X;
+}
+
+template <typename T> inline ITVar<T>
+operator*
+( const ITVar<T>&X1, const ITVar<T>&X2 )
+{
+  if( !X1._tape ) return X1._cst * X2;
+  if( !X2._tape ) return X2._cst * X1;
+  ITTape<T>* tape = ITVar<T>::_tape_check( X1, X2 );
+  return ITVar<T>::_record( tape, ITTape<T>::MUL, X1._ndx, X2._ndx );
+}
+
+template <typename T> inline ITVar<T>
+operator*
+( const double c, const ITVar<T>&X )
+{
+  if( !X._tape ) return c * X._cst;
+  return ITVar<T>::_record( X._tape, ITTape<T>::MULC, X._ndx, 0, c );
+}
+
+template <typename T> inline ITVar<T>
+operator*
+( const ITVar<T>&X, const double c )
+{
+  return c * X;
+}
+
+template <typename T> inline ITVar<T>
+operator/
+( const ITVar<T>&X1, const ITVar<T>&X2 )
+{
+  if( !X1._tape ) return X1._cst / X2;
+  if( !X2._tape ) return X1 / X2._cst;
+  ITTape<T>* tape = ITVar<T>::_tape_check( X1, X2 );
+  return ITVar<T>::_record( tape, ITTape<T>::DIV, X1._ndx, X2._ndx );
+}
+
+template <typename T> inline ITVar<T>
+operator/
+( const ITVar<T>&X, const double c )
+{
+  if( !X._tape ) return X._cst / c;
+  return ITVar<T>::_record( X._tape, ITTape<T>::DIVC, X._ndx, 0, c );
+}
+
+template <typename T> inline ITVar<T>
+operator/
+( const double c, const ITVar<T>&X )
+{
+  if( !X._tape ) return c / X._cst;
+  return ITVar<T>::_record( X._tape, ITTape<T>::CDIV, X._ndx, 0, c );
+}
+
+template <typename T> inline ITVar<T>
+inv
+( const ITVar<T>&X )
+{
+  return 1. / X;
+}
+
+template <typename T> inline ITVar<T>
+sqr
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return X._cst * X._cst;
+  return ITVar<T>::_record( X._tape, ITTape<T>::SQR, X._ndx );
+}
+
+template <typename T> inline ITVar<T>
+sqrt
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return std::sqrt( X._cst );
+  return ITVar<T>::_record( X._tape, ITTape<T>::SQRT, X._ndx );
+}
+
+template <typename T> inline ITVar<T>
+exp
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return std::exp( X._cst );
+  return ITVar<T>::_record( X._tape, ITTape<T>::EXP, X._ndx );
+}
+
+template <typename T> inline ITVar<T>
+log
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return std::log( X._cst );
+  return ITVar<T>::_record( X._tape, ITTape<T>::LOG, X._ndx );
+}
+
+template <typename T> inline ITVar<T>
+sin
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return std::sin( X._cst );
+  // The sine and cosine series are recorded as consecutive entries, each one referring to the other
+  const unsigned int i = X._tape->size();
+  ITVar<T> S = ITVar<T>::_record( X._tape, ITTape<T>::SIN, X._ndx, i+1 );
+  ITVar<T>::_record( X._tape, ITTape<T>::COS, X._ndx, i );
+  return S;
+}
+
+template <typename T> inline ITVar<T>
+cos
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return std::cos( X._cst );
+  const unsigned int i = X._tape->size();
+  ITVar<T> C = ITVar<T>::_record( X._tape, ITTape<T>::COS, X._ndx, i+1 );
+  ITVar<T>::_record( X._tape, ITTape<T>::SIN, X._ndx, i );
+  return C;
+}
+
+template <typename T> inline ITVar<T>
+tan
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return std::tan( X._cst );
+  ITVar<T> S = sin( X );
+  return S / ITVar<T>( S._tape, S._ndx+1 );
+}
+
+template <typename T> inline ITVar<T>
+asin
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return std::asin( X._cst );
+  ITVar<T> W = sqrt( 1. - sqr( X ) );
+  return ITVar<T>::_record( X._tape, ITTape<T>::ASIN, X._ndx, W._ndx );
+}
+
+template <typename T> inline ITVar<T>
+acos
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return std::acos( X._cst );
+  ITVar<T> W = sqrt( 1. - sqr( X ) );
+  return ITVar<T>::_record( X._tape, ITTape<T>::ACOS, X._ndx, W._ndx );
+}
+
+template <typename T> inline ITVar<T>
+atan
+( const ITVar<T>&X )
+{
+  if( !X._tape ) return std::atan( X._cst );
+  ITVar<T> W = 1. + sqr( X );
+  return ITVar<T>::_record( X._tape, ITTape<T>::ATAN, X._ndx, W._ndx );
+}
+
+template <typename T> inline ITVar<T>
+pow
+( const ITVar<T>&X, const int n )
+{
+  if( !X._tape ) return std::pow( X._cst, n );
+  if( n < 0 ) return 1. / pow( X, -n );
+  if( n == 0 ) return 1.;
+  // Binary powering with products and squares, valid when the zeroth-order coefficient of X contains zero
+  ITVar<T> Y = X, P;
+  bool first = true;
+  for( unsigned int m=n; m; m>>=1 ){
+    if( m%2 ){ P = first? Y: P*Y; first = false; }
+    if( m>1 ) Y = sqr( Y );
+  }
+  return P;
+}
+
+template <typename T> inline ITVar<T>
+pow
+( const ITVar<T>&X, const double a )
+{
+  return exp( a * log( X ) );
+}
+
+template <typename T> inline ITVar<T>
+pow
+( const double a, const ITVar<T>&X )
+{
+  return exp( std::log( a ) * X );
+}
+
+template <typename T> inline ITVar<T>
+pow
+( const ITVar<T>&X1, const ITVar<T>&X2 )
+{
+  return exp( X2 * log( X1 ) );
+}
+
+} // namespace mc
+
+#endif
@@ -5,7 +5,7 @@ include $(srcpath)/makeoptions.mk
 #####
 
 incobjs = mcfunc.hpp mcop.hpp interval.hpp mccormick.hpp tmodel.hpp \
-          specbnd.hpp mcprofil.hpp mcfilib.hpp mcfadbad.hpp mclapack.hpp
+          cmodel.hpp specbnd.hpp spspecbnd.hpp alphabb.hpp hesspattern.hpp btape.hpp ittape.hpp intervalpack.hpp intervalblas.hpp affine.hpp ffunc.hpp ffcontractor.hpp ffcodegen.hpp ffbranchbound.hpp mcprofil.hpp mcfilib.hpp mcfadbad.hpp mclapack.hpp
 
 #####
 
@@ -1735,7 +1735,7 @@ template <typename T> inline double*
 McCormick<T>::_erfcv
 ( const double x, const double xL, const double xU )
 {
-  static double cv[2];
+  static MC__THREAD_LOCAL double cv[2];
   if( xU <= 0. ){	 // convex part
     cv[0] = ::erf(x), cv[1] = 2./std::sqrt(PI)*std::exp(-sqr(x));
     return cv;
@@ -1767,7 +1767,7 @@ template <typename T> inline double*
 McCormick<T>::_erfcc
 ( const double x, const double xL, const double xU )
 {
-  static double cc[2];
+  static MC__THREAD_LOCAL double cc[2];
   if( xU <= 0. ){	 // convex part
     double r = ( isequal( xL, xU )? 0.:(::erf(xU)-::erf(xL))/(xU-xL) );
     cc[0] = ::erf(xL)+r*(x-xL), cc[1] = r;
@@ -1815,7 +1815,7 @@ template <typename T> inline double*
 McCormick<T>::_atancv
 ( const double x, const double xL, const double xU )
 {
-  static double cv[2];
+  static MC__THREAD_LOCAL double cv[2];
   if( xU <= 0. ){	 // convex part
     cv[0] = std::atan(x), cv[1] = 1./(1.+sqr(x));
     return cv;
@@ -1847,7 +1847,7 @@ template <typename T> inline double*
 McCormick<T>::_atancc
 ( const double x, const double xL, const double xU )
 {
-  static double cc[2];
+  static MC__THREAD_LOCAL double cc[2];
   if( xU <= 0. ){	 // convex part
     double r = ( isequal( xL, xU )? 0.:(std::atan(xU)-std::atan(xL))/(xU-xL) );
     cc[0] = std::atan(xL)+r*(x-xL), cc[1] = r;
@@ -1895,7 +1895,7 @@ template <typename T> inline double*
 McCormick<T>::_oddpowcv
 ( const double x, const int iexp, const double xL, const double xU )
 {
-  static double cv[2];
+  static MC__THREAD_LOCAL double cv[2];
   if( xL >= 0. ){	 // convex part
     double v = std::pow(x,iexp-1);
     cv[0] = x*v, cv[1] = iexp*v;
@@ -1931,7 +1931,7 @@ template <typename T> inline double*
 McCormick<T>::_oddpowcc
 ( const double x, const int iexp, const double xL, const double xU )
 {
-  static double cc[2];
+  static MC__THREAD_LOCAL double cc[2];
   if( xL >= 0. ){	 // convex part
     double r = ( isequal( xL, xU )? 0.:
       (std::pow(xU,iexp)-std::pow(xL,iexp))/(xU-xL) );
@@ -1983,7 +1983,7 @@ template <typename T> inline double*
 McCormick<T>::_stepcv
 ( const double x, const double xL, const double xU )
 {
-  static double cv[2];
+  static MC__THREAD_LOCAL double cv[2];
 
   if( x < 0. ){
     cv[0] = cv[1] = 0.;
@@ -2003,7 +2003,7 @@ template <typename T> inline double*
 McCormick<T>::_stepcc
 ( const double x, const double xL, const double xU )
 {
-  static double cc[2];
+  static MC__THREAD_LOCAL double cc[2];
 
   if( x >= 0. ){
     cc[0] = 1., cc[1] = 0.;
@@ -2023,7 +2023,7 @@ template <typename T> inline double*
 McCormick<T>::_cosarg
 ( const double xL, const double xU )
 {
-  static double arg[2];
+  static MC__THREAD_LOCAL double arg[2];
   const int kL = std::ceil(-(1.+xL/PI)/2.);
   const double xL1 = xL+2.*PI*kL, xU1 = xU+2.*PI*kL;
   assert( xL1 >= -PI && xL1 <= PI );
@@ -2043,7 +2043,7 @@ template <typename T> inline double*
 McCormick<T>::_coscv
 ( const double x, const double xL, const double xU )
 {
-  static double cv[2];
+  static MC__THREAD_LOCAL double cv[2];
   const int kL = std::ceil(-(1.+xL/PI)/2.);
   if( x <= PI*(1-2*kL) ){
     const double xL1 = xL+2.*PI*kL;
@@ -2092,7 +2092,7 @@ McCormick<T>::_coscv2
   catch( McCormick<T>::Exceptions ){
     xj = _goldsect( xL, xU, _cosenv_func, &xm, 0 );
   }
-  static double cv[2];
+  static MC__THREAD_LOCAL double cv[2];
   if(( left && x<=xj ) || ( !left && x>=xj )){
     cv[0] = std::cos(x), cv[1] = -std::sin(x);
     return cv;
@@ -2106,7 +2106,7 @@ template <typename T> inline double*
 McCormick<T>::_coscc
 ( const double x, const double xL, const double xU )
 {
-  static double cc[2];
+  static MC__THREAD_LOCAL double cc[2];
   const double*cvenv = _coscv( x-PI, xL-PI, xU-PI );
   cc[0] = -cvenv[0], cc[1] = -cvenv[1];
   return cc;
@@ -2133,7 +2133,7 @@ template <typename T> inline double*
 McCormick<T>::_asincv
 ( const double x, const double xL, const double xU )
 {
-  static double cv[2];
+  static MC__THREAD_LOCAL double cv[2];
   if( xL >= 0. ){	 // convex part
     cv[0] = std::asin(x), cv[1] = 1./std::sqrt(1-x*x);
     return cv;
@@ -2164,7 +2164,7 @@ template <typename T> inline double*
 McCormick<T>::_asincc
 ( const double x, const double xL, const double xU )
 {
-  static double cc[2];
+  static MC__THREAD_LOCAL double cc[2];
   if( xL >= 0. ){	 // convex part
     double r = ( isequal( xL, xU )? 0.: (std::asin(xU)-std::asin(xL))/(xU-xL));
     cc[0] = std::asin(xL)+r*(x-xL), cc[1] = r;
@@ -2211,7 +2211,7 @@ template <typename T> inline double*
 McCormick<T>::_tancv
 ( const double x, const double xL, const double xU )
 {
-  static double cv[2];
+  static MC__THREAD_LOCAL double cv[2];
   if( xL >= 0. ){	 // convex part
     cv[0] = std::tan(x), cv[1] = 1.+sqr(std::tan(x));
     return cv;
@@ -2242,7 +2242,7 @@ template <typename T> inline double*
 McCormick<T>::_tancc
 ( const double x, const double xL, const double xU )
 {
-  static double cc[2];
+  static MC__THREAD_LOCAL double cc[2];
   if( xL >= 0. ){	 // convex part
     double r = ( isequal( xL, xU )? 0.: (std::tan(xU)-std::tan(xL))/(xU-xL));
     cc[0] = std::tan(xL)+r*(x-xL), cc[1] = r;
@@ -2350,7 +2350,7 @@ McCormick<T>::_goldsect_iter
 // a and c are the current bounds; the minimum is between them.
 // b is a center point
 {
-  static unsigned int iter;
+  static MC__THREAD_LOCAL unsigned int iter;
   iter = ( init? 1: iter+1 );
   const double phi = 2.-(1.+std::sqrt(5.))/2.;
   bool b_then_x = ( c-b > b-a );
@@ -2806,7 +2806,7 @@ template <typename T> inline McCormick<T>
 arh
 ( const McCormick<T>&MC, const double k )
 {
-  if( Op<T>::l(MC._I) <= 0. || k < 0. || ( Op<T>::u(MC._I) > 0.5*k && Op<T>::l(MC._I) >= 0.5*k ) ){
+  if( Op<T>::l(MC._I) <= 0. || k < 0. || ( Op<T>::l(MC._I) < 0.5*k && Op<T>::u(MC._I) > 0.5*k ) ){
     return exp( - k * inv( MC ) );
   }
 
@@ -2825,9 +2825,9 @@ arh
     { int imid = -1;
       double r = 0.;
       if( !isequal( Op<T>::l(MC._I), Op<T>::u(MC._I) ))
-        r = ( mc::arh( Op<T>::u(MC._I) ) - mc::arh( Op<T>::l(MC._I) ) )
+        r = ( mc::arh( Op<T>::u(MC._I), k ) - mc::arh( Op<T>::l(MC._I), k ) )
           / ( Op<T>::u(MC._I) - Op<T>::l(MC._I) );
-      MC2._cc = mc::arh( Op<T>::l(MC._I) ) + r * ( mid( MC._cv, MC._cc, Op<T>::u(MC._I), imid )
+      MC2._cc = mc::arh( Op<T>::l(MC._I), k ) + r * ( mid( MC._cv, MC._cc, Op<T>::u(MC._I), imid )
         - Op<T>::l(MC._I) );
       for( unsigned int i=0; i<MC2._nsub; i++ )
         MC2._ccsub[i] = mid( MC._cvsub, MC._ccsub, i, imid ) * r;
@@ -2835,13 +2835,13 @@ arh
     return MC2.cut();
   }
 
-  else if ( Op<T>::l(MC._I) >= 0.5*k ){
+  else{ // Op<T>::l(MC._I) >= 0.5*k
     { int imid = -1;
       double r = 0.;
       if( !isequal( Op<T>::l(MC._I), Op<T>::u(MC._I) ))
-        r = ( mc::arh( Op<T>::u(MC._I) ) - mc::arh( Op<T>::l(MC._I) ) )
+        r = ( mc::arh( Op<T>::u(MC._I), k ) - mc::arh( Op<T>::l(MC._I), k ) )
           / ( Op<T>::u(MC._I) - Op<T>::l(MC._I) );
-      MC2._cv = mc::arh( Op<T>::l(MC._I) ) + r * ( mid( MC._cv, MC._cc, Op<T>::l(MC._I), imid )
+      MC2._cv = mc::arh( Op<T>::l(MC._I), k ) + r * ( mid( MC._cv, MC._cc, Op<T>::l(MC._I), imid )
         - Op<T>::l(MC._I) );
       for( unsigned int i=0; i<MC2._nsub; i++ )
         MC2._cvsub[i] = mid( MC._cvsub, MC._ccsub, i, imid ) * r;
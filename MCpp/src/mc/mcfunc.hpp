@@ -8,10 +8,63 @@
 #include <cfloat>
 #include <sys/resource.h>
 #include <sys/times.h>
+#if !defined(MC__SINGLE_THREAD) && __cplusplus >= 201103L
+  #include <atomic>
+#elif !defined(MC__SINGLE_THREAD) && defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+
+// Storage class for the static work variables that must be private to each thread.
+// For a compiler without thread-local storage, MC__SINGLE_THREAD must be defined to
+// use MC++ from a single thread only: the static work variables are then shared by
+// all the threads, and the parallel evaluations in MC++ are disabled
+#if defined(MC__SINGLE_THREAD)
+  #define MC__THREAD_LOCAL
+#elif __cplusplus >= 201103L
+  #define MC__THREAD_LOCAL thread_local
+#elif defined(__GNUC__)
+  #define MC__THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+  #define MC__THREAD_LOCAL __declspec(thread)
+#else
+  #error "MC++: no thread-local storage class known for this compiler, define MC__SINGLE_THREAD to use MC++ from a single thread only"
+#endif
 
 namespace mc
 {
 
+//! @brief Counter shared by all the threads, with atomic increments
+class SharedCounter
+{
+public:
+  SharedCounter(): _cnt( 0 ) {}
+  //! @brief Increment the counter and return its previous value
+  unsigned long next()
+  {
+#if defined(MC__SINGLE_THREAD)
+    return _cnt++;
+#elif __cplusplus >= 201103L
+    return _cnt.fetch_add( 1 );
+#elif defined(__GNUC__)
+    return __sync_fetch_and_add( &_cnt, 1UL );
+#elif defined(_MSC_VER)
+    return (unsigned long)_InterlockedExchangeAdd( &_cnt, 1L );
+#else
+  #error "MC++: no atomic operations known for this compiler, define MC__SINGLE_THREAD to use MC++ from a single thread only"
+#endif
+  }
+private:
+#if defined(MC__SINGLE_THREAD)
+  unsigned long _cnt;
+#elif __cplusplus >= 201103L
+  std::atomic<unsigned long> _cnt;
+#elif defined(__GNUC__)
+  volatile unsigned long _cnt;
+#else
+  volatile long _cnt;
+#endif
+};
+
 enum{ ICUT = 0, ICONV, ICONC };
 const double PI = 4.0*std::atan(1.0);
 
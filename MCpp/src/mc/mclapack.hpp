@@ -7,6 +7,8 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #undef  MC__DEBUG_EIGEN
 
@@ -14,6 +16,23 @@ extern "C" void dsyev_
 ( const char*jobz, const char*uplo, const unsigned int*n, double*a,
   const unsigned int*lda, double*w, double*work, const int*lwork, int*info );
 
+extern "C" void dsyevr_
+( const char*jobz, const char*range, const char*uplo, const unsigned int*n,
+  double*a, const unsigned int*lda, const double*vl, const double*vu,
+  const int*il, const int*iu, const double*abstol, int*m, double*w, double*z,
+  const unsigned int*ldz, int*isuppz, double*work, const int*lwork, int*iwork,
+  const int*liwork, int*info );
+
+extern "C" void dsytrd_
+( const char*uplo, const unsigned int*n, double*a, const unsigned int*lda,
+  double*d, double*e, double*tau, double*work, const int*lwork, int*info );
+
+extern "C" void dstebz_
+( const char*range, const char*order, const unsigned int*n, const double*vl,
+  const double*vu, const int*il, const int*iu, const double*abstol,
+  const double*d, const double*e, int*m, int*nsplit, double*w, int*iblock,
+  int*isplit, double*work, int*iwork, int*info );
+
 namespace mc
 {
  
@@ -75,6 +94,177 @@ inline double* dsyev_wrapper
   return D;
 }
 
+//! @brief Optimal size of the workspace for LAPACK function <tt>_dsyev<tt> applied to a symmetric <tt>n</tt>-by-<tt>n</tt> matrix, with (<tt>eigv=true</tt>) or without (<tt>eigv=false</tt>) eigenvectors.
+inline int dsyev_lwork
+( const unsigned int n, const bool eigv=false )
+{
+  int info;
+  char JOBZ = (eigv?'V':'N'), UPLO = 'U';
+  double Atmp, Dtmp, worktmp;
+  int lwork = -1;
+  dsyev_( &JOBZ, &UPLO, &n, &Atmp, &n, &Dtmp, &worktmp, &lwork, &info );
+  return info? 3*n: (int)worktmp;
+}
+
+//! @brief Wrapper to LAPACK function <tt>_dsyev<tt> doing eigenvalue decomposition of symmetric <tt>n</tt>-by-<tt>n</tt> matrix <tt>A</tt> with preallocated workspace. The eigenvalues are returned in ascending order in the array <tt>D</tt> of size <tt>n</tt>, using the workspace <tt>work</tt> of size <tt>lwork</tt> as given by mc::dsyev_lwork. The return value is <tt>false</tt> if the eigenvalue decomposition was unsuccessful. As with mc::dsyev_wrapper above, <tt>A</tt> is altered.
+inline bool dsyev_wrapper
+( const unsigned int n, double*A, double*D, double*work, const int lwork,
+  const bool eigv=false )
+{
+  int info;
+  char JOBZ = (eigv?'V':'N'), UPLO = 'U';
+  dsyev_( &JOBZ, &UPLO, &n, A, &n, D, work, &lwork, &info );
+  return !info;
+}
+
+//! @brief C++ class for repeated eigenvalue computations on symmetric matrices using LAPACK
+////////////////////////////////////////////////////////////////////////
+//! mc::EigenSolver is a C++ class wrapping the LAPACK functions for
+//! symmetric eigenvalue problems. The optimal workspaces are queried
+//! once per matrix dimension and kept across calls, and the eigenvalues
+//! are written into buffers provided by the caller. In all methods, the
+//! symmetric <tt>n</tt>-by-<tt>n</tt> matrix <tt>A</tt> is altered on
+//! return.
+////////////////////////////////////////////////////////////////////////
+class EigenSolver
+////////////////////////////////////////////////////////////////////////
+{
+public:
+
+  //! @brief Default constructor
+  EigenSolver():
+    _nsyev(0), _eigvsyev(false), _lwsyev(0), _nsyevr(0), _lwsyevr(0),
+    _liwsyevr(0), _nsytrd(0), _lwsytrd(0)
+    {}
+
+  //! @brief All eigenvalues of <tt>A</tt>, returned in ascending order in <tt>D</tt> of size <tt>n</tt>, using LAPACK function <tt>dsyev</tt>. If <tt>eigv</tt> is set to <tt>true</tt>, the eigenvectors are returned in <tt>A</tt>. The return value is <tt>false</tt> if the decomposition was unsuccessful.
+  bool dsyev
+    ( const unsigned int n, double*A, double*D, const bool eigv=false );
+
+  //! @brief Eigenvalues of <tt>A</tt> with indices <tt>il</tt> to <tt>iu</tt> in ascending order (1-based), returned in <tt>D</tt> of size at least <tt>iu-il+1</tt>, using LAPACK function <tt>dsyevr</tt> (or <tt>dsyev</tt> for small matrices). The return value is <tt>false</tt> if the computation was unsuccessful.
+  bool dsyevr
+    ( const unsigned int n, double*A, const unsigned int il,
+      const unsigned int iu, double*D );
+
+  //! @brief Smallest and largest eigenvalues of <tt>A</tt>, returned in <tt>lmin</tt> and <tt>lmax</tt>, using a single tridiagonal reduction with LAPACK function <tt>dsytrd</tt> followed by bisection with LAPACK function <tt>dstebz</tt> (or <tt>dsyev</tt> for small matrices). The return value is <tt>false</tt> if the computation was unsuccessful.
+  bool extremes
+    ( const unsigned int n, double*A, double&lmin, double&lmax );
+
+private:
+
+  //! @brief Dimension below which a full decomposition with <tt>dsyev</tt> is cheaper than a partial one
+  static const unsigned int _NPARTIAL = 12;
+
+  //! @brief Dimension, eigenvector flag and workspace size for <tt>dsyev</tt>
+  unsigned int _nsyev; bool _eigvsyev; int _lwsyev;
+  //! @brief Dimension and workspace sizes for <tt>dsyevr</tt>
+  unsigned int _nsyevr; int _lwsyevr, _liwsyevr;
+  //! @brief Dimension and workspace size for <tt>dsytrd</tt>
+  unsigned int _nsytrd; int _lwsytrd;
+  //! @brief Real workspace
+  std::vector<double> _work;
+  //! @brief Integer workspace
+  std::vector<int> _iwork;
+  //! @brief Tridiagonal matrix and Householder factors for <tt>dsytrd</tt>, or eigenvalues for <tt>dsyevr</tt>
+  std::vector<double> _tri;
+
+  //! @brief Make sure the real and integer workspaces have at least <tt>lwork</tt> and <tt>liwork</tt> entries
+  void _reserve
+    ( const int lwork, const int liwork=0 )
+    {
+      if( (int)_work.size()  < lwork  ) _work.resize( lwork );
+      if( (int)_iwork.size() < liwork ) _iwork.resize( liwork );
+    }
+};
+
+inline bool
+EigenSolver::dsyev
+( const unsigned int n, double*A, double*D, const bool eigv )
+{
+  if( !n ) return false;
+  if( n != _nsyev || eigv != _eigvsyev ){
+    _lwsyev = dsyev_lwork( n, eigv );
+    _nsyev = n; _eigvsyev = eigv;
+  }
+  _reserve( _lwsyev );
+  return dsyev_wrapper( n, A, D, &_work[0], _lwsyev, eigv );
+}
+
+inline bool
+EigenSolver::dsyevr
+( const unsigned int n, double*A, const unsigned int il,
+  const unsigned int iu, double*D )
+{
+  if( !n || !il || il > iu || iu > n ) return false;
+  int info, m;
+  char JOBZ = 'N', RANGE = 'I', UPLO = 'U';
+  const double VL = 0., VU = 0., ABSTOL = 0.;
+  const int IL = il, IU = iu;
+  double Z;
+  int ISUPPZ[2];
+  // dsyevr requires an eigenvalue array of size n, even if fewer are computed
+  if( _tri.size() < n ) _tri.resize( n );
+  double *W = &_tri[0];
+  if( n < _NPARTIAL ){
+    if( !dsyev( n, A, W ) ) return false;
+    std::copy( W+il-1, W+iu, D );
+    return true;
+  }
+  if( n != _nsyevr ){
+    double worktmp; int iworktmp, lwork = -1;
+    dsyevr_( &JOBZ, &RANGE, &UPLO, &n, A, &n, &VL, &VU, &IL, &IU, &ABSTOL,
+             &m, W, &Z, &n, ISUPPZ, &worktmp, &lwork, &iworktmp, &lwork, &info );
+    _lwsyevr  = info? 26*n: (int)worktmp;
+    _liwsyevr = info? 10*n: iworktmp;
+    _nsyevr = n;
+  }
+  _reserve( _lwsyevr, _liwsyevr );
+  dsyevr_( &JOBZ, &RANGE, &UPLO, &n, A, &n, &VL, &VU, &IL, &IU, &ABSTOL,
+           &m, W, &Z, &n, ISUPPZ, &_work[0], &_lwsyevr, &_iwork[0], &_liwsyevr, &info );
+  if( info || m != IU-IL+1 ) return false;
+  std::copy( W, W+m, D );
+  return true;
+}
+
+inline bool
+EigenSolver::extremes
+( const unsigned int n, double*A, double&lmin, double&lmax )
+{
+  if( !n ) return false;
+  if( n < _NPARTIAL ){
+    if( _tri.size() < n ) _tri.resize( n );
+    if( !dsyev( n, A, &_tri[0] ) ) return false;
+    lmin = _tri[0]; lmax = _tri[n-1];
+    return true;
+  }
+  int info;
+  char UPLO = 'U';
+  if( n != _nsytrd ){
+    double worktmp; int lwork = -1;
+    dsytrd_( &UPLO, &n, A, &n, &worktmp, &worktmp, &worktmp, &worktmp, &lwork, &info );
+    _lwsytrd = std::max( info? (int)n: (int)worktmp, (int)(4*n) );
+    _nsytrd = n;
+  }
+  _reserve( _lwsytrd, 5*n );
+  if( _tri.size() < 3*n ) _tri.resize( 3*n );
+  double *d = &_tri[0], *e = d+n, *tau = e+n;
+  dsytrd_( &UPLO, &n, A, &n, d, e, tau, &_work[0], &_lwsytrd, &info );
+  if( info ) return false;
+
+  // Bisection for the first and last eigenvalues of the tridiagonal matrix
+  char RANGE = 'I', ORDER = 'E';
+  const double VL = 0., VU = 0., ABSTOL = 0.;
+  int m, nsplit, *iblock = &_iwork[3*n], *isplit = &_iwork[4*n];
+  for( int k=0; k<2; k++ ){
+    const int IL = k? n: 1;
+    dstebz_( &RANGE, &ORDER, &n, &VL, &VU, &IL, &IL, &ABSTOL, d, e, &m,
+             &nsplit, k? &lmax: &lmin, iblock, isplit, &_work[0],
+             &_iwork[0], &info );
+    if( info || m != 1 ) return false;
+  }
+  return true;
+}
+
 } // namespace mc
 
 #endif
@@ -145,6 +145,17 @@ Spectral bound (Hertz&Rohn, forward-reverse): [ -2.11973e+01 :  3.05272e+01 ]
 
 In this case, the spectral bounds computed from the Hessian matrix obtained with the forward-forward and forward-reverse modes of AD are indeed identical, although such may not always be the case; see [Darup <I>et al.</I>, 2012]
 
+For functions in a few variables, the number of directions can also be fixed at compile time, using the stack-based types <tt>fadbad::F<I,N></tt> of FADBAD++ in place of <tt>fadbad::F<I></tt>. The derivatives are then stored inline rather than on the heap, and the variables are seeded with <tt>diff(i)</tt> instead of <tt>diff(i,N)</tt>. mc::Specbnd::spectral_bound accepts Hessian matrices of type <tt>fadbad::F< fadbad::F<I,N>, N ></tt> and <tt>fadbad::B< fadbad::F<I,N> ></tt> alike:
+
+\code
+      typedef fadbad::F<I,3> FI3;
+      typedef fadbad::F<FI3,3> FFI3;
+      FI3 FX3[3] = { I(-0.3,0.2), I(-0.1,0.6), I(-0.4,0.5) };
+      FFI3 FFX3[3];
+      for( unsigned int i=0; i<3; i++ ){ FX3[i].diff(i); FFX3[i] = FX3[i]; FFX3[i].diff(i); }
+      std::pair<double,double> spbnd3 = SB::spectral_bound( exp( FFX3[0] - 2*pow(FFX3[1],2) + 3*pow(FFX3[2],3) ) );
+\endcode
+
 \section sec_SPECBND_MC How do I compute convex/concave relaxations on the spectrum of the Hessian matrix of a factorable function?
 
 Instead of using standard interval arithmetic for propagating spectral bounds, we can as well make use of the McCormick relaxation technique to propagate convex/concave bounds. Using MC++, this is done simply by selecting mc::McCormick as the template parameter in mc::Specbnd:
@@ -240,6 +251,21 @@ Spectral bounds of df/dx3:
 
 
 
+\section sec_SPECBND_hessbnd Which methods are available for bounding the spectrum of an interval Hessian matrix?
+
+Given an interval Hessian matrix \f$[H]=[H^{\rm L},H^{\rm U}]\f$, with midpoint \f$H^{\rm M}\f$ and radius \f$\Delta H\f$, the following methods can be selected with the option mc::Specbnd::Options::HESSBND:
+- mc::Specbnd::Options::GERSHGORIN: Gershgorin's circle criterion [Adjiman <I>et al.</I>, 1998], at a cost of \f$O(n^2)\f$ operations.
+- mc::Specbnd::Options::GERSHGORIN_SCALED: Gershgorin's circle criterion with optimal diagonal scaling. The best lower bound over all positive scalings \f$d\f$, \f$\min_i h^{\rm L}_{ii}-\sum_{j\neq i}|h_{ij}|d_j/d_i\f$, is the smallest eigenvalue of the comparison matrix with diagonal \f$h^{\rm L}_{ii}\f$ and off-diagonal entries \f$-|h_{ij}|\f$, and similarly for the upper bound. This costs two symmetric eigenvalue decompositions and is never looser than mc::Specbnd::Options::GERSHGORIN.
+- mc::Specbnd::Options::ROHN: Rohn's midpoint-radius bound \f$[\lambda_{\min}(H^{\rm M})-\rho(\Delta H),\lambda_{\max}(H^{\rm M})+\rho(\Delta H)]\f$ [Rohn, 1998], at a cost of two symmetric eigenvalue decompositions.
+- mc::Specbnd::Options::EMATRIX: E-matrix method [Adjiman <I>et al.</I>, 1998] with \f$E=\mp{\rm diag}(\Delta H)\f$, where the diagonal entries are bounded separately from the off-diagonal radius \f$\Delta H^{\rm o}\f$: \f$[\lambda_{\min}(H^{\rm M}-{\rm diag}(\Delta H))-\rho(\Delta H^{\rm o}),\lambda_{\max}(H^{\rm M}+{\rm diag}(\Delta H))+\rho(\Delta H^{\rm o})]\f$, at a cost of three symmetric eigenvalue decompositions.
+- mc::Specbnd::Options::HERTZROHN: Hertz & Rohn's method [Hertz, 1992], which gives the exact spectral bounds of \f$[H]\f$ but requires \f$2^{n}\f$ symmetric eigenvalue decompositions. This is only practical for a small number of variables.
+.
+
+A comparison of these bounders in terms of bound width and computational time is provided in the example <tt>examples/SB-BENCH</tt>.
+
+For functions with a sparse Hessian matrix, the interval Hessian matrix can be computed in compressed form and passed to mc::Specbnd::spectral_bound along with the coloring used to compress it&mdash;see \ref page_HESSPATTERN.
+
+
 \section sec_SPECBND_opt How are the options set for the computation of a spectral bound?
 
 The class mc::Specbnd has a public static member called mc::Specbnd::options that can be used to set/modify the options; e.g.,
@@ -255,7 +281,13 @@ The available options are the following:
      <TR><TH><b>Name</b>  <TD><b>Type</b><TD><b>Default</b>
          <TD><b>Description</b>
      <TR><TH><tt>HESSBND</tt> <TD><tt>mc::Specbnd::Options::HESSBND_STRATEGY</tt> <TD>mc::Specbnd::Options::GERSHGORIN
-         <TD>Strategy for computing spectral bounds in interval Hessian matrix using mc::Specbnd::spectral_bound
+         <TD>Strategy for computing spectral bounds in interval Hessian matrix using mc::Specbnd::spectral_bound (see \ref sec_SPECBND_hessbnd)
+     <TR><TH><tt>HERTZROHN_NTHREADS</tt> <TD><tt>unsigned int</tt> <TD>0
+         <TD>Number of threads for enumerating the \f$2^{n-1}\f$ vertex matrices in Hertz & Rohn's method. Only used when MC++ is compiled with OpenMP support (e.g. <tt>-fopenmp</tt>), in which case a value of 0 selects the OpenMP default.
+     <TR><TH><tt>HERTZROHN_STOPL</tt> <TD><tt>double</tt> <TD>-DBL_MAX
+         <TD>Threshold for early termination in Hertz & Rohn's method. The enumeration of the vertex matrices stops as soon as a lower spectral bound below this value is found. The returned lower bound is then only certified to lie below HERTZROHN_STOPL, and the returned upper bound is no longer guaranteed. This is useful, e.g., for checking convexity with HERTZROHN_STOPL = 0.
+     <TR><TH><tt>HERTZROHN_STOPU</tt> <TD><tt>double</tt> <TD>DBL_MAX
+         <TD>Threshold for early termination in Hertz & Rohn's method. The enumeration of the vertex matrices stops as soon as an upper spectral bound above this value is found, with the same caveats as HERTZROHN_STOPL.
 </TABLE>
 
 
@@ -280,6 +312,7 @@ Moreover, exceptions may be thrown by the template parameter class itself.
 \section sec_SPECBND_refs References
 
 - Adjiman, C.S., S. Dallwig, C.A. Floudas, and A. Neumaier, <A href="http://dx.doi.org/10.1016/S0098-1354(98)00027-1">A global optimization method, \f$\rm\alpha BB\f$, for general twice-differentiable constrained NLPs-I. Theoretical advances</A>, <I>Computers & Chemical Engineering</I> <B>22</B>(9):1137-1158, 1998.
+- Rohn, J., Bounds on eigenvalues of interval matrices, <I>Z. Angew. Math. Mech.</I> <B>78</B>(S3):S1049-S1050, 1998.
 - Hertz, D., <A href="http://dx.doi.org/10.1109/9.126593">The extreme eigenvalues and stability of real symmetric interval matrices</A>, <I>IEEE Transactions on Automatic Control</I> <B>37</B>:532-535, 1992.
 - M&ouml;nnigmann, M., <A href="http://dx.doi.org/10.1137/070704186">Efficient calculation of bounds on spectra of Hessian matrices</A>, <i>SIAM Journal on Scientific Computing</i>, <b>30</b>:2340-2357, 2008.
 - M&ouml;nnigmann, M., <A href="http://dx.doi.org/10.1137/10078760X">Fast Calculation of Spectral Bounds for Hessian Matrices on Hyperrectangles</A>, <i>SIAM Journal on Matrix Analysis and Applications</i>, <b>32</b>:4, 1351-1366, 2011.
@@ -293,8 +326,14 @@ Moreover, exceptions may be thrown by the template parameter class itself.
 
 #include <iostream>
 #include <cmath>
+#include <limits>
+#include <vector>
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
 
 #include "mclapack.hpp"
+#include "hesspattern.hpp"
 #include "mcop.hpp"
 #include "fadiff.h"
 #include "badiff.h"
@@ -366,17 +405,41 @@ private:
   static T _LambdaT( const fadbad::F<T> &a, const fadbad::F<T> &b, const unsigned int n );
 
   //! @brief Computing spectral bound of interval Hessian matrix (forward-reverse AD) using Gershgorin's circle criterion
-  static std::pair<double,double> _gershgorin_bound
-    ( const fadbad::B< fadbad::F< T > >* D2X );
-  //! @brief Computing spectral bound of interval Hessian matrix (forward-reverse AD) using Hertz & Rohn's method
-  static std::pair<double,double> _hertzrohn_bound
-    ( const fadbad::B< fadbad::F< T > >* D2X );
+  template <unsigned int NI> static std::pair<double,double> _gershgorin_bound
+    ( const fadbad::B< fadbad::F< T, NI > >* D2X );
+  //! @brief Lower and upper bounds <tt>HL</tt> and <tt>HU</tt> of interval Hessian matrix (forward-reverse AD) as dense symmetric matrices of size <tt>N</tt>-by-<tt>N</tt>, to be deleted by the caller
+  template <unsigned int NI> static unsigned int _hessian_bounds
+    ( const fadbad::B< fadbad::F< T, NI > >* D2X, double*&HL, double*&HU );
   //! @brief Computing spectral bound of interval Hessian matrix (forward-forward AD) using Gershgorin's circle criterion
-  static std::pair<double,double> _gershgorin_bound
-    ( const fadbad::F< fadbad::F< T > >& D2F );
-  //! @brief Computing spectral bound of interval Hessian matrix (forward-forward AD) using Hertz & Rohn's method
+  template <unsigned int NI, unsigned int NO> static std::pair<double,double> _gershgorin_bound
+    ( const fadbad::F< fadbad::F< T, NI >, NO >& D2F );
+  //! @brief Lower and upper bounds <tt>HL</tt> and <tt>HU</tt> of interval Hessian matrix (forward-forward AD) as dense symmetric matrices of size <tt>N</tt>-by-<tt>N</tt>, to be deleted by the caller
+  template <unsigned int NI, unsigned int NO> static unsigned int _hessian_bounds
+    ( const fadbad::F< fadbad::F< T, NI >, NO >& D2F, double*&HL, double*&HU );
+  //! @brief Computing spectral bound of interval Hessian matrix with lower and upper bounds <tt>HL</tt> and <tt>HU</tt> using the method selected in mc::Specbnd::Options::HESSBND
+  static std::pair<double,double> _spectral_bound
+    ( const unsigned int N, const double*HL, const double*HU );
+  //! @brief Computing spectral bound of interval Hessian matrix with lower and upper bounds <tt>HL</tt> and <tt>HU</tt> using Gershgorin's circle criterion with optimal diagonal scaling
+  static std::pair<double,double> _gershgorin_scaled_bound
+    ( const unsigned int N, const double*HL, const double*HU );
+  //! @brief Computing spectral bound of interval Hessian matrix with lower and upper bounds <tt>HL</tt> and <tt>HU</tt> using Rohn's midpoint-radius bound
+  static std::pair<double,double> _rohn_bound
+    ( const unsigned int N, const double*HL, const double*HU );
+  //! @brief Computing spectral bound of interval Hessian matrix with lower and upper bounds <tt>HL</tt> and <tt>HU</tt> using the E-matrix method
+  static std::pair<double,double> _ematrix_bound
+    ( const unsigned int N, const double*HL, const double*HU );
+  //! @brief Computing spectral bound of interval Hessian matrix with nonzero entries <tt>H</tt> in the order of the coloring <tt>HC</tt>, using the method selected in mc::Specbnd::Options::HESSBND
+  static std::pair<double,double> _spectral_bound
+    ( const HessColoring&HC, const std::vector<T>&H );
+  //! @brief Smallest and largest eigenvalues of symmetric <tt>N</tt>-by-<tt>N</tt> matrix <tt>A</tt> (altered on return) using the eigen-solver <tt>ES</tt>
+  static std::pair<double,double> _eigen_bound
+    ( EigenSolver&ES, const unsigned int N, double*A );
+  //! @brief <tt>i</tt>th smallest eigenvalue (1-based) of symmetric <tt>N</tt>-by-<tt>N</tt> matrix <tt>A</tt> (altered on return) using the eigen-solver <tt>ES</tt>
+  static double _eigenvalue
+    ( EigenSolver&ES, const unsigned int N, double*A, const unsigned int i );
+  //! @brief Computing spectral bound of interval Hessian matrix with lower and upper bounds <tt>HL</tt> and <tt>HU</tt> using Hertz & Rohn's method
   static std::pair<double,double> _hertzrohn_bound
-    ( const fadbad::F< fadbad::F< T > >& D2F );
+    ( const unsigned int N, const double*HL, const double*HU );
 
 public: 
   // other operator overloadings
@@ -411,15 +474,26 @@ public:
   {
     //! @brief Constructor
     Options():
-      HESSBND(GERSHGORIN)
+      HESSBND(GERSHGORIN), HERTZROHN_NTHREADS(0),
+      HERTZROHN_STOPL(-std::numeric_limits<double>::max()),
+      HERTZROHN_STOPU(std::numeric_limits<double>::max())
       {}
     //! @brief Strategy for computing spectral bounds in interval Hessian matrix
     enum HESSBND_STRATEGY{
       GERSHGORIN=0,	//!< Gershgorin circle's criterion
-      HERTZROHN		//!< Hertz & Rohn's method
+      HERTZROHN,	//!< Hertz & Rohn's method
+      GERSHGORIN_SCALED,//!< Gershgorin circle's criterion with optimal diagonal scaling
+      ROHN,		//!< Rohn's midpoint-radius bound
+      EMATRIX		//!< E-matrix method
     };
     //! @brief Method to bound eignevalues in interval Hessian matrix using mc::Specbnd::spectral_bound
     HESSBND_STRATEGY HESSBND;
+    //! @brief Number of threads for enumerating the vertex matrices in Hertz & Rohn's method, when compiled with OpenMP support (0: OpenMP default)
+    unsigned int HERTZROHN_NTHREADS;
+    //! @brief Stop enumerating the vertex matrices in Hertz & Rohn's method as soon as a lower spectral bound below this value is found
+    double HERTZROHN_STOPL;
+    //! @brief Stop enumerating the vertex matrices in Hertz & Rohn's method as soon as an upper spectral bound above this value is found
+    double HERTZROHN_STOPU;
   } options;
 
   //! @brief Exceptions of mc::Specbnd
@@ -534,21 +608,29 @@ public:
     return _spec;
   }
 
-  //! @brief Compute spectrum of Hessian matrix <tt>D2X</tt> of type fadbad::B< fadbad::F<double> >* using LAPACK function <tt>dsyev</tt>.
+  //! @brief Compute spectrum of Hessian matrix <tt>D2X</tt> of type fadbad::B< fadbad::F<double> >* using LAPACK functions <tt>dsytrd</tt> and <tt>dstebz</tt>.
   static std::pair<double,double> spectrum
     ( const fadbad::B< fadbad::F< double > >* D2X );
 
-  //! @brief Compute spectrum of Hessian matrix <tt>D2F</tt> of type fadbad::F< fadbad::F<double> > using LAPACK function <tt>dsyev</tt>.
+  //! @brief Compute spectrum of Hessian matrix <tt>D2F</tt> of type fadbad::F< fadbad::F<double> > using LAPACK functions <tt>dsytrd</tt> and <tt>dstebz</tt>.
   static std::pair<double,double> spectrum
     ( const fadbad::F< fadbad::F< double > >& D2X );
 
   //! @brief Compute spectral bound of interval Hessian matrix <tt>D2X</tt> of type fadbad::B< fadbad::F<T> >*. The bounding method is selected via mc::Specbnd::Options::HESSBND.
-  static std::pair<double,double> spectral_bound
-    ( const fadbad::B< fadbad::F< T > >* D2X );
+  template <unsigned int NI> static std::pair<double,double> spectral_bound
+    ( const fadbad::B< fadbad::F< T, NI > >* D2X );
 
   //! @brief Compute spectral bound of interval Hessian matrix <tt>D2X</tt> of type fadbad::F< fadbad::F<T> >. The bounding method is selected via mc::Specbnd::Options::HESSBND.
-  static std::pair<double,double> spectral_bound
-    ( const fadbad::F< fadbad::F< T > >& D2X );
+  template <unsigned int NI, unsigned int NO> static std::pair<double,double> spectral_bound
+    ( const fadbad::F< fadbad::F< T, NI >, NO >& D2X );
+
+  //! @brief Compute spectral bound of compressed interval Hessian matrix <tt>D2X</tt> of type fadbad::B< fadbad::F<T> >*, with the inner forward directions seeded according to the coloring <tt>HC</tt> (see \ref page_HESSPATTERN). The bounding method is selected via mc::Specbnd::Options::HESSBND.
+  template <unsigned int NI> static std::pair<double,double> spectral_bound
+    ( const fadbad::B< fadbad::F< T, NI > >* D2X, const HessColoring&HC );
+
+  //! @brief Compute spectral bound of compressed interval Hessian matrix <tt>D2X</tt> of type fadbad::F< fadbad::F<T> >, with the inner forward directions seeded according to the coloring <tt>HC</tt> (see \ref page_HESSPATTERN). The bounding method is selected via mc::Specbnd::Options::HESSBND.
+  template <unsigned int NI, unsigned int NO> static std::pair<double,double> spectral_bound
+    ( const fadbad::F< fadbad::F< T, NI >, NO >& D2X, const HessColoring&HC );
   /** @} */
 };
 
@@ -602,11 +684,11 @@ Specbnd<T>::spectrum
   mc::display( N, N, H, N, "\nMatrix H", std::cout );
 #endif
 
-  double*D = mc::dsyev_wrapper( N, H );
+  EigenSolver ES;
+  std::pair<double,double> spbnd;
+  const bool ok = ES.extremes( N, H, spbnd.first, spbnd.second );
   delete[] H;
-  if( !D ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::SPECTR );
-  std::pair<double,double> spbnd = std::make_pair( min(N,D), max(N,D) );
-  delete[] D;
+  if( !ok ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::SPECTR );
   return spbnd;
 }
 
@@ -626,30 +708,34 @@ Specbnd<T>::spectrum
   mc::display( N, N, H, N, "\nMatrix H", std::cout );
 #endif
 
-  double*D = mc::dsyev_wrapper( N, H );
+  EigenSolver ES;
+  std::pair<double,double> spbnd;
+  const bool ok = ES.extremes( N, H, spbnd.first, spbnd.second );
   delete[] H;
-  if( !D ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::SPECTR );
-  std::pair<double,double> spbnd = std::make_pair( min(N,D), max(N,D) );
-  delete[] D;
+  if( !ok ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::SPECTR );
   return spbnd;
 }
 
-template <typename T> inline std::pair<double,double>
+template <typename T> template <unsigned int NI> inline std::pair<double,double>
 Specbnd<T>::spectral_bound
-( const fadbad::B< fadbad::F< T > >* D2X )
+( const fadbad::B< fadbad::F< T, NI > >* D2X )
 {
   if( !D2X ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
-  switch( options.HESSBND ){
-  case Options::GERSHGORIN:
+  if( options.HESSBND == Options::GERSHGORIN )
     return _gershgorin_bound( D2X );
-  case Options::HERTZROHN: default:
-    return _hertzrohn_bound( D2X );
-  }
+
+  double *HL = 0, *HU = 0;
+  const unsigned int N = _hessian_bounds( D2X, HL, HU );
+  std::pair<double,double> spbnd;
+  try{ spbnd = _spectral_bound( N, HL, HU ); }
+  catch(...){ delete[] HL; delete[] HU; throw; }
+  delete[] HL; delete[] HU;
+  return spbnd;
 }
 
-template <typename T> inline std::pair<double,double>
+template <typename T> template <unsigned int NI> inline std::pair<double,double>
 Specbnd<T>::_gershgorin_bound
-( const fadbad::B< fadbad::F< T > >* D2X )
+( const fadbad::B< fadbad::F< T, NI > >* D2X )
 {
   const unsigned int N = D2X->val().size();
   if( !N ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
@@ -677,104 +763,50 @@ Specbnd<T>::_gershgorin_bound
   return spbnd;
 }
 
-template <typename T> inline std::pair<double,double>
-Specbnd<T>::_hertzrohn_bound
-( const fadbad::B< fadbad::F< T > >* D2X )
+template <typename T> template <unsigned int NI> inline unsigned int
+Specbnd<T>::_hessian_bounds
+( const fadbad::B< fadbad::F< T, NI > >* D2X, double*&HL, double*&HU )
 {
   const unsigned int N = D2X->val().size();
   if( !N ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
 
-  // Form matrix S^{(N)} recursively
-  unsigned int col_S = 2;
-  short *S = new short[col_S];
-  S[0] = 1; S[1] = -1;
-#ifdef MC__SPECBND_DEBUG_HESSBND
-  mc::display( 1, col_S, S, 1, "\nMatrix S1", std::cout );
-#endif
-  for( unsigned int k=1; k<N; k++, col_S*=2 ){
-    short *Sprev = new short[k*col_S];
-    for( unsigned int i=0; i<k; i++ )
-      for( unsigned int j=0; j<col_S; j++ )
-        Sprev[j*k+i] = S[j*k+i];
-    delete[] S; S = new short[(k+1)*2*col_S];
-    for( unsigned int i=0; i<k; i++ ){
-      for( unsigned int j=0; j<col_S; j++ )
-        S[j*(k+1)+i] = S[(col_S+j)*(k+1)+i] = Sprev[j*k+i];
-    }
-    for( unsigned int j=0; j<col_S; j++ ){
-      S[j*(k+1)+k] = 1; S[(col_S+j)*(k+1)+k] = -1;
-    }
-    delete[] Sprev;
-#ifdef MC__SPECBND_DEBUG_HESSBND
-    mc::display( k+1, 2*col_S, S, k+1, "\nMatrix Sk", std::cout );
-#endif
-  }
-
-  // Compute lower and upper bound on spectral radius
-  std::pair<double,double> spbnd;
-  double *Lk = new double[N*N], *Uk = new double[N*N];
-  for( unsigned int k=0; k<col_S; k++ ){
-    
-    for( unsigned int j=0; j<N; j++ )
-      for( unsigned int i=j; i<N; i++ ){
-        if( i == j ){
-	  Lk[i*N+i] = Op<T>::l( D2X[i].deriv(0).deriv(i) );
-	  Uk[i*N+i] = Op<T>::u( D2X[i].deriv(0).deriv(i) );
-          continue;
-	}
-        T D2Fij;
-        if( !inter( D2Fij, D2X[i].deriv(0).deriv(j), D2X[j].deriv(0).deriv(i) ) )
-          D2Fij = D2X[i].deriv(0).deriv(j);
-        Lk[i*N+j] = Lk[j*N+i] = S[k*N+i]*S[k*N+j]==1? Op<T>::l( D2Fij ): Op<T>::u( D2Fij );
-        Uk[i*N+j] = Uk[j*N+i] = S[k*N+i]*S[k*N+j]==1? Op<T>::u( D2Fij ): Op<T>::l( D2Fij );
+  // Lower and upper bounds of interval Hessian matrix
+  HL = new double[N*N]; HU = new double[N*N];
+  for( unsigned int j=0; j<N; j++ )
+    for( unsigned int i=j; i<N; i++ ){
+      if( i == j ){
+        HL[i*N+i] = Op<T>::l( D2X[i].deriv(0).deriv(i) );
+        HU[i*N+i] = Op<T>::u( D2X[i].deriv(0).deriv(i) );
+        continue;
       }
-#ifdef MC__SPECBND_DEBUG_HESSBND
-    mc::display( N, N, Lk, N, "\nMatrix Lk", std::cout );
-    mc::display( N, N, Uk, N, "\nMatrix Uk", std::cout );
-#endif
-
-    double*DLk = mc::dsyev_wrapper( N, Lk );
-    if( !DLk ){
-      delete[] Lk; delete[] Uk; delete[] S;
-      throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
-    }
-#ifdef MC__SPECBND_DEBUG_HESSBND
-    mc::display( 1, N, DLk, 1, "\nMatrix DLk", std::cout );
-#endif
-    spbnd.first = k? std::min( spbnd.first, min(N,DLk) ): min(N,DLk);
-    delete[] DLk;
-
-    double*DUk = mc::dsyev_wrapper( N, Uk );
-    if( !DUk ){
-      delete[] Lk; delete[] Uk; delete[] S;
-      throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
+      T D2Fij;
+      if( !inter( D2Fij, D2X[i].deriv(0).deriv(j), D2X[j].deriv(0).deriv(i) ) )
+        D2Fij = D2X[i].deriv(0).deriv(j);
+      HL[i*N+j] = HL[j*N+i] = Op<T>::l( D2Fij );
+      HU[i*N+j] = HU[j*N+i] = Op<T>::u( D2Fij );
     }
-#ifdef MC__SPECBND_DEBUG_HESSBND
-    mc::display( 1, N, DUk, 1, "\nMatrix DUk", std::cout );
-#endif
-    spbnd.second = k? std::max( spbnd.second, max(N,DUk) ): max(N,DUk);
-    delete[] DUk;
-
-  }
-  delete[] Lk; delete[] Uk; delete[] S;
-  return spbnd;
+  return N;
 }
 
-template <typename T> inline std::pair<double,double>
+template <typename T> template <unsigned int NI, unsigned int NO> inline std::pair<double,double>
 Specbnd<T>::spectral_bound
-( const fadbad::F< fadbad::F< T > >& D2F )
+( const fadbad::F< fadbad::F< T, NI >, NO >& D2F )
 {
-  switch( options.HESSBND ){
-  case Options::GERSHGORIN:
+  if( options.HESSBND == Options::GERSHGORIN )
     return _gershgorin_bound( D2F );
-  case Options::HERTZROHN: default:
-    return _hertzrohn_bound( D2F );
-  }
+
+  double *HL = 0, *HU = 0;
+  const unsigned int N = _hessian_bounds( D2F, HL, HU );
+  std::pair<double,double> spbnd;
+  try{ spbnd = _spectral_bound( N, HL, HU ); }
+  catch(...){ delete[] HL; delete[] HU; throw; }
+  delete[] HL; delete[] HU;
+  return spbnd;
 }
 
-template <typename T> inline std::pair<double,double>
+template <typename T> template <unsigned int NI, unsigned int NO> inline std::pair<double,double>
 Specbnd<T>::_gershgorin_bound
-( const fadbad::F< fadbad::F< T > >& D2F )
+( const fadbad::F< fadbad::F< T, NI >, NO >& D2F )
 {
   const unsigned int N = D2F.size();
   if( !N ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
@@ -802,104 +834,318 @@ Specbnd<T>::_gershgorin_bound
   return spbnd;
 }
 
-template <typename T> inline std::pair<double,double>
-Specbnd<T>::_hertzrohn_bound
-( const fadbad::F< fadbad::F< T > >& D2F )
+template <typename T> template <unsigned int NI, unsigned int NO> inline unsigned int
+Specbnd<T>::_hessian_bounds
+( const fadbad::F< fadbad::F< T, NI >, NO >& D2F, double*&HL, double*&HU )
 {
   const unsigned int N = D2F.size();
   if( !N ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
 
-  // Form matrix S^{(N)} recursively
-  unsigned int col_S = 2;
-  short *S = new short[col_S];
-  S[0] = 1; S[1] = -1;
-#ifdef MC__SPECBND_DEBUG_HESSBND
-  mc::display( 1, col_S, S, 1, "\nMatrix S1", std::cout );
-#endif
-  for( unsigned int k=1; k<N; k++, col_S*=2 ){
-    short *Sprev = new short[k*col_S];
-    for( unsigned int i=0; i<k; i++ )
-      for( unsigned int j=0; j<col_S; j++ )
-        Sprev[j*k+i] = S[j*k+i];
-    delete[] S; S = new short[(k+1)*2*col_S];
-    for( unsigned int i=0; i<k; i++ ){
-      for( unsigned int j=0; j<col_S; j++ )
-        S[j*(k+1)+i] = S[(col_S+j)*(k+1)+i] = Sprev[j*k+i];
-    }
-    for( unsigned int j=0; j<col_S; j++ ){
-      S[j*(k+1)+k] = 1; S[(col_S+j)*(k+1)+k] = -1;
-    }
-    delete[] Sprev;
-#ifdef MC__SPECBND_DEBUG_HESSBND
-    mc::display( k+1, 2*col_S, S, k+1, "\nMatrix Sk", std::cout );
-#endif
-  }
-
-#ifdef MC__SPECBND_DEBUG_HESSBND
-  T *H = new T[N*N];
+  // Lower and upper bounds of interval Hessian matrix
+  HL = new double[N*N]; HU = new double[N*N];
   for( unsigned int j=0; j<N; j++ )
     for( unsigned int i=j; i<N; i++ ){
       if( i == j ){
-        H[i*N+i] = D2F.deriv(i).deriv(i);
+        HL[i*N+i] = Op<T>::l( D2F.deriv(i).deriv(i) );
+        HU[i*N+i] = Op<T>::u( D2F.deriv(i).deriv(i) );
         continue;
       }
       T D2Fij;
       if( !inter( D2Fij, D2F.deriv(i).deriv(j), D2F.deriv(j).deriv(i) ) )
         D2Fij = D2F.deriv(i).deriv(j);
-      H[i*N+j] = H[j*N+i] = D2Fij;
+      HL[i*N+j] = HL[j*N+i] = Op<T>::l( D2Fij );
+      HU[i*N+j] = HU[j*N+i] = Op<T>::u( D2Fij );
     }
-  mc::display( N, N, H, N, "\nMatrix H", std::cout );
-  delete[] H;
-#endif
+  return N;
+}
 
-  // Compute lower and upper bound on spectral radius
+template <typename T> template <unsigned int NI> inline std::pair<double,double>
+Specbnd<T>::spectral_bound
+( const fadbad::B< fadbad::F< T, NI > >* D2X, const HessColoring&HC )
+{
+  if( !D2X || !HC.n() ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
+  std::vector<T> H( HC.nnz(), T(0.) );
+  for( unsigned int k=0; k<HC.nnz(); k++ )
+    H[k] = D2X[HC.source(k).first].deriv(0).deriv(HC.source(k).second);
+  return _spectral_bound( HC, H );
+}
+
+template <typename T> template <unsigned int NI, unsigned int NO> inline std::pair<double,double>
+Specbnd<T>::spectral_bound
+( const fadbad::F< fadbad::F< T, NI >, NO >& D2F, const HessColoring&HC )
+{
+  if( !HC.n() ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
+  std::vector<T> H( HC.nnz(), T(0.) );
+  for( unsigned int k=0; k<HC.nnz(); k++ )
+    H[k] = D2F.deriv(HC.source(k).first).deriv(HC.source(k).second);
+  return _spectral_bound( HC, H );
+}
+
+template <typename T> inline std::pair<double,double>
+Specbnd<T>::_spectral_bound
+( const HessColoring&HC, const std::vector<T>&H )
+{
+  const unsigned int N = HC.n();
+
+  // Gershgorin's circle criterion visiting the nonzero entries only
+  if( options.HESSBND == Options::GERSHGORIN ){
+    std::vector<double> DL( N, 0. ), DU( N, 0. ), R( N, 0. );
+    for( unsigned int k=0; k<HC.nnz(); k++ ){
+      const unsigned int i = HC.entry(k).first, j = HC.entry(k).second;
+      if( i == j ){ DL[i] = Op<T>::l( H[k] ); DU[i] = Op<T>::u( H[k] ); continue; }
+      const double Hij = Op<T>::abs( H[k] );
+      R[i] += Hij; R[j] += Hij;
+    }
+    std::pair<double,double> spbnd( DL[0]-R[0], DU[0]+R[0] );
+    for( unsigned int i=1; i<N; i++ ){
+      spbnd.first  = std::min( spbnd.first,  DL[i]-R[i] );
+      spbnd.second = std::max( spbnd.second, DU[i]+R[i] );
+    }
+    return spbnd;
+  }
+
+  // Other methods applied to the dense bounds, with structural zeros
+  double *HL = new double[N*N], *HU = new double[N*N];
+  for( unsigned int k=0; k<N*N; k++ ) HL[k] = HU[k] = 0.;
+  for( unsigned int k=0; k<HC.nnz(); k++ ){
+    const unsigned int i = HC.entry(k).first, j = HC.entry(k).second;
+    HL[i*N+j] = HL[j*N+i] = Op<T>::l( H[k] );
+    HU[i*N+j] = HU[j*N+i] = Op<T>::u( H[k] );
+  }
   std::pair<double,double> spbnd;
-  double *Lk = new double[N*N], *Uk = new double[N*N];
-  for( unsigned int k=0; k<col_S; k++ ){
-    
-    for( unsigned int j=0; j<N; j++ )
-      for( unsigned int i=j; i<N; i++ ){
-        if( i == j ){
-	  Lk[i*N+i] = Op<T>::l( D2F.deriv(i).deriv(i) );
-	  Uk[i*N+i] = Op<T>::u( D2F.deriv(i).deriv(i) );
-          continue;
-	}
-        T D2Fij;
-        if( !inter( D2Fij, D2F.deriv(i).deriv(j), D2F.deriv(j).deriv(i) ) )
-          D2Fij = D2F.deriv(i).deriv(j);
-        Lk[i*N+j] = Lk[j*N+i] = S[k*N+i]*S[k*N+j]==1? Op<T>::l( D2Fij ): Op<T>::u( D2Fij );
-        Uk[i*N+j] = Uk[j*N+i] = S[k*N+i]*S[k*N+j]==1? Op<T>::u( D2Fij ): Op<T>::l( D2Fij );
-      }
-#ifdef MC__SPECBND_DEBUG_HESSBND
-    mc::display( N, N, Lk, N, "\nMatrix Lk", std::cout );
-    mc::display( N, N, Uk, N, "\nMatrix Uk", std::cout );
-#endif
+  try{ spbnd = _spectral_bound( N, HL, HU ); }
+  catch(...){ delete[] HL; delete[] HU; throw; }
+  delete[] HL; delete[] HU;
+  return spbnd;
+}
 
-    double*DLk = mc::dsyev_wrapper( N, Lk );
-    if( !DLk ){
-      delete[] Lk; delete[] Uk; delete[] S;
-      throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
+template <typename T> inline std::pair<double,double>
+Specbnd<T>::_spectral_bound
+( const unsigned int N, const double*HL, const double*HU )
+{
+  switch( options.HESSBND ){
+  case Options::GERSHGORIN_SCALED:
+    return _gershgorin_scaled_bound( N, HL, HU );
+  case Options::ROHN:
+    return _rohn_bound( N, HL, HU );
+  case Options::EMATRIX:
+    return _ematrix_bound( N, HL, HU );
+  case Options::HERTZROHN: default:
+    return _hertzrohn_bound( N, HL, HU );
+  }
+}
+
+template <typename T> inline std::pair<double,double>
+Specbnd<T>::_eigen_bound
+( EigenSolver&ES, const unsigned int N, double*A )
+{
+  std::pair<double,double> eigbnd;
+  if( !ES.extremes( N, A, eigbnd.first, eigbnd.second ) )
+    throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
+  return eigbnd;
+}
+
+template <typename T> inline double
+Specbnd<T>::_eigenvalue
+( EigenSolver&ES, const unsigned int N, double*A, const unsigned int i )
+{
+  double lambda;
+  if( !ES.dsyevr( N, A, i, i, &lambda ) )
+    throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
+  return lambda;
+}
+
+template <typename T> inline std::pair<double,double>
+Specbnd<T>::_gershgorin_scaled_bound
+( const unsigned int N, const double*HL, const double*HU )
+{
+  // Minimizing the Gershgorin radii over all positive diagonal scalings
+  // amounts to computing the extreme eigenvalues of the comparison matrices
+  // with diagonals HL_ii (resp. HU_ii) and off-diagonals -|H_ij| (resp. |H_ij|)
+  double *CL = new double[N*N], *CU = new double[N*N];
+  for( unsigned int j=0; j<N; j++ ){
+    CL[j*N+j] = HL[j*N+j];
+    CU[j*N+j] = HU[j*N+j];
+    for( unsigned int i=j+1; i<N; i++ ){
+      const double Mij = std::max( std::fabs(HL[j*N+i]), std::fabs(HU[j*N+i]) );
+      CL[j*N+i] = CL[i*N+j] = -Mij;
+      CU[j*N+i] = CU[i*N+j] = Mij;
     }
+  }
+
+  std::pair<double,double> spbnd;
+  try{
+    EigenSolver ES;
+    spbnd.first  = _eigenvalue( ES, N, CL, 1 );
+    spbnd.second = _eigenvalue( ES, N, CU, N );
+  }
+  catch(...){ delete[] CL; delete[] CU; throw; }
+  delete[] CL; delete[] CU;
+  return spbnd;
+}
+
+template <typename T> inline std::pair<double,double>
+Specbnd<T>::_rohn_bound
+( const unsigned int N, const double*HL, const double*HU )
+{
+  // Midpoint and radius matrices; the spectral radius of the nonnegative
+  // radius matrix is its largest eigenvalue
+  double *HM = new double[N*N], *HR = new double[N*N];
+  for( unsigned int k=0; k<N*N; k++ ){
+    HM[k] = 0.5*(HL[k]+HU[k]);
+    HR[k] = 0.5*(HU[k]-HL[k]);
+  }
+
+  std::pair<double,double> spbnd;
+  try{
+    EigenSolver ES;
+    spbnd = _eigen_bound( ES, N, HM );
+    const double rho = _eigenvalue( ES, N, HR, N );
+    spbnd.first  -= rho;
+    spbnd.second += rho;
+  }
+  catch(...){ delete[] HM; delete[] HR; throw; }
+  delete[] HM; delete[] HR;
+  return spbnd;
+}
+
+template <typename T> inline std::pair<double,double>
+Specbnd<T>::_ematrix_bound
+( const unsigned int N, const double*HL, const double*HU )
+{
+  // Shifting the diagonal entries to their bounds, HM-+diag(dH) bounds
+  // the diagonal part exactly and only the off-diagonal radius is
+  // accounted for via its spectral radius
+  double *HEL = new double[N*N], *HEU = new double[N*N], *HR = new double[N*N];
+  for( unsigned int j=0; j<N; j++ ){
+    HEL[j*N+j] = HL[j*N+j];
+    HEU[j*N+j] = HU[j*N+j];
+    HR[j*N+j]  = 0.;
+    for( unsigned int i=j+1; i<N; i++ ){
+      HEL[j*N+i] = HEL[i*N+j] = HEU[j*N+i] = HEU[i*N+j]
+        = 0.5*(HL[j*N+i]+HU[j*N+i]);
+      HR[j*N+i] = HR[i*N+j] = 0.5*(HU[j*N+i]-HL[j*N+i]);
+    }
+  }
+
+  std::pair<double,double> spbnd;
+  try{
+    EigenSolver ES;
+    const double rho = N>1? _eigenvalue( ES, N, HR, N ): 0.;
+    spbnd.first  = _eigenvalue( ES, N, HEL, 1 ) - rho;
+    spbnd.second = _eigenvalue( ES, N, HEU, N ) + rho;
+  }
+  catch(...){ delete[] HEL; delete[] HEU; delete[] HR; throw; }
+  delete[] HEL; delete[] HEU; delete[] HR;
+  return spbnd;
+}
+
+template <typename T> inline std::pair<double,double>
+Specbnd<T>::_hertzrohn_bound
+( const unsigned int N, const double*HL, const double*HU )
+{
 #ifdef MC__SPECBND_DEBUG_HESSBND
-    mc::display( 1, N, DLk, 1, "\nMatrix DLk", std::cout );
+  mc::display( N, N, HL, N, "\nMatrix HL", std::cout );
+  mc::display( N, N, HU, N, "\nMatrix HU", std::cout );
 #endif
-    spbnd.first = k? std::min( spbnd.first, min(N,DLk) ): min(N,DLk);
-    delete[] DLk;
+  // The vertex matrices for the sign vectors s and -s coincide, so only the
+  // 2^(N-1) sign vectors with s_{N-1}=1 are enumerated; s_i=-1 iff bit i of k
+  if( N > 8*sizeof(long)-1 )
+    throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
+  const long NS = 1L<<(N-1);
+  const double STOPL = options.HERTZROHN_STOPL, STOPU = options.HERTZROHN_STOPU;
 
-    double*DUk = mc::dsyev_wrapper( N, Uk );
-    if( !DUk ){
-      delete[] Lk; delete[] Uk; delete[] S;
-      throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
+  // Compute lower and upper bound on spectral radius
+  double lambdaL = std::numeric_limits<double>::max();
+  double lambdaU = -std::numeric_limits<double>::max();
+  // Flags shared by the threads, only accessed atomically within the parallel region
+  int stop = 0, fail = 0;
+#ifdef _OPENMP
+  const int nthreads = options.HERTZROHN_NTHREADS? options.HERTZROHN_NTHREADS:
+                       omp_get_max_threads();
+  #pragma omp parallel num_threads(nthreads)
+#endif
+  {
+    // Thread-local matrices and eigen-solver; only the smallest eigenvalue
+    // of Lk and the largest eigenvalue of Uk are needed. No exception may
+    // leave the parallel region, so failures are reported through the flag
+    std::vector<double> Lk, Uk;
+    EigenSolver ES;
+    double lambdaLk = std::numeric_limits<double>::max();
+    double lambdaUk = -std::numeric_limits<double>::max();
+    try{ Lk.resize( N*N ); Uk.resize( N*N ); }
+    catch(...){
+#ifdef _OPENMP
+      #pragma omp atomic write
+#endif
+      fail = 1;
     }
+#ifdef _OPENMP
+    #pragma omp for schedule(dynamic,16)
+#endif
+    for( long k=0; k<NS; k++ ){
+      int stopped, failed;
+#ifdef _OPENMP
+      #pragma omp atomic read
+#endif
+      stopped = stop;
+#ifdef _OPENMP
+      #pragma omp atomic read
+#endif
+      failed = fail;
+      if( stopped || failed ) continue;
+
+      for( unsigned int j=0; j<N; j++ ){
+        Lk[j*N+j] = HL[j*N+j];
+        Uk[j*N+j] = HU[j*N+j];
+        const bool sj = (k>>j)&1L;
+        for( unsigned int i=j+1; i<N; i++ ){
+          const bool si = (k>>i)&1L;
+          Lk[j*N+i] = Lk[i*N+j] = ( si==sj? HL[j*N+i]: HU[j*N+i] );
+          Uk[j*N+i] = Uk[i*N+j] = ( si==sj? HU[j*N+i]: HL[j*N+i] );
+        }
+      }
 #ifdef MC__SPECBND_DEBUG_HESSBND
-    mc::display( 1, N, DUk, 1, "\nMatrix DUk", std::cout );
+      mc::display( N, N, &Lk[0], N, "\nMatrix Lk", std::cout );
+      mc::display( N, N, &Uk[0], N, "\nMatrix Uk", std::cout );
+#endif
+
+      double lambda1, lambdaN;
+      bool ok;
+      try{
+        ok = ES.dsyevr( N, &Lk[0], 1, 1, &lambda1 )
+          && ES.dsyevr( N, &Uk[0], N, N, &lambdaN );
+      }
+      catch(...){ ok = false; }
+      if( !ok ){
+#ifdef _OPENMP
+        #pragma omp atomic write
 #endif
-    spbnd.second = k? std::max( spbnd.second, max(N,DUk) ): max(N,DUk);
-    delete[] DUk;
+        fail = 1;
+        continue;
+      }
+      if( lambda1 < lambdaLk ) lambdaLk = lambda1;
+      if( lambdaN > lambdaUk ) lambdaUk = lambdaN;
 
+      // Early termination once requested bound is certified
+      if( lambdaLk < STOPL || lambdaUk > STOPU ){
+#ifdef _OPENMP
+        #pragma omp atomic write
+#endif
+        stop = 1;
+      }
+    }
+#ifdef _OPENMP
+    #pragma omp critical
+#endif
+    {
+      if( lambdaLk < lambdaL ) lambdaL = lambdaLk;
+      if( lambdaUk > lambdaU ) lambdaU = lambdaUk;
+    }
   }
-  delete[] Lk; delete[] Uk; delete[] S;
-  return spbnd;
+
+  if( fail ) throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::HESSBND );
+  return std::make_pair( lambdaL, lambdaU );
 }
 
 template <class T> inline std::ostream&
@@ -969,7 +1215,7 @@ Specbnd<T>::operator+=
     throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::SIZE );
   _FI += y._FI;
   _n = _FI.size();
-  _spec += y.spec;
+  _spec += y._spec;
   return *this;
 }
 
@@ -1027,7 +1273,7 @@ Specbnd<T>::operator-=
     throw typename Specbnd<T>::Exceptions( Specbnd<T>::Exceptions::SIZE );
   _FI -= y._FI;
   _n = _FI.size();
-  _spec -= y.spec;
+  _spec -= y._spec;
   return *this;
 }
 
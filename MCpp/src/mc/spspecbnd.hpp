@@ -0,0 +1,894 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+/*!
+\page page_SPSPECBND Eigenvalue Arithmetic with Sparse Gradients
+\author Beno&icirc;t Chachuat
+
+The class mc::SpSpecbnd provides the same eigenvalue arithmetic as mc::Specbnd (see \ref page_SPECBND), based on M&ouml;nnigmann's technique [M&ouml;nnigmann, 2008; 2011], but it stores the gradient bounds in sparse format. Only the structurally nonzero components of the gradient are kept, sorted by increasing variable index. The gradient bounds and the spectral bound terms \f$\sum_i \overline{(a_i^2)}\f$ and \f$\sum_i a_i b_i\f$ in products and univariate terms are then computed in a number of operations proportional to the number of nonzeros, rather than to the total number of independent variables. This is advantageous for functions with many variables in which most intermediate terms only depend on a few variables.
+
+mc::SpSpecbnd computes the same spectral bounds as mc::Specbnd. In particular, it is <B>not a verified implementation</B> either, in the sense that rounding errors are not accounted for in propagating the spectral bounds.
+
+
+\section sec_SPSPECBND_I How do I compute (interval) bounds on the spectrum of the Hessian matrix of a factorable function with sparse gradients?
+
+The usage of mc::SpSpecbnd is the same as mc::Specbnd. For instance, a spectral bound for the Hessian matrix of the function \f$f(x)=\sum_{i=1}^{n-1}\exp(x_i x_{i+1})\f$ for \f$x\in [-1,1]^n\f$ with \f$n=200\f$ is calculated as follows:
+
+\code
+      #include "interval.hpp"
+      #include "spspecbnd.hpp"
+      typedef mc::Interval I;
+      typedef mc::SpSpecbnd<I> SSB;
+
+      const unsigned int NX = 200;
+      SSB X[NX], F = 0.;
+      for( unsigned int i=0; i<NX; i++ ) X[i].set( I(-1.,1.), i, NX );
+      for( unsigned int i=0; i<NX-1; i++ ) F += exp( X[i]*X[i+1] );
+\endcode
+
+The computed spectral bounds can be retrieved as <tt>F.SI()</tt>, the function bounds as <tt>F.I()</tt>, and the gradient bounds either as a dense fadbad::F<I> variable with <tt>F.FI()</tt> or component-wise with <tt>F.D(i)</tt>. The number of structurally nonzero gradient components is given by <tt>F.nnz()</tt>.
+
+
+\section sec_SPSPECBND_err Errors What errors can I encounter during computation of a spectral bound with sparse gradients?
+
+Errors are managed based on the exception handling mechanism of the C++ language. Each time an error is encountered, a class object of type mc::SpSpecbnd::Exceptions is thrown, which contains the type of error.
+
+Possible errors encountered during the computation of a spectral bound are:
+
+<TABLE border="1">
+<CAPTION><EM>Errors during the Computation of a Spectral Bound with Sparse Gradients</EM></CAPTION>
+     <TR><TH><b>Number</b> <TD><b>Description</b>
+     <TR><TH><tt>-1</tt> <TD>Operation between variables with different numbers of dependents
+     <TR><TH><tt>-2</tt> <TD>Variable index out of range
+     <TR><TH><tt>-33</tt> <TD>Feature not yet implemented in mc::SpSpecbnd
+</TABLE>
+
+Moreover, exceptions may be thrown by the template parameter class itself.
+
+
+\section sec_SPSPECBND_refs References
+
+- M&ouml;nnigmann, M., <A href="http://dx.doi.org/10.1137/070704186">Efficient calculation of bounds on spectra of Hessian matrices</A>, <i>SIAM Journal on Scientific Computing</i>, <b>30</b>:2340-2357, 2008.
+- M&ouml;nnigmann, M., <A href="http://dx.doi.org/10.1137/10078760X">Fast Calculation of Spectral Bounds for Hessian Matrices on Hyperrectangles</A>, <i>SIAM Journal on Matrix Analysis and Applications</i>, <b>32</b>:4, 1351-1366, 2011.
+.
+
+*/
+
+#ifndef MC__SPSPECBND_H
+#define MC__SPSPECBND_H
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "mcop.hpp"
+#include "fadiff.h"
+
+namespace mc
+{
+//! @brief C++ template class computing spectral bounds for the Hessian matrix of a factorable function on a box using sparse gradients
+////////////////////////////////////////////////////////////////////////
+//! mc::SpSpecbnd<T> is a C++ template class computing spectral bounds
+//! for the Hessian matrix of a factorable function on a box, with the
+//! gradient bounds stored in sparse format. The template parameter T
+//! corresponds to the type used in the underlying interval arithmetic
+//! calculations.
+////////////////////////////////////////////////////////////////////////
+template <typename T>
+class SpSpecbnd
+////////////////////////////////////////////////////////////////////////
+{
+  template <class U> friend SpSpecbnd<U> operator+(const SpSpecbnd<U> &x );
+  template <class U> friend SpSpecbnd<U> operator+(const SpSpecbnd<U> &x, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> operator+(const SpSpecbnd<U> &y, const double c);
+  template <class U> friend SpSpecbnd<U> operator+(const double c, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> operator-(const SpSpecbnd<U> &x );
+  template <class U> friend SpSpecbnd<U> operator-(const SpSpecbnd<U> &x, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> operator-(const SpSpecbnd<U> &y, const double c);
+  template <class U> friend SpSpecbnd<U> operator-(const double c, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> operator*(const SpSpecbnd<U> &x, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> operator*(const double c, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> operator*(const SpSpecbnd<U> &y, const double c);
+  template <class U> friend SpSpecbnd<U> pow(const SpSpecbnd<U> &x, const int m);
+  template <class U> friend SpSpecbnd<U> pow(const SpSpecbnd<U> &x, const double c);
+  template <class U> friend SpSpecbnd<U> pow(const SpSpecbnd<U> &x, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> pow(const double c, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> inv(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> operator/(const SpSpecbnd<U> &x, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> operator/(const SpSpecbnd<U> &y, const double c);
+  template <class U> friend SpSpecbnd<U> operator/(const double c, const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> sqr(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> sqrt(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> exp(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> log(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> xlog(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> cos(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> sin(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> acos(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> asin(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> tan(const SpSpecbnd<U> &y);
+  template <class U> friend SpSpecbnd<U> atan(const SpSpecbnd<U> &y);
+  template <class U> friend std::ostream& operator<<(std::ostream&, const SpSpecbnd<U>&);
+
+private:
+  //! @brief Number of independent variables
+  unsigned int _n;
+  //! @brief Function bounds
+  T _I;
+  //! @brief Indices of structurally nonzero gradient components, in increasing order
+  std::vector<unsigned int> _ndx;
+  //! @brief Bounds of structurally nonzero gradient components, in the order of <tt>_ndx</tt>
+  std::vector<T> _grad;
+  //! @brief Spectral bound
+  T _spec;
+
+  //! @brief Internal function for spectral bound propagation in univariate terms
+  static T _LambdaS( const SpSpecbnd<T> &a, const unsigned int n );
+  //! @brief Internal function for spectral bound propagation in product terms
+  static T _LambdaT( const SpSpecbnd<T> &a, const SpSpecbnd<T> &b, const unsigned int n );
+
+  //! @brief Set gradient bounds to <tt>cx*x+cy*y</tt>, with a NULL pointer <tt>cx</tt> or <tt>cy</tt> standing for a unit coefficient, and <tt>y</tt> negated if <tt>negy=true</tt>
+  void _lincomb
+    ( const SpSpecbnd<T>&x, const T*cx, const SpSpecbnd<T>&y, const T*cy,
+      const bool negy=false );
+  //! @brief Set gradient bounds to <tt>c*y</tt>
+  void _scale
+    ( const SpSpecbnd<T>&y, const T&c );
+  //! @brief Check consistency of the numbers of dependents in <tt>x</tt> and <tt>y</tt>, and return the resulting number of dependents
+  static unsigned int _dep
+    ( const SpSpecbnd<T>&x, const SpSpecbnd<T>&y );
+
+public:
+  // other operator overloadings
+  SpSpecbnd<T>& operator+=
+    ( const SpSpecbnd<T>& );
+  SpSpecbnd<T>& operator+=
+    ( const double );
+  SpSpecbnd<T>& operator-=
+    ( const SpSpecbnd<T>& );
+  SpSpecbnd<T>& operator-=
+    ( const double );
+  SpSpecbnd<T>& operator*=
+    ( const SpSpecbnd<T>& );
+  SpSpecbnd<T>& operator*=
+    ( const double );
+  SpSpecbnd<T>& operator/=
+    ( const SpSpecbnd<T>& );
+  SpSpecbnd<T>& operator/=
+    ( const double );
+  SpSpecbnd<T> & operator=
+    ( const double c );
+  SpSpecbnd<T> & operator=
+    ( const T &c );
+
+  /** @defgroup SPSPECBND Eigenvalue Arithmetic with Sparse Gradients
+   *  @{
+   */
+  //! @brief Exceptions of mc::SpSpecbnd
+  class Exceptions
+  {
+  public:
+    //! @brief Enumeration type for SpSpecbnd exception handling
+    enum TYPE{
+      SIZE=-1,	//!< Operation between variables with different numbers of dependents
+      INDEX=-2,	//!< Variable index out of range
+      UNDEF=-33 //!< Feature not yet implemented in mc::SpSpecbnd
+    };
+    //! @brief Constructor for error <a>ierr</a>
+    Exceptions( TYPE ierr ) : _ierr( ierr ){}
+    //! @brief Inline function returning the error flag
+    int ierr(){ return _ierr; }
+    //! @brief Error description
+    std::string what(){
+      switch( _ierr ){
+      case SIZE:
+        return "mc::SpSpecbnd\t Operation between variables with different numbers of dependents";
+      case INDEX:
+        return "mc::SpSpecbnd\t Variable index out of range";
+      case UNDEF:
+        return "mc::SpSpecbnd\t Feature not yet implemented in mc::SpSpecbnd class";
+      default:
+        return "mc::SpSpecbnd\t Undocumented error";
+      }
+    }
+
+  private:
+    TYPE _ierr;
+  };
+
+  //! @brief Default constructor (needed to declare arrays of SpSpecbnd)
+  SpSpecbnd():
+    _n(0), _I(0.), _spec(0.)
+  {}
+
+  //! @brief Constructor for real scalar <tt>c</tt>
+  SpSpecbnd( const double c ):
+    _n(0), _I(c), _spec(0.)
+  {}
+
+  //! @brief Constructor for an interval <tt>B</tt>
+  SpSpecbnd( const T &B ):
+    _n(0), _I(B), _spec(0.)
+  {}
+
+  //! @brief Constructor for a variable with range <tt>B</tt> and index <a>i</a> of <a>n</a> independent variables
+  SpSpecbnd( const T &B, const unsigned int i, const unsigned int n ):
+    _n(0), _I(0.), _spec(0.)
+  {
+    set( B, i, n );
+  }
+
+  //! @brief Destructor
+  ~SpSpecbnd()
+  {}
+
+  //! @brief Set variable with range <tt>B</tt> and index <a>i</a> of <a>n</a> independent variables
+  SpSpecbnd<T>& set( const T &B, const unsigned int i, const unsigned int n )
+  {
+    if( i >= n ) throw Exceptions( Exceptions::INDEX );
+    _n = n;
+    _I = B;
+    _ndx.assign( 1, i );
+    _grad.assign( 1, T(1.) );
+    _spec = 0.;
+    return *this;
+  }
+
+  //! @brief Return number of independent variables
+  unsigned int dep() const
+  {
+    return _n;
+  }
+
+  //! @brief Return number of structurally nonzero gradient components
+  unsigned int nnz() const
+  {
+    return _ndx.size();
+  }
+
+  //! @brief Return function bounds
+  const T& I() const
+  {
+    return _I;
+  }
+
+  //! @brief Return bounds on gradient component <tt>i</tt>
+  T D( const unsigned int i ) const;
+
+  //! @brief Return function and gradient bounds in dense format
+  fadbad::F<T> FI() const;
+
+  //! @brief Return spectral bounds for Hessian matrix
+  const T& SI() const
+  {
+    return _spec;
+  }
+  /** @} */
+};
+
+////////////////////////////////////////////////////////////////////////
+
+template <class T> inline T
+SpSpecbnd<T>::D
+( const unsigned int i ) const
+{
+  // Binary search in sorted nonzero indices
+  typename std::vector<unsigned int>::const_iterator it
+    = std::lower_bound( _ndx.begin(), _ndx.end(), i );
+  if( it == _ndx.end() || *it != i ) return 0.;
+  return _grad[it-_ndx.begin()];
+}
+
+template <class T> inline fadbad::F<T>
+SpSpecbnd<T>::FI() const
+{
+  fadbad::F<T> FI( _I );
+  if( !_n ) return FI;
+  FI.diff( 0, _n );
+  FI[0] = 0.;
+  for( unsigned int k=0; k<_ndx.size(); k++ )
+    FI[_ndx[k]] = _grad[k];
+  return FI;
+}
+
+template <class T> inline unsigned int
+SpSpecbnd<T>::_dep
+( const SpSpecbnd<T>&x, const SpSpecbnd<T>&y )
+{
+  if( x._n && y._n && x._n != y._n )
+    throw typename SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::SIZE );
+  return x._n? x._n: y._n;
+}
+
+template <class T> inline void
+SpSpecbnd<T>::_lincomb
+( const SpSpecbnd<T>&x, const T*cx, const SpSpecbnd<T>&y, const T*cy,
+  const bool negy )
+{
+  // Merge sorted nonzeros of x and y - also valid if *this is x or y
+  std::vector<unsigned int> ndx; ndx.reserve( x._ndx.size() + y._ndx.size() );
+  std::vector<T> grad; grad.reserve( x._ndx.size() + y._ndx.size() );
+  unsigned int kx = 0, ky = 0;
+  while( kx < x._ndx.size() || ky < y._ndx.size() ){
+    if( ky == y._ndx.size() || ( kx < x._ndx.size() && x._ndx[kx] < y._ndx[ky] ) ){
+      ndx.push_back( x._ndx[kx] );
+      grad.push_back( cx? *cx * x._grad[kx]: x._grad[kx] );
+      kx++;
+      continue;
+    }
+    T gy = cy? *cy * y._grad[ky]: y._grad[ky];
+    if( negy ) gy = -gy;
+    if( kx == x._ndx.size() || y._ndx[ky] < x._ndx[kx] ){
+      ndx.push_back( y._ndx[ky] );
+      grad.push_back( gy );
+      ky++;
+      continue;
+    }
+    ndx.push_back( x._ndx[kx] );
+    grad.push_back( ( cx? *cx * x._grad[kx]: x._grad[kx] ) + gy );
+    kx++; ky++;
+  }
+  _ndx.swap( ndx );
+  _grad.swap( grad );
+}
+
+template <class T> inline void
+SpSpecbnd<T>::_scale
+( const SpSpecbnd<T>&y, const T&c )
+{
+  _ndx = y._ndx;
+  _grad.resize( y._grad.size(), T(0.) );
+  for( unsigned int k=0; k<y._grad.size(); k++ )
+    _grad[k] = y._grad[k] * c;
+}
+
+template <class T> inline T
+SpSpecbnd<T>::_LambdaS
+( const SpSpecbnd<T> &a, unsigned int n )
+{
+  if( !n ) return 0.;
+  if( n == 1 ) return a._grad.size()? Op<T>::sqr( a._grad[0] ): 0.;
+  double upbnd=0.;
+  for( unsigned int k=0; k<a._grad.size(); k++ )
+    upbnd += Op<T>::u( Op<T>::sqr( a._grad[k] ) );
+  return Op<T>::zeroone() * upbnd;
+}
+
+template <class T> inline T
+SpSpecbnd<T>::_LambdaT
+( const SpSpecbnd<T> &a, const SpSpecbnd<T> &b, unsigned int n )
+{
+  if( !n ) return 0.;
+  if( n == 1 ) return (a._grad.size() && b._grad.size())? 2.*a._grad[0]*b._grad[0]: 0.;
+  double upbnda=0., upbndb=0.;
+  for( unsigned int k=0; k<a._grad.size(); k++ )
+    upbnda += Op<T>::u( Op<T>::sqr( a._grad[k] ) );
+  for( unsigned int k=0; k<b._grad.size(); k++ )
+    upbndb += Op<T>::u( Op<T>::sqr( b._grad[k] ) );
+  T lamb = 2.*(Op<T>::zeroone()-0.5) * std::sqrt(upbnda*upbndb);
+  // Inner product over common nonzeros only
+  for( unsigned int ka=0, kb=0; ka<a._ndx.size() && kb<b._ndx.size(); ){
+    if( a._ndx[ka] < b._ndx[kb] ) ka++;
+    else if( b._ndx[kb] < a._ndx[ka] ) kb++;
+    else lamb += a._grad[ka++]*b._grad[kb++];
+  }
+  return lamb;
+}
+
+template <class T> inline std::ostream&
+operator<<
+( std::ostream &out, const SpSpecbnd<T> &y )
+{
+  out << "  " << y._spec << std::endl
+      << "  " << y._I << std::endl;
+  for( unsigned int k=0; k<y._ndx.size(); k++ )
+    out << "  " << y._ndx[k] << ": ( " << y._grad[k] << " )" << std::endl;
+  return out;
+}
+
+template <class T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator=
+( const double c )
+{
+  _n = 0;
+  _I = c;
+  _ndx.clear();
+  _grad.clear();
+  _spec = 0.;
+  return *this;
+}
+
+template <class T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator=
+( const T &c )
+{
+  _n = 0;
+  _I = c;
+  _ndx.clear();
+  _grad.clear();
+  _spec = 0.;
+  return *this;
+}
+
+template <class T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator+=
+( const double c )
+{
+  _I += c;
+  return *this;
+}
+
+template <class T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator+=
+( const SpSpecbnd<T> &y )
+{
+  _n = _dep( *this, y );
+  _I += y._I;
+  _lincomb( *this, 0, y, 0 );
+  _spec += y._spec;
+  return *this;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator+
+( const SpSpecbnd<T> &y )
+{
+  return y;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator+
+( const SpSpecbnd<T> &x, const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = SpSpecbnd<T>::_dep( x, y );
+  z._I = x._I + y._I;
+  z._lincomb( x, 0, y, 0 );
+  z._spec = x._spec + y._spec;
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator+
+( const SpSpecbnd<T> &y, const double c )
+{
+  SpSpecbnd<T> z( y );
+  z._I += c;
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator+
+( const double c, const SpSpecbnd<T> &y )
+{
+  return y + c;
+}
+
+template <class T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator-=
+( const double c )
+{
+  _I -= c;
+  return *this;
+}
+
+template <class T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator-=
+( const SpSpecbnd<T> &y )
+{
+  _n = _dep( *this, y );
+  _I -= y._I;
+  _lincomb( *this, 0, y, 0, true );
+  _spec -= y._spec;
+  return *this;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator-
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = -y._I;
+  z._ndx = y._ndx;
+  z._grad.resize( y._grad.size(), T(0.) );
+  for( unsigned int k=0; k<y._grad.size(); k++ ) z._grad[k] = -y._grad[k];
+  z._spec = -y._spec;
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator-
+( const SpSpecbnd<T> &x, const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = SpSpecbnd<T>::_dep( x, y );
+  z._I = x._I - y._I;
+  z._lincomb( x, 0, y, 0, true );
+  z._spec = x._spec - y._spec;
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator-
+( const SpSpecbnd<T> &y, const double c )
+{
+  return y + (-c);
+}
+
+template <class T> inline SpSpecbnd<T>
+operator-
+( const double c, const SpSpecbnd<T> &y )
+{
+  return (-y) + c;
+}
+
+template <typename T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator*=
+( const double c )
+{
+  *this = c * (*this);
+  return *this;
+}
+
+template <typename T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator*=
+( const SpSpecbnd<T> &x )
+{
+  *this = x * (*this);
+  return *this;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator*
+( const SpSpecbnd<T> &x, const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = SpSpecbnd<T>::_dep( x, y );
+  z._I = x._I * y._I;
+  z._lincomb( x, &y._I, y, &x._I );
+  z._spec = x._I * y._spec + x._spec * y._I
+          + SpSpecbnd<T>::_LambdaT( x, y, z._n );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator*
+( const double c, const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = c * y._I;
+  z._ndx = y._ndx;
+  z._grad.resize( y._grad.size(), T(0.) );
+  for( unsigned int k=0; k<y._grad.size(); k++ ) z._grad[k] = c * y._grad[k];
+  z._spec = c * y._spec;
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator*
+( const SpSpecbnd<T> &y, const double c )
+{
+  return c * y;
+}
+
+template <class T> inline SpSpecbnd<T>
+sqr
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::sqr( y._I );
+  z._scale( y, 2.*y._I );
+  z._spec = 2.*( y._I * y._spec + SpSpecbnd<T>::_LambdaS( y, z._n ) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+pow
+( const SpSpecbnd<T> &y, const int m )
+{
+  if( !m )      return 1.;
+  if( m == 1 )  return y;
+  if( m == 2 )  return sqr(y);
+  if( m == -1 ) return inv( y );
+  if( m < -1 )  return inv( pow( y, -m ) );
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::pow( y._I, m );
+  z._scale( y, (double)m * Op<T>::pow( y._I, m-1 ) );
+  z._spec = (double)m * Op<T>::pow( y._I, m-2 )
+          * ( y._I * y._spec + (m-1) * SpSpecbnd<T>::_LambdaS( y, z._n ) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+inv
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = 1./y._I;
+  z._scale( y, -(z._I/y._I) );
+  z._spec = Op<T>::sqr( z._I )
+         * ( 2. * z._I * SpSpecbnd<T>::_LambdaS( y, z._n ) - y._spec );
+  return z;
+}
+
+template <typename T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator/=
+( const double c )
+{
+  *this = *this / c;
+  return *this;
+}
+
+template <typename T> inline SpSpecbnd<T>&
+SpSpecbnd<T>::operator/=
+( const SpSpecbnd<T> &x )
+{
+  *this = *this / x;
+  return *this;
+}
+
+template <class T> inline SpSpecbnd<T>
+operator/
+( const SpSpecbnd<T> &x, const SpSpecbnd<T> &y )
+{
+  return x * inv(y);
+}
+
+template <class T> inline SpSpecbnd<T>
+operator/
+( const SpSpecbnd<T> &y, const double c )
+{
+  return y * (1./c);
+}
+
+template <class T> inline SpSpecbnd<T>
+operator/
+( const double c, const SpSpecbnd<T> &y )
+{
+  return c * inv(y);
+}
+
+template <class T> inline SpSpecbnd<T>
+sqrt
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::sqrt( y._I );
+  z._scale( y, 1./(z._I*2.) );
+  z._spec = 1./(2.*Op<T>::sqr( z._I ))
+         * ( y._spec - SpSpecbnd<T>::_LambdaS( y, z._n ) / (2. * y._I) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+exp
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::exp( y._I );
+  z._scale( y, z._I );
+  z._spec = z._I * ( y._spec + SpSpecbnd<T>::_LambdaS( y, z._n ) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+log
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::log( y._I );
+  z._scale( y, 1./y._I );
+  z._spec = 1./y._I * ( y._spec - SpSpecbnd<T>::_LambdaS( y, z._n ) / y._I );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+xlog
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  const T logy = Op<T>::log( y._I );
+  z._I = y._I * logy;
+  z._scale( y, logy + 1. );
+  z._spec = (logy+1.)*y._spec
+    + SpSpecbnd<T>::_LambdaS( y, z._n ) / y._I;
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+pow
+( const SpSpecbnd<T> &x, const SpSpecbnd<T> &y )
+{
+  return exp( y * log( x ) );
+}
+
+template <class T> inline SpSpecbnd<T>
+pow
+( const double c, const SpSpecbnd<T> &y )
+{
+  return exp( y * std::log( c ) );
+}
+
+template <class T> inline SpSpecbnd<T>
+pow
+( const SpSpecbnd<T> &x, const double c )
+{
+  return exp( c * log( x ) );
+}
+
+template <class T> inline SpSpecbnd<T>
+monomial
+( const unsigned int n, const SpSpecbnd<T>*x, const int*k )
+{
+  if( n == 0 ){
+    return 1.;
+  }
+  if( n == 1 ){
+    return pow( x[0], k[0] );
+  }
+  return pow( x[0], k[0] ) * monomial( n-1, x+1, k+1 );
+}
+
+template <class T> inline SpSpecbnd<T>
+fabs
+( const SpSpecbnd<T> &y )
+{
+  throw typename SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::UNDEF );
+}
+
+template <class T> inline SpSpecbnd<T>
+cos
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::cos( y._I );
+  z._scale( y, -Op<T>::sin( y._I ) );
+  z._spec = - z._I * ( y._spec + SpSpecbnd<T>::_LambdaS( y, z._n ) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+sin
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::sin( y._I );
+  z._scale( y, Op<T>::cos( y._I ) );
+  z._spec = z._I * ( y._spec - SpSpecbnd<T>::_LambdaS( y, z._n ) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+tan
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::tan( y._I );
+  z._scale( y, 1.+Op<T>::sqr( z._I ) );
+  z._spec = ( Op<T>::sqr(z._I) + 1. ) * ( y._spec
+    + 2. * y._I * SpSpecbnd<T>::_LambdaS( y, z._n ) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+acos
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::acos( y._I );
+  z._scale( y, -Op<T>::inv( Op<T>::sqrt( 1.-Op<T>::sqr( y._I ) ) ) );
+  z._spec = - 1./Op<T>::sqrt(1.-Op<T>::sqr(y._I)) * ( y._spec
+    + y._I/(1.-Op<T>::sqr(y._I))
+     *SpSpecbnd<T>::_LambdaS( y, z._n ) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+asin
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::asin( y._I );
+  z._scale( y, Op<T>::inv( Op<T>::sqrt( 1.-Op<T>::sqr( y._I ) ) ) );
+  z._spec = 1./Op<T>::sqrt(1.-Op<T>::sqr(y._I)) * ( y._spec
+    + y._I/(1.-Op<T>::sqr(y._I))
+     *SpSpecbnd<T>::_LambdaS( y, z._n ) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+atan
+( const SpSpecbnd<T> &y )
+{
+  SpSpecbnd<T> z;
+  z._n = y._n;
+  z._I = Op<T>::atan( y._I );
+  z._scale( y, Op<T>::inv( 1.+Op<T>::sqr( y._I ) ) );
+  z._spec = 1./(Op<T>::sqr(y._I)+1.) * ( y._spec
+    - 2.*y._I/(Op<T>::sqr(y._I)+1.)
+     *SpSpecbnd<T>::_LambdaS( y, z._n ) );
+  return z;
+}
+
+template <class T> inline SpSpecbnd<T>
+erf
+( const SpSpecbnd<T> &y )
+{
+  throw typename mc::SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::UNDEF );
+}
+
+template <class T> inline SpSpecbnd<T>
+erfc
+( const SpSpecbnd<T> &y )
+{
+  throw typename mc::SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::UNDEF );
+}
+
+} // namespace mc
+
+
+#include "mcop.hpp"
+
+namespace mc
+{
+
+//! @brief C++ structure for specialization of the mc::Op templated structure to allow usage of the type mc::SpSpecbnd inside other classes in MC++ such as mc::TModel and mc::TVar
+template <typename T> struct Op< mc::SpSpecbnd<T> >
+{
+  typedef mc::SpSpecbnd<T> SB;
+  static SB point( const double c ) { return SB(c); }
+  static SB zeroone() { return SB( mc::Op<T>::zeroone() ); }
+  static void I(SB& x, const SB&y) { x = y; }
+  static double l(const SB& x) { return Op<T>::l(x.I()); }
+  static double u(const SB& x) { return Op<T>::u(x.I()); }
+  static double abs (const SB& x) { return mc::Op<T>::abs(x.I());  }
+  static double mid (const SB& x) { return mc::Op<T>::mid(x.I());  }
+  static double diam(const SB& x) { return mc::Op<T>::diam(x.I()); }
+  static SB inv (const SB& x) { return mc::inv(x);  }
+  static SB sqr (const SB& x) { return mc::sqr(x);  }
+  static SB sqrt(const SB& x) { return mc::sqrt(x); }
+  static SB log (const SB& x) { return mc::log(x);  }
+  static SB xlog(const SB& x) { return mc::xlog(x); }
+  static SB fabs(const SB& x) { return mc::fabs(x); }
+  static SB exp (const SB& x) { return mc::exp(x);  }
+  static SB sin (const SB& x) { return mc::sin(x);  }
+  static SB cos (const SB& x) { return mc::cos(x);  }
+  static SB tan (const SB& x) { return mc::tan(x);  }
+  static SB asin(const SB& x) { return mc::asin(x); }
+  static SB acos(const SB& x) { return mc::acos(x); }
+  static SB atan(const SB& x) { return mc::atan(x); }
+  static SB erf (const SB& x) { throw typename mc::SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::UNDEF ); }
+  static SB erfc(const SB& x) { throw typename mc::SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::UNDEF ); }
+  static SB hull(const SB& x, const SB& y) { throw typename mc::SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::UNDEF ); }
+  static SB min (const SB& x, const SB& y) { throw typename mc::SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::UNDEF ); }
+  static SB max (const SB& x, const SB& y) { throw typename mc::SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::UNDEF ); }
+  static SB arh (const SB& x, const double k) { return mc::exp(-k/x); }
+  template <typename X, typename Y> static SB pow(const X& x, const Y& y) { return mc::pow(x,y); }
+  static SB monomial (const unsigned int n, const SB* x, const int* k) { return mc::monomial(n,x,k); }
+  static bool inter(SB& xIy, const SB& x, const SB& y) { throw typename mc::SpSpecbnd<T>::Exceptions( SpSpecbnd<T>::Exceptions::UNDEF ); }
+  static bool eq(const SB& x, const SB& y) { return x.SI()==y.SI() && x.I()==y.I(); }
+  static bool ne(const SB& x, const SB& y) { return x.SI()!=y.SI() || x.I()!=y.I(); }
+  static bool lt(const SB& x, const SB& y) { return x.SI()<y.SI()  && x.I()<y.I();  }
+  static bool le(const SB& x, const SB& y) { return x.SI()<=y.SI() && x.I()<=y.I(); }
+  static bool gt(const SB& x, const SB& y) { return x.SI()>y.SI()  && x.I()>y.I();  }
+  static bool ge(const SB& x, const SB& y) { return x.SI()>=y.SI() && x.I()>=y.I(); }
+};
+
+} // namespace mc
+
+#endif
@@ -293,6 +293,22 @@ with \f$\mathcal{B}(\cdot)\f$ the Taylor model range bounder, and \f$\eta\f$ a r
 with \f$\mathcal{B}(\cdot)\f$ and \f$\eta\f$ as previously.
 
 
+\section sec_TAYLOR_order How do I mix Taylor models of different orders?
+
+All the Taylor variables in a given mc::TModel environment share the same maximal order, yet the products and compositions are only carried out up to the actual degree of the polynomial parts, as returned by mc::TVar::degree. Hence, the subterms of an expression that do not need a high order can be computed more cheaply by lowering the order of their Taylor models explicitly:
+\code
+      TV.truncate( 2 );
+\endcode
+which adds the bounds of all terms of order greater than 2 in <tt>TV</tt> to its remainder term. Alternatively, this order reduction can be performed automatically after each operation by setting the option mc::TModel::Options::ADAPT_ORDER_TOL to a positive value, in which case the highest-order terms are truncated as long as their contribution is negligible compared with the remainder term.
+
+A Taylor variable can also be embedded into, or truncated from, a Taylor model environment of a different order by using the copy constructor of mc::TVar with a pointer to the new environment as first argument, provided both environments have the same number of variables and variable ranges. For instance, the 4th-order Taylor model <tt>F</tt> computed above is truncated to 2nd order as follows:
+\code
+      TM* mod2 = new TM( 2, 2 );
+      TV X2( mod2, 0, I(1.,2.) ), Y2( mod2, 1, I(0.,1.) );
+      TV F2( mod2, F );
+\endcode
+
+
 \section sec_TAYLOR_opt How are the options set for the computation of a Taylor model?
 
 The class mc::TModel has a public member called mc::TModel::options that can be used to set/modify the options; e.g.,
@@ -332,6 +348,10 @@ The available options are the following:
          <TD>Termination tolerance for determination of the exact remainder bounds in a Berstein model of convex/concave univariates exp, log, inv and sqrt.
      <TR><TH><tt>BERNSTEIN_MAXIT</tt> <TD><tt>int</tt> <TD>100
          <TD>Maximum number of iterations for determination of the exact remainder bounds in a Berstein model of convex/concave univariates exp, log, inv and sqrt.
+     <TR><TH><tt>SWEEP_TOL</tt> <TD><tt>double</tt> <TD>0.
+         <TD>Threshold for sweeping the monomial terms of a Taylor model into its remainder. After each operation, the coefficients whose contribution \f$|a_i|\cdot\|\mathcal B(x^{(i)})\|\f$ is below this threshold are set to zero and their bound is added to the remainder term. A value of 0. disables coefficient sweeping.
+     <TR><TH><tt>ADAPT_ORDER_TOL</tt> <TD><tt>double</tt> <TD>0.
+         <TD>Relative threshold for adaptive order reduction of a Taylor model. After each operation, the terms of highest orders are truncated into the remainder as long as the cumulated diameter of their bounds does not exceed this fraction of the remainder diameter. Subsequent operations on the resulting lower-order Taylor model are cheaper (see \ref sec_TAYLOR_order). A value of 0. disables adaptive order reduction.
      <TR><TH><tt>DISPLAY_DIGITS</tt> <TD><tt>unsigned int</tt> <TD>5
          <TD>Number of digits in output stream for Taylor model coefficients.
 </TABLE>
@@ -529,7 +549,7 @@ public:
       INTER_WITH_BNDT(false), SCALE_VARIABLES(false), CENTER_REMAINDER(false),
       REF_MIDPOINT(true), REF_POLY(0.), BERNSTEIN_USE(false),
       BERNSTEIN_OPT(true), BERNSTEIN_MAXIT(100), BERNSTEIN_TOL(1e-10),
-      DISPLAY_DIGITS(5)
+      SWEEP_TOL(0.), ADAPT_ORDER_TOL(0.), DISPLAY_DIGITS(5)
       {}
     //! @brief Copy constructor of mc::TModel::Options
     template <typename U> Options
@@ -546,6 +566,8 @@ public:
 	BERNSTEIN_OPT(options.BERNSTEIN_OPT),
         BERNSTEIN_MAXIT(options.BERNSTEIN_MAXIT),
 	BERNSTEIN_TOL(options.BERNSTEIN_TOL),
+	SWEEP_TOL(options.SWEEP_TOL),
+	ADAPT_ORDER_TOL(options.ADAPT_ORDER_TOL),
 	DISPLAY_DIGITS(options.DISPLAY_DIGITS)
       {}
     //! @brief Assignment of mc::TModel::Options
@@ -563,6 +585,8 @@ public:
 	BERNSTEIN_OPT    = options.BERNSTEIN_OPT,
         BERNSTEIN_MAXIT  = options.BERNSTEIN_MAXIT,
 	BERNSTEIN_TOL    = options.BERNSTEIN_TOL,
+	SWEEP_TOL        = options.SWEEP_TOL,
+	ADAPT_ORDER_TOL  = options.ADAPT_ORDER_TOL,
 	DISPLAY_DIGITS   = options.DISPLAY_DIGITS;
         return *this;
       }
@@ -602,6 +626,10 @@ public:
     unsigned int BERNSTEIN_MAXIT;
     //! @brief Termination tolerance for determination of the exact remainder bounds in a Berstein model of convex/concave univariates exp, log, inv and sqrt.
     double BERNSTEIN_TOL;
+    //! @brief Threshold for sweeping monomial terms into the remainder term. Coefficients whose contribution \f$|a_i|\cdot\|\mathcal B(x^{(i)})\|\f$ falls below this threshold are set to zero and their bound is added to the remainder. No sweeping if set to 0.
+    double SWEEP_TOL;
+    //! @brief Relative threshold for adaptive order reduction. The highest-order terms are truncated into the remainder term as long as the cumulated diameter of their bounds remains below this fraction of the remainder diameter. No order reduction if set to 0.
+    double ADAPT_ORDER_TOL;
     //! @brief Number of digits in output stream for Taylor model coefficients.
     unsigned int DISPLAY_DIGITS;
   } options;
@@ -643,6 +671,10 @@ private:
 
   //! @brief Internal Taylor variable to speed-up computations and reduce dynamic allocation
   TVar<T>* _TV;
+  //! @brief Eigen-solver with cached LAPACK workspace for the eigenvalue-based bounder
+  EigenSolver _eigsolver;
+  //! @brief Eigenvectors and eigenvalues of the quadratic part, for the eigenvalue-based bounder
+  std::vector<double> _eigvec, _eigval;
 
   //! @brief Set Taylor model order <tt>nord</tt> and number of variables <tt>nvar</tt>
   void _size
@@ -1038,6 +1070,13 @@ public:
   TModel<T>* env() const
     { return _TM; }
 
+  //! @brief Get (total) degree of multivariate polynomial part, i.e. highest order with a nonzero coefficient
+  unsigned int degree() const;
+
+  //! @brief Truncate multivariate polynomial part to (total) order <tt>maxord</tt>, with the bounds of all higher-order terms added to the remainder term
+  TVar<T>& truncate
+    ( const unsigned int maxord );
+
   //! @brief Compute bound on all terms of (total) order <tt>iord</tt> in Taylor variable
   T bound
     ( const unsigned int iord ) const
@@ -1067,6 +1106,10 @@ public:
   double polynomial
     ( const double*x ) const;
 
+  //! @brief Evaluate polynomial part at <tt>npts</tt> points in <tt>x</tt> and store the values in <tt>Pval</tt>. The points are stored variable-wise in <tt>x</tt>, so that <tt>x[ivar*npts+ipt]</tt> is the value of variable <tt>ivar</tt> at point <tt>ipt</tt>.
+  void polynomial
+    ( const unsigned int npts, const double*x, double*Pval ) const;
+
   //! @brief Shortcut to mc::TVar::bound
   T B
     ( const unsigned int iord ) const
@@ -1093,6 +1136,11 @@ public:
     ( const double*x ) const
     { return polynomial( x ); }
 
+  //! @brief Shortcut to mc::TVar::polynomial
+  void P
+    ( const unsigned int npts, const double*x, double*Pval ) const
+    { polynomial( npts, x, Pval ); }
+
   //! @brief Get pointer to array of size <tt>nvar</tt> with references for all variables
   double* reference() const;
 
@@ -1164,8 +1212,10 @@ private:
   //! @brief Bound evaluated in T arithmetic (see option mc::TModel::Options::SCALE_VARIABLES)
   T _bndT;
 
-  //! @brief Update bounds for all terms of degrees <tt>iord=0,...,_nord</tt> in <tt>_bndord</tt>
+  //! @brief Update bounds for all terms of degrees <tt>iord=0,...,_nord</tt> in <tt>_bndord</tt>, after sweeping negligible terms into the remainder (see option mc::TModel::Options::SWEEP_TOL)
   void _update_bndord();
+  //! @brief Truncate terms of highest orders into remainder (see option mc::TModel::Options::ADAPT_ORDER_TOL)
+  void _adapt_order();
   //! @brief Center remainder error term <tt>_bndrem</tt>
   void _center_TM();
 
@@ -1606,7 +1656,7 @@ TModel<T>::_goldsect_iter
 // a and c are the current bounds; the minimum is between them.
 // b is a center point
 {
-  static unsigned int iter;
+  static MC__THREAD_LOCAL unsigned int iter;
   iter = ( init? 1: iter+1 );
   const double phi = 2.-(1.+std::sqrt(5.))/2.;
   bool b_then_x = ( c-b > b-a );
@@ -1920,12 +1970,62 @@ TVar<T>::_update_bndord()
 {
   if( !_TM ) return;
   _TM->_set_bndmon();
+  const double sweeptol = _TM->options.SWEEP_TOL;
   _bndord[0] = _coefmon[0];
   for( unsigned int i=1; i<=_nord(); i++ ){
     _bndord[i] = 0.; 
-    for( unsigned int j=_posord(i); j<_posord(i+1); j++ )
+    for( unsigned int j=_posord(i); j<_posord(i+1); j++ ){
+      if( _coefmon[j] == 0. ) continue;
+      // Sweep negligible term into remainder
+      if( sweeptol > 0.
+       && std::fabs(_coefmon[j]) * Op<T>::abs(_bndmon(j)) < sweeptol ){
+        *_bndrem += _coefmon[j] * _bndmon(j);
+        _coefmon[j] = 0.;
+        continue;
+      }
       _bndord[i] += _coefmon[j] * _bndmon(j);
+    }
   }
+  if( _TM->options.ADAPT_ORDER_TOL > 0. ) _adapt_order();
+}
+
+template <typename T> inline void
+TVar<T>::_adapt_order()
+{
+  const double maxdiam = _TM->options.ADAPT_ORDER_TOL * Op<T>::diam(*_bndrem);
+  if( !(maxdiam > 0.) ) return;
+  double sumdiam = 0.;
+  unsigned int iord = _nord();
+  for( ; iord>0; iord-- ){
+    sumdiam += Op<T>::diam(_bndord[iord]);
+    if( sumdiam > maxdiam ) break;
+  }
+  if( iord < _nord() ) truncate( iord );
+}
+
+template <typename T> inline unsigned int
+TVar<T>::degree() const
+{
+  if( !_TM ) return 0;
+  for( unsigned int iord=_nord(); iord>0; iord-- )
+    for( unsigned int j=_posord(iord); j<_posord(iord+1); j++ )
+      if( _coefmon[j] != 0. ) return iord;
+  return 0;
+}
+
+template <typename T> inline TVar<T>&
+TVar<T>::truncate
+( const unsigned int maxord )
+{
+  if( !_TM ) return *this;
+  for( unsigned int iord=maxord+1; iord<=_nord(); iord++ ){
+    *_bndrem += _bndord[iord];
+    _bndord[iord] = 0.;
+    for( unsigned int j=_posord(iord); j<_posord(iord+1); j++ )
+      _coefmon[j] = 0.;
+  }
+  if( _TM->options.CENTER_REMAINDER ) _center_TM();
+  return *this;
 }
 
 template <typename T> inline void
@@ -1947,7 +2047,11 @@ TVar<T>::_bound_eigen
   if( _nord() == 1 ) bndmod += _bndord[1];
 
   else if( _nord() > 1 ){
-    double*U = new double[_nvar()*_nvar()];
+    // Workspaces owned by the Taylor model environment, sized on first use
+    std::vector<double>&Uvec = _TM->_eigvec, &Dvec = _TM->_eigval;
+    if( Uvec.size() < _nvar()*_nvar() ) Uvec.resize( _nvar()*_nvar() );
+    if( Dvec.size() < _nvar() ) Dvec.resize( _nvar() );
+    double*U = &Uvec[0], *D = &Dvec[0];
     for( unsigned int i=0; i<_nvar(); i++ ){
       for( unsigned int j=0; j<i; j++ ){
         U[_nvar()*(_nvar()-i-1)+_nvar()-j-1] = 0.;
@@ -1955,11 +2059,8 @@ TVar<T>::_bound_eigen
       }
       U[(_nvar()+1)*(_nvar()-i-1)] = _coefmon[_prodmon(i+1,i+2)];
     }
-    double*D = mc::dsyev_wrapper( _nvar(), U, true );
-    if( !D ){
-      delete[] U;
+    if( !_TM->_eigsolver.dsyev( _nvar(), U, D, true ) )
       throw typename TModel<T>::Exceptions( TModel<T>::Exceptions::EIGEN );
-    }
 
 #ifdef MC__TVAR_HYBRID_EIGEN
     T bndtype1(0.);
@@ -1992,8 +2093,6 @@ TVar<T>::_bound_eigen
         std::cout << "BNDTYPE2: " << bndtype2 << std::endl;
 #endif
     }
-    delete[] U;
-    delete[] D;
 
 #ifdef MC__TVAR_HYBRID_EIGEN
     if( !Op<T>::inter( bndtype1, bndtype1, bndtype2 ) ){
@@ -2166,6 +2265,63 @@ TVar<T>::polynomial
   return Pval;
 }
 
+template <typename T> inline void
+TVar<T>::polynomial
+( const unsigned int npts, const double*x, double*Pval ) const
+{
+  if( !_TM || !_nord() ){
+    for( unsigned int ipt=0; ipt<npts; ipt++ ) Pval[ipt] = _coefmon[0];
+    return;
+  }
+
+  // Locate parent monomial term and variable for each monomial term,
+  // so that x^(imon) = x^(parmon[2*imon]) * x_(parmon[2*imon+1])
+  unsigned int*parmon = new unsigned int[2*_nmon()];
+  unsigned int*iexp = new unsigned int[_nvar()];
+  for( unsigned int imon=1; imon<_nmon(); imon++ ){
+    unsigned int ivar = 0;
+    for( unsigned int k=0; k<_nvar(); k++ ){
+      iexp[k] = _expmon(imon)[k];
+      if( iexp[k] && !iexp[ivar] ) ivar = k;
+    }
+    iexp[ivar]--;
+    parmon[2*imon]   = _TM->_loc_expmon( iexp );
+    parmon[2*imon+1] = ivar;
+  }
+  delete[] iexp;
+
+  // Evaluate monomial terms by increasing order, one block of points at a time
+  static const unsigned int NBLK = 64;
+  double*dx = new double[_nvar()*NBLK];
+  double*valmon = new double[_nmon()*NBLK];
+  for( unsigned int ipt=0; ipt<NBLK; ipt++ ) valmon[ipt] = 1.;
+  for( unsigned int ipt0=0; ipt0<npts; ipt0+=NBLK ){
+    const unsigned int nblk = std::min( NBLK, npts-ipt0 );
+    double*Pblk = Pval+ipt0;
+    for( unsigned int k=0; k<_nvar(); k++ ){
+      const double*xk = x+k*npts+ipt0;
+      double*dxk = dx+k*NBLK;
+      const double sk = _scaling(k), rk = _refpoint(k);
+      for( unsigned int ipt=0; ipt<nblk; ipt++ ) dxk[ipt] = xk[ipt]/sk-rk;
+    }
+    for( unsigned int ipt=0; ipt<nblk; ipt++ ) Pblk[ipt] = _coefmon[0];
+    for( unsigned int imon=1; imon<_nmon(); imon++ ){
+      const double*valpar = valmon+parmon[2*imon]*NBLK;
+      const double*dxk = dx+parmon[2*imon+1]*NBLK;
+      double*valimon = valmon+imon*NBLK;
+      for( unsigned int ipt=0; ipt<nblk; ipt++ )
+        valimon[ipt] = valpar[ipt] * dxk[ipt];
+      const double a = _coefmon[imon];
+      if( a == 0. ) continue;
+      for( unsigned int ipt=0; ipt<nblk; ipt++ )
+        Pblk[ipt] += a * valimon[ipt];
+    }
+  }
+  delete[] dx;
+  delete[] valmon;
+  delete[] parmon;
+}
+
 template <typename T> inline double*
 TVar<T>::reference() const
 {
@@ -2496,10 +2652,15 @@ operator *
   for( unsigned int i=0; i<TV3._nmon(); i++ ) TV3._coefmon[i] = 0.;
   //TVar<T> TV3( TV1._TM, 0. );
 
-  // Populate _coefmon for product term
-  for( unsigned int i=0; i<TV3._posord(TV3._nord()/2+1); i++){
+  // Populate _coefmon for product term - skip rows with zero coefficients
+  // and limit columns to the actual degree of the factors
+  const unsigned int deg = std::max( TV1.degree(), TV2.degree() );
+  const unsigned int imax = TV3._posord( std::min( TV3._nord()/2, deg )+1 );
+  const unsigned int jmax = TV3._posord( deg+1 );
+  for( unsigned int i=0; i<imax; i++){
+    if( TV1._coefmon[i] == 0. && TV2._coefmon[i] == 0. ) continue;
     TV3._coefmon[TV3._prodmon(i,i+1)] += TV1._coefmon[i] * TV2._coefmon[i];
-    for( unsigned int j=i+1; j<TV3._prodmon(i,0); j++ )
+    for( unsigned int j=i+1; j<std::min( TV3._prodmon(i,0), jmax ); j++ )
       TV3._coefmon[TV3._prodmon(i,j+1)] += TV1._coefmon[i] * TV2._coefmon[j]
                                          + TV1._coefmon[j] * TV2._coefmon[i];
   }
@@ -2538,9 +2699,13 @@ sqr
 
   // Populate _coefmon for product term
   TVar<T> TV2( TV._TM, 0. );
-  for( unsigned int i=0; i<TV2._posord(TV2._nord()/2+1); i++){
+  const unsigned int deg = TV.degree();
+  const unsigned int imax = TV2._posord( std::min( TV2._nord()/2, deg )+1 );
+  const unsigned int jmax = TV2._posord( deg+1 );
+  for( unsigned int i=0; i<imax; i++){
+    if( TV._coefmon[i] == 0. ) continue;
     TV2._coefmon[TV2._prodmon(i,i+1)] += TV._coefmon[i] * TV._coefmon[i];
-    for( unsigned int j=i+1; j<TV2._prodmon(i,0); j++ )
+    for( unsigned int j=i+1; j<std::min( TV2._prodmon(i,0), jmax ); j++ )
       TV2._coefmon[TV2._prodmon(i,j+1)] += TV._coefmon[i] * TV._coefmon[j] * 2.;
   }
 
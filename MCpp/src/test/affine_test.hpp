@@ -0,0 +1,160 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__AFFINE_TEST_HPP
+#define MC__AFFINE_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "affine.hpp"
+#include "mccormick.hpp"
+#include "tmodel.hpp"
+#include "mcfadbad.hpp"
+
+struct AFfct{ template <typename U> U operator()( const U&x, const U&y ) const
+  { return x*y*exp(x) - 2.*sqr(y)/(1.+sqr(x)) + sqrt(x+2.)*log(3.-y) - pow(x-y,3)
+         + sin(x*y)/(y-2.) + atan(y)*x; } };
+
+namespace mc
+{
+//! @brief C++ class for test of mc::Affine class using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! AffineTest is a C++ class for testing the affine arithmetic class
+//! mc::Affine, as well as its use as template parameter of mc::McCormick,
+//! mc::TModel and mc::Specbnd, using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class AffineTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( AffineTest );
+CPPUNIT_TEST( testDependency );
+CPPUNIT_TEST( testExpression );
+CPPUNIT_TEST( testCondensation );
+CPPUNIT_TEST( testMcCormick );
+CPPUNIT_TEST( testTModel );
+CPPUNIT_TEST( testSpecbnd );
+CPPUNIT_TEST_EXCEPTION( testInverse, mc::Interval::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef Affine AF;
+
+  //! @brief Number of grid points in each direction
+  static const unsigned int NS = 21;
+
+  const Interval X0, Y0;
+
+  //! @brief Whether the values of AFfct on a grid of the box X0xY0 are within [<tt>l</tt>,<tt>u</tt>]
+  bool Enclosed( const double l, const double u ) const
+  {
+    const double tol = 1e2*machprec()*(1.+std::max(std::fabs(l),std::fabs(u)));
+    for( unsigned int i=0; i<NS; i++ )
+      for( unsigned int j=0; j<NS; j++ ){
+        const Interval f = AFfct()( Interval( X0.l()+diam(X0)*i/(NS-1.) ),
+                                    Interval( Y0.l()+diam(Y0)*j/(NS-1.) ) );
+        if( f.l() < l-tol || f.u() > u+tol ) return false;
+      }
+    return true;
+  }
+
+public:
+
+  AffineTest():
+    X0( 0.2, 0.7 ), Y0( -0.3, 0.1 )
+    {}
+
+  void setUp(){
+    AF::options = AF::Options();
+  }
+
+  void tearDown(){
+    AF::options = AF::Options();
+  }
+
+  void testDependency(){
+    // Exact bounds for linear expressions, and tighter bounds than intervals for the others
+    const AF X( 0., 1. ), Y( 0., 1. );
+    const AF D = 2.*X - (X+Y) + Y/2. + 0.5*Y - X;
+    CPPUNIT_ASSERT( D.l() == 0. && D.u() == 0. && D.nsym() == 0 );
+    const AF F = X*(1.-Y) + Y*(1.-X);
+    const Interval XI( 0., 1. ), YI( 0., 1. ), FI = XI*(1.-YI) + YI*(1.-XI);
+    CPPUNIT_ASSERT( F.l() <= 0. && F.u() >= 1. );
+    CPPUNIT_ASSERT( diam(F) < diam(FI) );
+    const AF G = X*(1.-X);
+    CPPUNIT_ASSERT( G.l() <= 0. && G.u() >= 0.25 && G.u() <= 0.5 );
+    const AF H = fabs( X-0.5 ) + min( X, Y ) - max( X, 1.-X );
+    CPPUNIT_ASSERT( H.l() <= -0.5 && H.u() >= 0.5 && diam(H) <= 2. );
+  }
+
+  void testExpression(){
+    const AF F = AFfct()( AF( X0 ), AF( Y0 ) );
+    const Interval FI = AFfct()( X0, Y0 );
+    CPPUNIT_ASSERT( Enclosed( F.l(), F.u() ) );
+    CPPUNIT_ASSERT( F.I() <= FI && diam(F) < diam(FI) );
+  }
+
+  void testCondensation(){
+    // At most MAXSYM noise symbols, with valid bounds
+    AF::options.MAXSYM = 4;
+    const AF F = AFfct()( AF( X0 ), AF( Y0 ) );
+    CPPUNIT_ASSERT( F.nsym() <= 4 );
+    CPPUNIT_ASSERT( Enclosed( F.l(), F.u() ) );
+    AF S = 0.;
+    for( unsigned int i=0; i<10; i++ ) S += AF( 0., 1.+i );
+    CPPUNIT_ASSERT( S.nsym() == 4 && S.l() == 0. && S.u() == 55. );
+  }
+
+  void testMcCormick(){
+    // Relaxations at a reference point, and interval bounds within those of McCormick<Interval>
+    typedef McCormick<AF> MCAF;
+    typedef McCormick<Interval> MCI;
+    MCAF::options.MVCOMP_USE = MCI::options.MVCOMP_USE = false;
+    const double x = 0.4, y = -0.1;
+    const MCAF F = AFfct()( MCAF( AF( X0 ), x ), MCAF( AF( Y0 ), y ) );
+    const MCI FI = AFfct()( MCI( X0, x ), MCI( Y0, y ) );
+    const Interval f = AFfct()( Interval( x ), Interval( y ) );
+    CPPUNIT_ASSERT( F.cv() <= f.l() && F.cc() >= f.u() );
+    CPPUNIT_ASSERT( Enclosed( F.I().l(), F.I().u() ) );
+    CPPUNIT_ASSERT( diam(F.I()) < diam(FI.I()) );
+  }
+
+  void testTModel(){
+    // Remainder bounds propagated in affine arithmetic
+    TModel<AF> TM( 2, 3 );
+    const TVar<AF> F = AFfct()( TVar<AF>( &TM, 0, AF( X0 ) ), TVar<AF>( &TM, 1, AF( Y0 ) ) );
+    const AF FB = F.B();
+    CPPUNIT_ASSERT( Enclosed( FB.l(), FB.u() ) );
+  }
+
+  void testSpecbnd(){
+    // Spectral bounds of the Hessian matrix with affine bounds on the derivatives
+    typedef Specbnd<AF> SBAF;
+    typedef Specbnd<Interval> SBI;
+    SBAF X, Y;
+    X.set( AF( X0 ), 0, 2 ); Y.set( AF( Y0 ), 1, 2 );
+    const SBAF F = AFfct()( X, Y );
+    SBI XI, YI;
+    XI.set( X0, 0, 2 ); YI.set( Y0, 1, 2 );
+    const SBI FI = AFfct()( XI, YI );
+    CPPUNIT_ASSERT( Enclosed( F.I().l(), F.I().u() ) );
+    CPPUNIT_ASSERT( F.SI().l() >= FI.SI().l()-1e2*machprec() && F.SI().u() <= FI.SI().u()+1e2*machprec() );
+  }
+
+  void testInverse(){
+    // The following line should throw an instance of mc::Interval::Exceptions
+    inv( AF( -1., 1. ) );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::AffineTest );
+
+} // end namespace mc
+
+#endif
@@ -0,0 +1,151 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__ALPHABB_TEST_HPP
+#define MC__ALPHABB_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "mcfadbad.hpp"
+#include "alphabb.hpp"
+
+struct ABBfct1{ template <typename U> U operator()( const U*x ) const
+  { return x[0]*sin(x[1]); } };
+struct ABBfct2{ template <typename U> U operator()( const U*x ) const
+  { return exp( x[0] - 2*pow(x[1],2) + 3*pow(x[2],3) ); } };
+
+typedef mc::AlphaBB<mc::Interval,ABBfct1> ABB1;
+typedef mc::AlphaBB<mc::Interval,ABBfct2> ABB2;
+
+namespace mc
+{
+//! @brief C++ class for test of mc::AlphaBB class using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! AlphaBBTest is a C++ class for testing the alphaBB underestimator
+//! class mc::AlphaBB using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class AlphaBBTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( AlphaBBTest );
+CPPUNIT_TEST( testAlpha );
+CPPUNIT_TEST( testUnderestimator );
+CPPUNIT_TEST( testGradient );
+CPPUNIT_TEST( testBatch );
+CPPUNIT_TEST_EXCEPTION( testInit, ABB1::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  bool Eq( const double&D1, const double&D2,
+           const double atol=1e2*machprec(), const double rtol=1e2*machprec() ) const
+  {
+    return isequal( D1, D2, atol, rtol );
+  }
+
+public:
+
+  void setUp(){}
+
+  void tearDown(){}
+
+  void testAlpha(){
+    // Interval Hessian [[0,[-1,1]],[[-1,1],[-2,1]]] on [-1,2]x[0,3]
+    const Interval X[2] = { Interval(-1.,2.), Interval(0.,3.) };
+    ABB1 F( ABBfct1(), 2 );
+    F.options.ALPHA = ABB1::Options::SCALED_GERSHGORIN;
+    F.set( X );
+    CPPUNIT_ASSERT( Eq( F.alpha(0), 0.5 ) );
+    CPPUNIT_ASSERT( Eq( F.alpha(1), 1.5 ) );
+
+    Specbnd<Interval>::options.HESSBND = Specbnd<Interval>::Options::HERTZROHN;
+    F.options.ALPHA = ABB1::Options::HESSBND;
+    F.set( X );
+    Specbnd<Interval>::options.HESSBND = Specbnd<Interval>::Options::GERSHGORIN;
+    CPPUNIT_ASSERT( Eq( F.alpha(0), -0.5*F.lambda() ) );
+    CPPUNIT_ASSERT( Eq( F.alpha(0), F.alpha(1) ) );
+    CPPUNIT_ASSERT( F.alpha(0) > 0.5 && F.alpha(0) < 1.5 );
+
+    F.options.ALPHA = ABB1::Options::SPECBND;
+    F.set( X );
+    CPPUNIT_ASSERT( Eq( F.alpha(0), std::max( 0., -0.5*F.lambda() ) ) );
+  }
+
+  void testUnderestimator(){
+    // Underestimator below the function and midpoint convex on a grid
+    const Interval X[3] = { Interval(-0.3,0.2), Interval(-0.1,0.6), Interval(-0.4,0.5) };
+    ABB2 F( ABBfct2(), 3 );
+    const unsigned int NGRID = 6;
+    const double tol = 1e2*machprec();
+    for( unsigned int s=0; s<3; s++ ){
+      F.options.ALPHA = (ABB2::Options::ALPHA_STRATEGY)s;
+      F.set( X );
+      for( unsigned int i=0; i<=NGRID; i++ )
+        for( unsigned int j=0; j<=NGRID; j++ ){
+          double x[3], y[3], z[3];
+          for( unsigned int k=0; k<3; k++ ){
+            x[k] = X[k].l() + (i*(k+1)%(NGRID+1))*diam(X[k])/NGRID;
+            y[k] = X[k].l() + (j*(k+2)%(NGRID+1))*diam(X[k])/NGRID;
+            z[k] = 0.5*(x[k]+y[k]);
+          }
+          CPPUNIT_ASSERT( F.l(x) <= ABBfct2()(x)+tol );
+          CPPUNIT_ASSERT( F.l(z) <= 0.5*(F.l(x)+F.l(y))+tol );
+        }
+    }
+  }
+
+  void testGradient(){
+    const Interval X[3] = { Interval(-0.3,0.2), Interval(-0.1,0.6), Interval(-0.4,0.5) };
+    ABB2 F( ABBfct2(), 3 );
+    F.options.ALPHA = ABB2::Options::SCALED_GERSHGORIN;
+    F.set( X );
+    double x[3] = { 0.1, 0.2, -0.3 }, g[3];
+    const double Fx = F.l( x, g );
+    CPPUNIT_ASSERT( Eq( Fx, F.l( x ) ) );
+    const double h = 1e-6;
+    for( unsigned int i=0; i<3; i++ ){
+      double xp[3] = { x[0], x[1], x[2] }, xm[3] = { x[0], x[1], x[2] };
+      xp[i] += h; xm[i] -= h;
+      CPPUNIT_ASSERT( Eq( g[i], (F.l(xp)-F.l(xm))/(2.*h), 1e-6, 1e-6 ) );
+    }
+  }
+
+  void testBatch(){
+    const Interval X[2] = { Interval(-1.,2.), Interval(0.,3.) };
+    ABB1 F( ABBfct1(), 2 );
+    F.options.ALPHA = ABB1::Options::SCALED_GERSHGORIN;
+    F.set( X );
+    const unsigned int NPTS = 11;
+    double x[2*NPTS], L[NPTS], G[2*NPTS];
+    for( unsigned int k=0; k<NPTS; k++ ){
+      x[k]      = X[0].l() + k*diam(X[0])/(NPTS-1);
+      x[NPTS+k] = X[1].u() - k*diam(X[1])/(NPTS-1);
+    }
+    F.l( NPTS, x, L, G );
+    for( unsigned int k=0; k<NPTS; k++ ){
+      double xk[2] = { x[k], x[NPTS+k] }, gk[2];
+      CPPUNIT_ASSERT( Eq( L[k], F.l( xk, gk ) ) );
+      CPPUNIT_ASSERT( Eq( G[k], gk[0] ) );
+      CPPUNIT_ASSERT( Eq( G[NPTS+k], gk[1] ) );
+    }
+  }
+
+  void testInit(){
+    // The following line should throw an instance of ABB1::Exceptions
+    ABB1 F( ABBfct1(), 2 );
+    double x[2] = { 0., 0. };
+    F.l( x );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::AlphaBBTest );
+
+} // end namespace mc
+
+#endif
@@ -0,0 +1,155 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__BTAPE_TEST_HPP
+#define MC__BTAPE_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "mccormick.hpp"
+#include "tmodel.hpp"
+#include "mcfadbad.hpp"
+#include "btape.hpp"
+
+struct BTfct{ template <typename U> U operator()( const U*x ) const
+  { return x[0]*x[1]*exp(x[0]) + sin(x[0]-x[1]) - 2.*pow(x[1],3)/(1.+sqr(x[0]))
+         + sqrt(x[0]+2.)*log(3.-x[1]) + pow(x[0],x[1]+2.) - atan(x[1])/x[0]; } };
+
+typedef mc::BTape<mc::Interval> BTI;
+
+namespace mc
+{
+//! @brief C++ class for test of mc::BTape / mc::BVar classes using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! BTapeTest is a C++ class for testing the reverse-mode AD classes
+//! mc::BTape and mc::BVar against <tt>fadbad::B</tt> using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class BTapeTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( BTapeTest );
+CPPUNIT_TEST( testDouble );
+CPPUNIT_TEST( testInterval );
+CPPUNIT_TEST( testMcCormick );
+CPPUNIT_TEST( testTModel );
+CPPUNIT_TEST( testReset );
+CPPUNIT_TEST_EXCEPTION( testTape, BTI::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef McCormick<Interval> MC;
+  typedef TVar<Interval> TV;
+
+  bool Eq( const double&D1, const double&D2,
+           const double atol=1e2*machprec(), const double rtol=1e2*machprec() ) const
+  {
+    return isequal( D1, D2, atol, rtol );
+  }
+
+  bool Eq( const Interval&I1, const Interval&I2 ) const
+  {
+    return Eq( I1.l(), I2.l() ) && Eq( I1.u(), I2.u() );
+  }
+
+  bool Eq( const MC&MC1, const MC&MC2 ) const
+  {
+    return Eq( MC1.I(), MC2.I() ) && Eq( MC1.cv(), MC2.cv() ) && Eq( MC1.cc(), MC2.cc() )
+        && Eq( MC1.cvsub(0), MC2.cvsub(0) ) && Eq( MC1.ccsub(1), MC2.ccsub(1) );
+  }
+
+  bool Eq( const TV&TV1, const TV&TV2 ) const
+  {
+    return Eq( TV1.B(), TV2.B() ) && Eq( TV1.constant(), TV2.constant() );
+  }
+
+  //! @brief Compare the function value and gradient from mc::BTape and fadbad::B at <tt>X</tt>
+  template <typename U> bool Compare( const U*X ) const
+  {
+    BTape<U> tape;
+    BVar<U> BTX[2] = { tape.var( X[0] ), tape.var( X[1] ) };
+    BVar<U> BTF = BTfct()( BTX );
+    tape.reverse( BTF );
+
+    fadbad::B<U> BX[2] = { X[0], X[1] };
+    fadbad::B<U> BF = BTfct()( BX );
+    BF.diff( 0, 1 );
+
+    return Eq( BTF.val(), BF.x() ) && Eq( BTX[0].d(), BX[0].d(0) ) && Eq( BTX[1].d(), BX[1].d(0) );
+  }
+
+public:
+
+  void setUp(){}
+
+  void tearDown(){}
+
+  void testDouble(){
+    const double X[2] = { 1.5, -0.5 };
+    CPPUNIT_ASSERT( Compare( X ) );
+  }
+
+  void testInterval(){
+    const Interval X[2] = { Interval( 1., 2. ), Interval( -1., 0. ) };
+    CPPUNIT_ASSERT( Compare( X ) );
+  }
+
+  void testMcCormick(){
+    MC::options.MVCOMP_USE = false;
+    const MC X[2] = { MC( Interval( 1., 2. ), 1.5 ).sub( 2, 0 ),
+                      MC( Interval( -1., 0. ), -0.5 ).sub( 2, 1 ) };
+    CPPUNIT_ASSERT( Compare( X ) );
+  }
+
+  void testTModel(){
+    TModel<Interval> TM( 2, 3 );
+    const TV X[2] = { TV( &TM, 0, Interval( 1., 2. ) ), TV( &TM, 1, Interval( -1., 0. ) ) };
+    CPPUNIT_ASSERT( Compare( X ) );
+  }
+
+  void testReset(){
+    // Recording on a reset tape reuses its entries
+    BTape<Interval> tape;
+    unsigned int size = 0;
+    for( unsigned int k=0; k<10; k++ ){
+      tape.reset();
+      const Interval X[2] = { Interval( 1.+0.1*k, 2. ), Interval( -1., 0.1*k ) };
+      BVar<Interval> BTX[2] = { tape.var( X[0] ), tape.var( X[1] ) };
+      BVar<Interval> BTF = BTfct()( BTX );
+      tape.reverse( BTF );
+      CPPUNIT_ASSERT( !k || tape.size() == size );
+      size = tape.size();
+      CPPUNIT_ASSERT( Compare( X ) );
+
+      fadbad::B<Interval> BX[2] = { X[0], X[1] };
+      fadbad::B<Interval> BF = BTfct()( BX );
+      BF.diff( 0, 1 );
+      CPPUNIT_ASSERT( Eq( BTX[0].d(), BX[0].d(0) ) && Eq( BTX[1].d(), BX[1].d(0) ) );
+    }
+
+    // Adjoints of variables that the dependent does not depend on are zero
+    BVar<Interval> BTY = tape.var( Interval( 1., 2. ) ), BTZ = tape.var( 3. );
+    BVar<Interval> BTF = 2.*BTY + 1.;
+    tape.reverse( BTF );
+    CPPUNIT_ASSERT( Eq( BTY.d(), Interval( 2. ) ) );
+    CPPUNIT_ASSERT( Eq( BTZ.d(), Interval( 0. ) ) );
+  }
+
+  void testTape(){
+    // The following line should throw an instance of BTI::Exceptions
+    BTI tape1, tape2;
+    tape1.var( 1. ) + tape2.var( 2. );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::BTapeTest );
+
+} // end namespace mc
+
+#endif
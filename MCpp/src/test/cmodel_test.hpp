@@ -0,0 +1,158 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__CMODEL_TEST_HPP
+#define MC__CMODEL_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "cmodel.hpp"
+#include "tmodel.hpp"
+
+namespace mc
+{
+//! @brief C++ class for test of mc::CModel / mc::CVar class using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! CModelTest is a C++ class for testing the multivariate Chebyshev
+//! arithmetic class mc::CModel using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class CModelTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( CModelTest );
+CPPUNIT_TEST( testProduct );
+CPPUNIT_TEST( testExpression1 );
+CPPUNIT_TEST( testExpression2 );
+CPPUNIT_TEST( testExpression3 );
+CPPUNIT_TEST_EXCEPTION( testDivisionByZero, CModel<Interval>::Exceptions );
+CPPUNIT_TEST_EXCEPTION( testCMEnv, CModel<Interval>::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  bool Eq( const Interval&I1, const Interval&I2,
+           const double atol=1e2*machprec(), const double rtol=1e2*machprec() ) const
+  {
+    return( isequal( I1.l(), I2.l(), atol, rtol )
+         && isequal( I1.u(), I2.u(), atol, rtol ) );
+  }
+
+  bool Eq( const double&D1, const double&D2,
+           const double atol=1e2*machprec(), const double rtol=1e2*machprec() ) const
+  {
+    return isequal( D1, D2, atol, rtol );
+  }
+
+  //! @brief Check that f(x)-P(x) lies in the remainder bound at the points x
+  template <typename F> bool Encl
+    ( const CVar<Interval>&CVF, F f, const unsigned int nvar,
+      const Interval*X, const unsigned int ngrid=20 ) const
+  {
+    const double tol = 1e2*machprec();
+    double x[2];
+    for( unsigned int i=0; i<=ngrid; i++ ){
+      for( unsigned int j=0; j<=(nvar>1?ngrid:0); j++ ){
+        x[0] = X[0].l() + i*diam(X[0])/ngrid;
+        if( nvar > 1 ) x[1] = X[1].l() + j*diam(X[1])/ngrid;
+        const double err = f(x) - CVF.P(x);
+        if( err < CVF.R().l()-tol || err > CVF.R().u()+tol ) return false;
+      }
+    }
+    return true;
+  }
+
+  struct fct1{ static double eval( const double*x )
+    { return x[0]*std::exp(-std::pow(x[0],2)); } };
+  struct fct2{ static double eval( const double*x )
+    { return std::exp(x[0])*std::sin(x[0]); } };
+  struct fct3{ static double eval( const double*x )
+    { return x[0]*std::exp(x[0]+std::pow(x[1],2))-std::pow(x[1],2); } };
+
+  CModel<Interval>* CM_1d;
+  CModel<Interval>* CM_2d;
+  CVar<Interval> CVX;
+  CVar<Interval> CVX1;
+  CVar<Interval> CVX2;
+
+public:
+
+  void setUp(){
+    CM_1d = new CModel<Interval>( 1, 4 );
+    CM_2d = new CModel<Interval>( 2, 4 );
+  }
+
+  void tearDown(){
+    delete CM_1d;
+    delete CM_2d;
+  }
+
+  void testProduct(){
+    // x^2 = (T0+T2)/2 and x^3 = (3T1+T3)/4 on [-1,1], with no remainder
+    CVX = CVar<Interval>( CM_1d, 0, Interval(-1., 1.) );
+    CVar<Interval> CVF = pow(CVX,2);
+    CPPUNIT_ASSERT( Eq( CVF.coefmon().second[0], 0.5 ) );
+    CPPUNIT_ASSERT( Eq( CVF.coefmon().second[1], 0. ) );
+    CPPUNIT_ASSERT( Eq( CVF.coefmon().second[2], 0.5 ) );
+    CPPUNIT_ASSERT( Eq( CVF.R(), Interval(0.) ) );
+    CVF = CVX*CVF;
+    CPPUNIT_ASSERT( Eq( CVF.coefmon().second[1], 0.75 ) );
+    CPPUNIT_ASSERT( Eq( CVF.coefmon().second[3], 0.25 ) );
+    CPPUNIT_ASSERT( Eq( CVF.B(), Interval(-1.,1.) ) );
+    // x^5 is truncated at order 4 with remainder |T5|/16
+    CVF = CVF*sqr(CVX);
+    CPPUNIT_ASSERT( Eq( CVF.R(), Interval(-1./16.,1./16.) ) );
+  }
+
+  void testExpression1(){
+    const Interval X( 1., 2. );
+    CVX = CVar<Interval>( CM_1d, 0, X );
+    CVar<Interval> CVF = CVX*exp(-pow(CVX,2));
+    CPPUNIT_ASSERT( Encl( CVF, fct1::eval, 1, &X ) );
+  }
+
+  void testExpression2(){
+    // Chebyshev model tighter than Taylor model on wide domain
+    const Interval X( -3., 3. );
+    CModel<Interval> CM( 1, 6 );
+    CVar<Interval> CVF = exp(CVar<Interval>( &CM, 0, X ))*sin(CVar<Interval>( &CM, 0, X ));
+    CPPUNIT_ASSERT( Encl( CVF, fct2::eval, 1, &X ) );
+    TModel<Interval> TM( 1, 6 );
+    TVar<Interval> TVF = exp(TVar<Interval>( &TM, 0, X ))*sin(TVar<Interval>( &TM, 0, X ));
+    CPPUNIT_ASSERT( diam(CVF.R()) < diam(TVF.R()) );
+    CPPUNIT_ASSERT( diam(CVF.B()) < diam(TVF.B()) );
+  }
+
+  void testExpression3(){
+    const Interval X[2] = { Interval( 1., 2. ), Interval( 0., 1. ) };
+    CVX1 = CVar<Interval>( CM_2d, 0, X[0] );
+    CVX2 = CVar<Interval>( CM_2d, 1, X[1] );
+    CVar<Interval> CVF = CVX1*exp(CVX1+pow(CVX2,2))-pow(CVX2,2);
+    CPPUNIT_ASSERT( Encl( CVF, fct3::eval, 2, X ) );
+    CPPUNIT_ASSERT( Eq( CVF.B(), CVF.B(0)+CVF.B(1)+CVF.B(2)+CVF.B(3)+CVF.B(4)+CVF.R() ) );
+  }
+
+  void testDivisionByZero(){
+    // The following line should throw an instance of CModel<Interval>::Exceptions
+    CVX = CVar<Interval>( CM_1d, 0, Interval(-1., 1.) );
+    inv(CVX);
+  }
+
+  void testCMEnv(){
+    // The following line should throw an instance of CModel<Interval>::Exceptions
+    CVX  = CVar<Interval>( CM_1d, 0, Interval(0., PI/3.) );
+    CVX2 = CVar<Interval>( CM_2d, 1, Interval(0., 1.) );
+    CVX+CVX2;
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::CModelTest );
+
+} // end namespace mc
+
+#endif
@@ -0,0 +1,156 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__FFBRANCHBOUND_TEST_HPP
+#define MC__FFBRANCHBOUND_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <limits>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "ffunc.hpp"
+#include "ffbranchbound.hpp"
+
+namespace mc
+{
+//! @brief C++ class for test of mc::FFBranchBound class using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! FFBranchBoundTest is a C++ class for testing the global minimization
+//! of factorable functions by spatial branch-and-bound with
+//! mc::FFBranchBound in interval arithmetic, using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class FFBranchBoundTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( FFBranchBoundTest );
+CPPUNIT_TEST( testCamel );
+CPPUNIT_TEST( testConstrained );
+CPPUNIT_TEST( testInfeasible );
+CPPUNIT_TEST( testUnresolved );
+CPPUNIT_TEST( testInterrupted );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef FFBranchBound<Interval> BB;
+
+  FFGraph DAG;
+  FFVar X[2];
+  //! @brief Infinite bound of the one-sided constraints
+  double INF;
+
+  //! @brief Six-hump camel function, with global minimum -1.0316284535 on [-3,3]x[-2,2]
+  FFVar camel() const
+  {
+    return 4.*sqr(X[0]) - 2.1*pow(X[0],4) + pow(X[0],6)/3. + X[0]*X[1]
+           - 4.*sqr(X[1]) + 4.*pow(X[1],4);
+  }
+
+public:
+
+  void setUp(){
+    DAG.clear();
+    for( unsigned int i=0; i<2; i++ ) X[i] = DAG.var();
+    INF = std::numeric_limits<double>::infinity();
+  }
+
+  void tearDown(){}
+
+  void testCamel(){
+    // Same global minimum with all the lower bounding arithmetics, bracketed by the final bounds
+    const FFVar F = camel();
+    BB solver( DAG, F, 0, 0, 2, X );
+    const Interval IX[2] = { Interval(-3.,3.), Interval(-2.,2.) };
+    const double FOPT = -1.0316284535;
+    const BB::Options::BOUNDER LB[2] = { BB::Options::MCCORMICK, BB::Options::TAYLOR };
+    for( unsigned int k=0; k<2; k++ ){
+      solver.options.LBOUND = LB[k];
+      CPPUNIT_ASSERT( solver.solve( IX ) == BB::OPTIMAL );
+      CPPUNIT_ASSERT( solver.lower() <= FOPT+1e-9 && solver.upper() >= FOPT-1e-9 );
+      CPPUNIT_ASSERT( solver.upper()-solver.lower() <= 1e-5*std::fabs(FOPT)+1e-12 );
+      CPPUNIT_ASSERT( solver.solution().size() == 2 );
+      CPPUNIT_ASSERT( std::fabs( std::fabs(solver.solution()[0]) - 0.0898 ) < 1e-2 );
+      CPPUNIT_ASSERT( std::fabs( std::fabs(solver.solution()[1]) - 0.7126 ) < 1e-2 );
+    }
+
+    // Interval bounds alone are much slower to close the gap on this function
+    const unsigned int nnodeT = solver.nnode();
+    solver.options.LBOUND = BB::Options::INTERVAL;
+    solver.options.MAXNODE = 10*nnodeT;
+    CPPUNIT_ASSERT( solver.solve( IX ) == BB::INTERRUPTED );
+    CPPUNIT_ASSERT( solver.lower() <= FOPT+1e-9 );
+  }
+
+  void testConstrained(){
+    // Floudas et al. (1999), Section 4.10: global minimum -5.50801327 at (2.3295,3.1785)
+    const FFVar F = -X[0]-X[1];
+    const FFVar G[2] = { X[1]-2.*pow(X[0],4)+8.*pow(X[0],3)-8.*sqr(X[0]),
+                         X[1]-4.*pow(X[0],4)+32.*pow(X[0],3)-88.*sqr(X[0])+96.*X[0] };
+    BB solver( DAG, F, 2, G, 2, X );
+    const Interval IX[2] = { Interval(0.,3.), Interval(0.,4.) };
+    const Interval IC[2] = { Interval(-INF,2.), Interval(-INF,36.) };
+    CPPUNIT_ASSERT( solver.solve( IX, IC ) == BB::OPTIMAL );
+    CPPUNIT_ASSERT( solver.lower() <= -5.50801327 && solver.upper() >= -5.50801328 );
+    CPPUNIT_ASSERT( std::fabs( solver.solution()[0]-2.3295 ) < 1e-3 );
+    CPPUNIT_ASSERT( std::fabs( solver.solution()[1]-3.1785 ) < 1e-3 );
+
+    // Same result without the box reductions
+    const unsigned int nnodeR = solver.nnode();
+    solver.options.CONTRACT = solver.options.LINRED = false;
+    CPPUNIT_ASSERT( solver.solve( IX, IC ) == BB::OPTIMAL );
+    CPPUNIT_ASSERT( solver.lower() <= -5.50801327 && solver.upper() >= -5.50801328 );
+    CPPUNIT_ASSERT( solver.nnode() >= nnodeR );
+
+    // The ranges of the constraints cannot be omitted
+    bool thrown = false;
+    try{ solver.solve( IX ); }
+    catch( FFGraph::Exceptions &eObj ){ thrown = ( eObj.ierr() == FFGraph::Exceptions::SIZE ); }
+    CPPUNIT_ASSERT( thrown );
+  }
+
+  void testInfeasible(){
+    // x*y >= 2 cannot be satisfied on [0,1]^2
+    const FFVar F = X[0]+X[1], G = X[0]*X[1];
+    BB solver( DAG, F, 1, &G, 2, X );
+    const Interval IX[2] = { Interval(0.,1.), Interval(0.,1.) }, IC( 2., INF );
+    solver.options.CONTRACT = false;
+    CPPUNIT_ASSERT( solver.solve( IX, &IC ) == BB::INFEASIBLE );
+    CPPUNIT_ASSERT( solver.solution().empty() && solver.upper() == INF );
+  }
+
+  void testUnresolved(){
+    // x^2 = 2 is not satisfied exactly at any point: the nodes around sqrt(2) are kept without incumbent
+    const FFVar F = X[0], G = sqr(X[0]);
+    BB solver( DAG, F, 1, &G, 1, X );
+    const Interval IX( 0., 2. ), IC( 2., 2. );
+    solver.options.FEASTOL = 0.;
+    solver.options.CONTRACT = false;
+    CPPUNIT_ASSERT( solver.solve( &IX, &IC ) == BB::UNRESOLVED );
+    CPPUNIT_ASSERT( solver.solution().empty() && solver.upper() == INF );
+    CPPUNIT_ASSERT( solver.lower() <= std::sqrt(2.) );
+    CPPUNIT_ASSERT( solver.nnode() > 1 );
+  }
+
+  void testInterrupted(){
+    // Valid lower bound and feasible incumbent when the node limit is reached
+    const FFVar F = camel();
+    BB solver( DAG, F, 0, 0, 2, X );
+    const Interval IX[2] = { Interval(-3.,3.), Interval(-2.,2.) };
+    solver.options.MAXNODE = 5;
+    CPPUNIT_ASSERT( solver.solve( IX ) == BB::INTERRUPTED );
+    CPPUNIT_ASSERT( solver.nnode() == 5 );
+    CPPUNIT_ASSERT( solver.lower() <= -1.0316284535 && solver.lower() <= solver.upper() );
+    CPPUNIT_ASSERT( solver.solution().size() == 2 );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::FFBranchBoundTest );
+
+} // end namespace mc
+
+#endif
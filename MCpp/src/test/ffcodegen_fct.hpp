@@ -0,0 +1,271 @@
+// McCormick relaxations of 2 function(s) in 2 variable(s), generated by mc::FFCodeGen
+
+#ifndef MC__FFCODEGEN_KERNELS
+#define MC__FFCODEGEN_KERNELS
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+namespace mcgen
+{
+// Bounds and relaxations of a value, and subgradients of a relaxation as
+// k1*s(i1,a)+k2*s(i2,b), where s(i,a) is the subgradient of the convex
+// (i=CV) or concave (i=CC) relaxation of operand a, or 0 (i=0)
+enum{ CUT=0, CV, CC };
+struct val{ double l, u, cv, cc; };
+struct der{ int i1, i2; double k1, k2; };
+inline double sel( const int i, const double cvs, const double ccs )
+{ return i==CV? cvs: i==CC? ccs: 0.; }
+inline double mid( const double cv, const double cc, const double z, int&i )
+{ if( z < cv ){ i = CV; return cv; } if( z > cc ){ i = CC; return cc; } i = CUT; return z; }
+inline double mid( const double l, const double u, const double z )
+{ int i; return mid( l, u, z, i ); }
+inline bool thin( const double l, const double u )
+{ return !( std::fabs(l-u) > DBL_EPSILON + 0.5*std::fabs(l+u)*DBL_EPSILON ); }
+inline void set( der&d, const int i, const double k )
+{ d.i1 = i; d.k1 = k; d.i2 = CUT; d.k2 = 0.; }
+inline void set( der&d, const int i1, const double k1, const int i2, const double k2 )
+{ d.i1 = i1; d.k1 = k1; d.i2 = i2; d.k2 = k2; }
+inline int cut( val&r, der&dcv, der&dcc )
+{
+  if( r.cv < r.l ){ r.cv = r.l; dcv.k1 = dcv.k2 = 0.; }
+  if( r.cc > r.u ){ r.cc = r.u; dcc.k1 = dcc.k2 = 0.; }
+  return 0;
+}
+inline int mul( const val&a, const val&b, val&r, der&dcv, der&dcc )
+{
+  r.l = std::min( std::min( a.l*b.l, a.l*b.u ), std::min( a.u*b.l, a.u*b.u ) );
+  r.u = std::max( std::max( a.l*b.l, a.l*b.u ), std::max( a.u*b.l, a.u*b.u ) );
+  const int ia1 = b.u>=0.? CV: CC, ib1 = a.u>=0.? CV: CC, ia2 = b.l>=0.? CV: CC, ib2 = a.l>=0.? CV: CC;
+  const double cv1 = b.u*(ia1==CV? a.cv: a.cc) + a.u*(ib1==CV? b.cv: b.cc) - a.u*b.u;
+  const double cv2 = b.l*(ia2==CV? a.cv: a.cc) + a.l*(ib2==CV? b.cv: b.cc) - a.l*b.l;
+  if( cv1 > cv2 ){ r.cv = cv1; set( dcv, ia1, b.u, ib1, a.u ); }
+  else{ r.cv = cv2; set( dcv, ia2, b.l, ib2, a.l ); }
+  const int ja1 = b.l>=0.? CC: CV, jb1 = a.u>=0.? CC: CV, ja2 = b.u>=0.? CC: CV, jb2 = a.l>=0.? CC: CV;
+  const double cc1 = b.l*(ja1==CV? a.cv: a.cc) + a.u*(jb1==CV? b.cv: b.cc) - a.u*b.l;
+  const double cc2 = b.u*(ja2==CV? a.cv: a.cc) + a.l*(jb2==CV? b.cv: b.cc) - a.l*b.u;
+  if( cc1 < cc2 ){ r.cc = cc1; set( dcc, ja1, b.l, jb1, a.u ); }
+  else{ r.cc = cc2; set( dcc, ja2, b.u, jb2, a.l ); }
+  return cut( r, dcv, dcc );
+}
+inline int inv( const val&a, val&r, der&dcv, der&dcc )
+{
+  if( a.l <= 0. && a.u >= 0. ) return 2;
+  r.l = 1./a.u; r.u = 1./a.l;
+  int i; double m;
+  if( a.l > 0. ){
+    m = mid( a.cv, a.cc, a.u, i ); r.cv = 1./m; set( dcv, i, -1./(m*m) );
+    m = mid( a.cv, a.cc, a.l, i ); r.cc = 1./a.l + 1./a.u - m/(a.l*a.u); set( dcc, i, -1./(a.l*a.u) );
+  }
+  else{
+    m = mid( a.cv, a.cc, a.u, i ); r.cv = 1./a.l + 1./a.u - m/(a.l*a.u); set( dcv, i, -1./(a.l*a.u) );
+    m = mid( a.cv, a.cc, a.l, i ); r.cc = 1./m; set( dcc, i, -1./(m*m) );
+  }
+  return cut( r, dcv, dcc );
+}
+inline int sqr( const val&a, val&r, der&dcv, der&dcc )
+{
+  const double z = mid( a.l, a.u, 0. ), zu = a.l*a.l > a.u*a.u? a.l: a.u;
+  r.l = z*z; r.u = std::max( a.l*a.l, a.u*a.u );
+  int i; double m = mid( a.cv, a.cc, z, i ); r.cv = m*m; set( dcv, i, 2.*m );
+  const double s = thin( a.l, a.u )? 0.: ( a.u*a.u - a.l*a.l )/( a.u - a.l );
+  m = mid( a.cv, a.cc, zu, i ); r.cc = a.l*a.l + s*( m - a.l ); set( dcc, i, s );
+  return cut( r, dcv, dcc );
+}
+inline int pow( const val&a, const int n, val&r, der&dcv, der&dcc )
+{
+  int i; double m;
+  if( n >= 2 ){
+    const double z = mid( a.l, a.u, 0. ), pl = std::pow( a.l, n ), pu = std::pow( a.u, n );
+    r.l = std::max( 0., std::pow( z, n ) ); r.u = std::max( pl, pu );
+    m = mid( a.cv, a.cc, z, i ); r.cv = std::pow( m, n ); set( dcv, i, n*std::pow( m, n-1 ) );
+    const double s = thin( a.l, a.u )? 0.: ( pu - pl )/( a.u - a.l );
+    m = mid( a.cv, a.cc, pl > pu? a.l: a.u, i ); r.cc = pl + s*( m - a.l ); set( dcc, i, s );
+    return cut( r, dcv, dcc );
+  }
+  if( n == -1 ) return inv( a, r, dcv, dcc );
+  if( a.l <= 0. && a.u >= 0. ) return 2;
+  const int p = -n;
+  const double pl = p%2? std::pow( a.l, p ): std::max( 0., std::pow( mid( a.l, a.u, 0. ), p ) );
+  const double pu = p%2? std::pow( a.u, p ): std::max( std::pow( a.l, p ), std::pow( a.u, p ) );
+  r.l = 1./pu; r.u = 1./pl;
+  double s = std::pow( a.l, p-1 ) + std::pow( a.u, p-1 );
+  for( int k=1; k<=p-2; k++ ) s += std::pow( a.l, k ) * std::pow( a.u, p-1-k );
+  s /= - std::pow( a.l, p ) * std::pow( a.u, p );
+  if( a.l > 0. ){
+    m = mid( a.cv, a.cc, a.u, i ); r.cv = std::pow( m, n ); set( dcv, i, n*std::pow( m, n-1 ) );
+    m = mid( a.cv, a.cc, a.l, i ); r.cc = std::pow( a.l, n ) + s*( m - a.l ); set( dcc, i, s );
+  }
+  else if( p%2 ){
+    m = mid( a.cv, a.cc, a.u, i ); r.cv = std::pow( a.l, n ) + s*( m - a.l ); set( dcv, i, s );
+    m = mid( a.cv, a.cc, a.l, i ); r.cc = std::pow( m, n ); set( dcc, i, n*std::pow( m, n-1 ) );
+  }
+  else{
+    m = mid( a.cv, a.cc, a.l, i ); r.cv = std::pow( m, n ); set( dcv, i, n*std::pow( m, n-1 ) );
+    m = mid( a.cv, a.cc, a.u, i ); r.cc = std::pow( a.l, n ) + s*( m - a.l ); set( dcc, i, s );
+  }
+  return cut( r, dcv, dcc );
+}
+inline int sqrt( const val&a, val&r, der&dcv, der&dcc )
+{
+  if( a.l < 0. ) return 4;
+  r.l = std::max( 0., std::sqrt( a.l ) ); r.u = std::sqrt( a.u );
+  const double s = thin( a.l, a.u )? 0.: ( std::sqrt( a.u ) - std::sqrt( a.l ) )/( a.u - a.l );
+  int i; double m = mid( a.cv, a.cc, a.l, i ); r.cv = std::sqrt( a.l ) + s*( m - a.l ); set( dcv, i, s );
+  m = mid( a.cv, a.cc, a.u, i ); r.cc = std::sqrt( m ); set( dcc, i, 1./(2.*r.cc) );
+  return cut( r, dcv, dcc );
+}
+inline int exp( const val&a, val&r, der&dcv, der&dcc )
+{
+  r.l = std::max( 0., std::exp( a.l ) ); r.u = std::exp( a.u );
+  int i; double m = mid( a.cv, a.cc, a.l, i ); r.cv = std::exp( m ); set( dcv, i, r.cv );
+  const double s = thin( a.l, a.u )? 0.: ( std::exp( a.u ) - std::exp( a.l ) )/( a.u - a.l );
+  m = mid( a.cv, a.cc, a.u, i ); r.cc = std::exp( a.u ) + s*( m - a.u ); set( dcc, i, s );
+  return cut( r, dcv, dcc );
+}
+inline int log( const val&a, val&r, der&dcv, der&dcc )
+{
+  if( a.l <= 0. ) return 3;
+  r.l = std::log( a.l ); r.u = std::log( a.u );
+  const double s = thin( a.l, a.u )? 0.: ( std::log( a.u ) - std::log( a.l ) )/( a.u - a.l );
+  int i; double m = mid( a.cv, a.cc, a.l, i ); r.cv = std::log( a.l ) + s*( m - a.l ); set( dcv, i, s );
+  m = mid( a.cv, a.cc, a.u, i ); r.cc = std::log( m ); set( dcc, i, 1./m );
+  return cut( r, dcv, dcc );
+}
+inline int xlog( const val&a, val&r, der&dcv, der&dcc )
+{
+  if( a.l <= 0. ) return 3;
+  const double z = mid( a.l, a.u, std::exp(-1.) ), xl = a.l*std::log( a.l ), xu = a.u*std::log( a.u );
+  r.l = z*std::log( z ); r.u = std::max( xl, xu );
+  int i; double m = mid( a.cv, a.cc, z, i ); r.cv = m*std::log( m ); set( dcv, i, std::log( m ) + 1. );
+  const double s = thin( a.l, a.u )? 0.: ( xu - xl )/( a.u - a.l );
+  m = mid( a.cv, a.cc, xu >= xl? a.u: a.l, i ); r.cc = xl + s*( m - a.l ); set( dcc, i, s );
+  return cut( r, dcv, dcc );
+}
+inline int fabs( const val&a, val&r, der&dcv, der&dcc )
+{
+  const double z = mid( a.l, a.u, 0. );
+  r.l = std::fabs( z ); r.u = std::max( std::fabs( a.l ), std::fabs( a.u ) );
+  int i; double m = mid( a.cv, a.cc, z, i ); r.cv = std::fabs( m ); set( dcv, i, m >= 0.? 1.: -1. );
+  const double s = thin( a.l, a.u )? 0.: ( std::fabs( a.u ) - std::fabs( a.l ) )/( a.u - a.l );
+  m = mid( a.cv, a.cc, std::fabs( a.l ) > std::fabs( a.u )? a.l: a.u, i ); r.cc = std::fabs( a.l ) + s*( m - a.l ); set( dcc, i, s );
+  return cut( r, dcv, dcc );
+}
+} // namespace mcgen
+#endif
+
+inline int cgfct
+( const double*xL, const double*xU, const double*xref, double*fL, double*fU,
+  double*fcv, double*fcc, double*fcvsub, double*fccsub )
+{
+  const mcgen::val v0 = { xL[0], xU[0], xref[0], xref[0] };
+  const mcgen::val v1 = { xL[1], xU[1], xref[1], xref[1] };
+  const mcgen::val v2 = { 2. + v0.l, 2. + v0.u, 2. + v0.cv, 2. + v0.cc };
+  const double v2_cvs0 = 1., v2_ccs0 = 1.;
+  mcgen::val v3; mcgen::der v3cv, v3cc;
+  if( int err = mcgen::pow( v2, -2, v3, v3cv, v3cc ) ) return err;
+  const double v3_cvs0 = v3cv.k1*mcgen::sel( v3cv.i1, v2_cvs0, v2_ccs0 ), v3_ccs0 = v3cc.k1*mcgen::sel( v3cc.i1, v2_cvs0, v2_ccs0 );
+  const mcgen::val v4 = { 1. + v0.l, 1. + v0.u, 1. + v0.cv, 1. + v0.cc };
+  const double v4_cvs0 = 1., v4_ccs0 = 1.;
+  mcgen::val v5; mcgen::der v5cv, v5cc;
+  if( int err = mcgen::inv( v4, v5, v5cv, v5cc ) ) return err;
+  const double v5_cvs0 = v5cv.k1*mcgen::sel( v5cv.i1, v4_cvs0, v4_ccs0 ), v5_ccs0 = v5cc.k1*mcgen::sel( v5cc.i1, v4_cvs0, v4_ccs0 );
+  const mcgen::val v6 = { (-0.5) + v0.l, (-0.5) + v0.u, (-0.5) + v0.cv, (-0.5) + v0.cc };
+  const double v6_cvs0 = 1., v6_ccs0 = 1.;
+  mcgen::val v7p; mcgen::der v7pcv, v7pcc;
+  if( int err = mcgen::pow( v6, 2, v7p, v7pcv, v7pcc ) ) return err;
+  const double v7p_cvs0 = v7pcv.k1*mcgen::sel( v7pcv.i1, v6_cvs0, v6_ccs0 ), v7p_ccs0 = v7pcc.k1*mcgen::sel( v7pcc.i1, v6_cvs0, v6_ccs0 );
+  mcgen::val v7; mcgen::der v7cv, v7cc;
+  if( int err = mcgen::mul( v7p, v6, v7, v7cv, v7cc ) ) return err;
+  const double v7_cvs0 = v7cv.k1*mcgen::sel( v7cv.i1, v7p_cvs0, v7p_ccs0 ) + v7cv.k2*mcgen::sel( v7cv.i2, v6_cvs0, v6_ccs0 ), v7_ccs0 = v7cc.k1*mcgen::sel( v7cc.i1, v7p_cvs0, v7p_ccs0 ) + v7cc.k2*mcgen::sel( v7cc.i2, v6_cvs0, v6_ccs0 );
+  mcgen::val v8; mcgen::der v8cv, v8cc;
+  if( int err = mcgen::pow( v1, 4, v8, v8cv, v8cc ) ) return err;
+  const double v8_cvs1 = v8cv.k1*mcgen::sel( v8cv.i1, 1., 1. ), v8_ccs1 = v8cc.k1*mcgen::sel( v8cc.i1, 1., 1. );
+  const mcgen::val v9 = { v0.l - v1.u, v0.u - v1.l, v0.cv - v1.cc, v0.cc - v1.cv };
+  const double v9_cvs0 = 1., v9_ccs0 = 1.;
+  const double v9_cvs1 = -1., v9_ccs1 = -1.;
+  mcgen::val v10; mcgen::der v10cv, v10cc;
+  if( int err = mcgen::fabs( v9, v10, v10cv, v10cc ) ) return err;
+  const double v10_cvs0 = v10cv.k1*mcgen::sel( v10cv.i1, v9_cvs0, v9_ccs0 ), v10_ccs0 = v10cc.k1*mcgen::sel( v10cc.i1, v9_cvs0, v9_ccs0 );
+  const double v10_cvs1 = v10cv.k1*mcgen::sel( v10cv.i1, v9_cvs1, v9_ccs1 ), v10_ccs1 = v10cc.k1*mcgen::sel( v10cc.i1, v9_cvs1, v9_ccs1 );
+  mcgen::val v11; mcgen::der v11cv, v11cc;
+  if( int err = mcgen::xlog( v4, v11, v11cv, v11cc ) ) return err;
+  const double v11_cvs0 = v11cv.k1*mcgen::sel( v11cv.i1, v4_cvs0, v4_ccs0 ), v11_ccs0 = v11cc.k1*mcgen::sel( v11cc.i1, v4_cvs0, v4_ccs0 );
+  const mcgen::val v12 = { 3. - v1.u, 3. - v1.l, 3. - v1.cc, 3. - v1.cv };
+  const double v12_cvs1 = -1., v12_ccs1 = -1.;
+  mcgen::val v13; mcgen::der v13cv, v13cc;
+  if( int err = mcgen::log( v12, v13, v13cv, v13cc ) ) return err;
+  const double v13_cvs1 = v13cv.k1*mcgen::sel( v13cv.i1, v12_cvs1, v12_ccs1 ), v13_ccs1 = v13cc.k1*mcgen::sel( v13cc.i1, v12_cvs1, v12_ccs1 );
+  mcgen::val v14; mcgen::der v14cv, v14cc;
+  if( int err = mcgen::sqrt( v2, v14, v14cv, v14cc ) ) return err;
+  const double v14_cvs0 = v14cv.k1*mcgen::sel( v14cv.i1, v2_cvs0, v2_ccs0 ), v14_ccs0 = v14cc.k1*mcgen::sel( v14cc.i1, v2_cvs0, v2_ccs0 );
+  mcgen::val v15; mcgen::der v15cv, v15cc;
+  if( int err = mcgen::mul( v13, v14, v15, v15cv, v15cc ) ) return err;
+  const double v15_cvs0 = v15cv.k2*mcgen::sel( v15cv.i2, v14_cvs0, v14_ccs0 ), v15_ccs0 = v15cc.k2*mcgen::sel( v15cc.i2, v14_cvs0, v14_ccs0 );
+  const double v15_cvs1 = v15cv.k1*mcgen::sel( v15cv.i1, v13_cvs1, v13_ccs1 ), v15_ccs1 = v15cc.k1*mcgen::sel( v15cc.i1, v13_cvs1, v13_ccs1 );
+  mcgen::val v16; mcgen::der v16cv, v16cc;
+  if( int err = mcgen::sqr( v0, v16, v16cv, v16cc ) ) return err;
+  const double v16_cvs0 = v16cv.k1*mcgen::sel( v16cv.i1, 1., 1. ), v16_ccs0 = v16cc.k1*mcgen::sel( v16cc.i1, 1., 1. );
+  const mcgen::val v17 = { 1. + v16.l, 1. + v16.u, 1. + v16.cv, 1. + v16.cc };
+  const double v17_cvs0 = v16_cvs0, v17_ccs0 = v16_ccs0;
+  mcgen::val v18; mcgen::der v18cv, v18cc;
+  if( int err = mcgen::sqr( v1, v18, v18cv, v18cc ) ) return err;
+  const double v18_cvs1 = v18cv.k1*mcgen::sel( v18cv.i1, 1., 1. ), v18_ccs1 = v18cc.k1*mcgen::sel( v18cc.i1, 1., 1. );
+  const mcgen::val v19 = { 2.*v18.l, 2.*v18.u, 2.*v18.cv, 2.*v18.cc };
+  const double v19_cvs1 = 2.*v18_cvs1, v19_ccs1 = 2.*v18_ccs1;
+  mcgen::val v20i; mcgen::der v20icv, v20icc;
+  if( int err = mcgen::inv( v17, v20i, v20icv, v20icc ) ) return err;
+  const double v20i_cvs0 = v20icv.k1*mcgen::sel( v20icv.i1, v17_cvs0, v17_ccs0 ), v20i_ccs0 = v20icc.k1*mcgen::sel( v20icc.i1, v17_cvs0, v17_ccs0 );
+  mcgen::val v20; mcgen::der v20cv, v20cc;
+  if( int err = mcgen::mul( v19, v20i, v20, v20cv, v20cc ) ) return err;
+  const double v20_cvs0 = v20cv.k2*mcgen::sel( v20cv.i2, v20i_cvs0, v20i_ccs0 ), v20_ccs0 = v20cc.k2*mcgen::sel( v20cc.i2, v20i_cvs0, v20i_ccs0 );
+  const double v20_cvs1 = v20cv.k1*mcgen::sel( v20cv.i1, v19_cvs1, v19_ccs1 ), v20_ccs1 = v20cc.k1*mcgen::sel( v20cc.i1, v19_cvs1, v19_ccs1 );
+  mcgen::val v21; mcgen::der v21cv, v21cc;
+  if( int err = mcgen::exp( v0, v21, v21cv, v21cc ) ) return err;
+  const double v21_cvs0 = v21cv.k1*mcgen::sel( v21cv.i1, 1., 1. ), v21_ccs0 = v21cc.k1*mcgen::sel( v21cc.i1, 1., 1. );
+  mcgen::val v22; mcgen::der v22cv, v22cc;
+  if( int err = mcgen::mul( v0, v1, v22, v22cv, v22cc ) ) return err;
+  const double v22_cvs0 = v22cv.k1*mcgen::sel( v22cv.i1, 1., 1. ), v22_ccs0 = v22cc.k1*mcgen::sel( v22cc.i1, 1., 1. );
+  const double v22_cvs1 = v22cv.k2*mcgen::sel( v22cv.i2, 1., 1. ), v22_ccs1 = v22cc.k2*mcgen::sel( v22cc.i2, 1., 1. );
+  mcgen::val v23; mcgen::der v23cv, v23cc;
+  if( int err = mcgen::mul( v21, v22, v23, v23cv, v23cc ) ) return err;
+  const double v23_cvs0 = v23cv.k1*mcgen::sel( v23cv.i1, v21_cvs0, v21_ccs0 ) + v23cv.k2*mcgen::sel( v23cv.i2, v22_cvs0, v22_ccs0 ), v23_ccs0 = v23cc.k1*mcgen::sel( v23cc.i1, v21_cvs0, v21_ccs0 ) + v23cc.k2*mcgen::sel( v23cc.i2, v22_cvs0, v22_ccs0 );
+  const double v23_cvs1 = v23cv.k2*mcgen::sel( v23cv.i2, v22_cvs1, v22_ccs1 ), v23_ccs1 = v23cc.k2*mcgen::sel( v23cc.i2, v22_cvs1, v22_ccs1 );
+  const mcgen::val v24 = { v23.l - v20.u, v23.u - v20.l, v23.cv - v20.cc, v23.cc - v20.cv };
+  const double v24_cvs0 = v23_cvs0 - v20_ccs0, v24_ccs0 = v23_ccs0 - v20_cvs0;
+  const double v24_cvs1 = v23_cvs1 - v20_ccs1, v24_ccs1 = v23_ccs1 - v20_cvs1;
+  const mcgen::val v25 = { v15.l + v24.l, v15.u + v24.u, v15.cv + v24.cv, v15.cc + v24.cc };
+  const double v25_cvs0 = v15_cvs0 + v24_cvs0, v25_ccs0 = v15_ccs0 + v24_ccs0;
+  const double v25_cvs1 = v15_cvs1 + v24_cvs1, v25_ccs1 = v15_ccs1 + v24_ccs1;
+  const mcgen::val v26 = { v11.l + v25.l, v11.u + v25.u, v11.cv + v25.cv, v11.cc + v25.cc };
+  const double v26_cvs0 = v11_cvs0 + v25_cvs0, v26_ccs0 = v11_ccs0 + v25_ccs0;
+  const double v26_cvs1 = v25_cvs1, v26_ccs1 = v25_ccs1;
+  const mcgen::val v27 = { v26.l - v10.u, v26.u - v10.l, v26.cv - v10.cc, v26.cc - v10.cv };
+  const double v27_cvs0 = v26_cvs0 - v10_ccs0, v27_ccs0 = v26_ccs0 - v10_cvs0;
+  const double v27_cvs1 = v26_cvs1 - v10_ccs1, v27_ccs1 = v26_ccs1 - v10_cvs1;
+  const mcgen::val v28 = { v8.l + v27.l, v8.u + v27.u, v8.cv + v27.cv, v8.cc + v27.cc };
+  const double v28_cvs0 = v27_cvs0, v28_ccs0 = v27_ccs0;
+  const double v28_cvs1 = v8_cvs1 + v27_cvs1, v28_ccs1 = v8_ccs1 + v27_ccs1;
+  const mcgen::val v29 = { v28.l - v7.u, v28.u - v7.l, v28.cv - v7.cc, v28.cc - v7.cv };
+  const double v29_cvs0 = v28_cvs0 - v7_ccs0, v29_ccs0 = v28_ccs0 - v7_cvs0;
+  const double v29_cvs1 = v28_cvs1, v29_ccs1 = v28_ccs1;
+  const mcgen::val v30 = { v5.l + v29.l, v5.u + v29.u, v5.cv + v29.cv, v5.cc + v29.cc };
+  const double v30_cvs0 = v5_cvs0 + v29_cvs0, v30_ccs0 = v5_ccs0 + v29_ccs0;
+  const double v30_cvs1 = v29_cvs1, v30_ccs1 = v29_ccs1;
+  const mcgen::val v31 = { v3.l + v30.l, v3.u + v30.u, v3.cv + v30.cv, v3.cc + v30.cc };
+  const double v31_cvs0 = v3_cvs0 + v30_cvs0, v31_ccs0 = v3_ccs0 + v30_ccs0;
+  const double v31_cvs1 = v30_cvs1, v31_ccs1 = v30_ccs1;
+  const mcgen::val v32 = { 0.25*v1.l, 0.25*v1.u, 0.25*v1.cv, 0.25*v1.cc };
+  const double v32_cvs1 = 0.25*1., v32_ccs1 = 0.25*1.;
+  const mcgen::val v33 = { 3.*v0.l, 3.*v0.u, 3.*v0.cv, 3.*v0.cc };
+  const double v33_cvs0 = 3.*1., v33_ccs0 = 3.*1.;
+  const mcgen::val v34 = { v33.l - v32.u, v33.u - v32.l, v33.cv - v32.cc, v33.cc - v32.cv };
+  const double v34_cvs0 = v33_cvs0, v34_ccs0 = v33_ccs0;
+  const double v34_cvs1 = -v32_ccs1, v34_ccs1 = -v32_cvs1;
+  fL[0] = v31.l; fU[0] = v31.u; fcv[0] = v31.cv; fcc[0] = v31.cc;
+  fcvsub[0] = v31_cvs0; fccsub[0] = v31_ccs0;
+  fcvsub[1] = v31_cvs1; fccsub[1] = v31_ccs1;
+  fL[1] = v34.l; fU[1] = v34.u; fcv[1] = v34.cv; fcc[1] = v34.cc;
+  fcvsub[2] = v34_cvs0; fccsub[2] = v34_ccs0;
+  fcvsub[3] = v34_cvs1; fccsub[3] = v34_ccs1;
+  return 0;
+}
@@ -0,0 +1,127 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__FFCODEGEN_TEST_HPP
+#define MC__FFCODEGEN_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "mccormick.hpp"
+#include "ffunc.hpp"
+#include "ffcodegen.hpp"
+
+struct CGfct{ template <typename U> U operator()( const U&x, const U&y ) const
+  { return x*y*exp(x) - 2.*sqr(y)/(1.+sqr(x)) + sqrt(x+2.)*log(3.-y) + xlog(x+1.)
+         - fabs(x-y) + pow(y,4) - pow(x-0.5,3) + 1./(x+1.) + pow(x+2.,-2); } };
+
+// Code of the function cgfct generated by mc::FFCodeGen for CGfct and 3*x-y/4
+#include "ffcodegen_fct.hpp"
+
+namespace mc
+{
+//! @brief C++ class for test of mc::FFCodeGen class using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! FFCodeGenTest is a C++ class for testing the source code generated
+//! by mc::FFCodeGen for the McCormick relaxations of a factorable
+//! function, against mc::McCormick, using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class FFCodeGenTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( FFCodeGenTest );
+CPPUNIT_TEST( testRelaxation );
+CPPUNIT_TEST( testDomain );
+CPPUNIT_TEST( testSource );
+CPPUNIT_TEST_EXCEPTION( testUndefined, mc::FFGraph::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef McCormick<Interval> MCI;
+
+  FFGraph DAG;
+  FFVar X[2], F[2];
+
+  bool Eq( const double x1, const double x2 ) const
+  {
+    return isequal( x1, x2, 1e2*machprec(), 1e2*machprec() );
+  }
+
+public:
+
+  void setUp(){
+    DAG.clear();
+    X[0] = DAG.var(); X[1] = DAG.var();
+    F[0] = CGfct()( X[0], X[1] );
+    F[1] = 3.*X[0] - X[1]/4.;
+    MCI::options = MCI::Options();
+    MCI::options.ENVEL_USE = false;
+  }
+
+  void tearDown(){
+    MCI::options = MCI::Options();
+  }
+
+  void testRelaxation(){
+    // Same bounds, relaxations and subgradients as mc::McCormick on boxes of various sizes and signs
+    const unsigned int NS = 10;
+    for( unsigned int k=0; k<NS*NS; k++ ){
+      const double xL[2] = { -0.9+1.2*(k%NS)/NS, -1.5+3.*(k/NS)/NS };
+      const double xU[2] = { xL[0]+0.1+0.2*(k%3), xL[1]+0.1+0.3*(k%4) };
+      const double xref[2] = { xL[0]+0.3*(xU[0]-xL[0]), xL[1]+0.8*(xU[1]-xL[1]) };
+      double fL[2], fU[2], fcv[2], fcc[2], fcvsub[4], fccsub[4];
+      CPPUNIT_ASSERT( !cgfct( xL, xU, xref, fL, fU, fcv, fcc, fcvsub, fccsub ) );
+
+      const MCI MX[2] = { MCI( Interval( xL[0], xU[0] ), xref[0] ).sub( 2, 0 ),
+                          MCI( Interval( xL[1], xU[1] ), xref[1] ).sub( 2, 1 ) };
+      const MCI MF[2] = { CGfct()( MX[0], MX[1] ), 3.*MX[0] - MX[1]/4. };
+      for( unsigned int j=0; j<2; j++ ){
+        CPPUNIT_ASSERT( Eq( fL[j], MF[j].l() ) && Eq( fU[j], MF[j].u() ) );
+        CPPUNIT_ASSERT( Eq( fcv[j], MF[j].cv() ) && Eq( fcc[j], MF[j].cc() ) );
+        for( unsigned int i=0; i<2; i++ )
+          CPPUNIT_ASSERT( Eq( fcvsub[j*2+i], MF[j].cvsub(i) ) && Eq( fccsub[j*2+i], MF[j].ccsub(i) ) );
+      }
+    }
+  }
+
+  void testDomain(){
+    // Logarithm of a range with nonpositive values: error code of mc::McCormick
+    const double xL[2] = { 0., 2. }, xU[2] = { 1., 4. }, xref[2] = { 0.5, 3. };
+    double fL[2], fU[2], fcv[2], fcc[2], fcvsub[4], fccsub[4];
+    CPPUNIT_ASSERT( cgfct( xL, xU, xref, fL, fU, fcv, fcc, fcvsub, fccsub ) == MCI::Exceptions::LOG );
+  }
+
+  void testSource(){
+    // The code included above is the one generated by the current version of mc::FFCodeGen
+    FFCodeGen gen( DAG, 2, F, 2, X );
+    std::ostringstream os;
+    gen.mccormick( os, "cgfct" );
+    std::string path( __FILE__ );
+    path = path.substr( 0, path.find_last_of( "/\\" )+1 ) + "ffcodegen_fct.hpp";
+    std::ifstream is( path.c_str() );
+    CPPUNIT_ASSERT( is.good() );
+    std::ostringstream ref;
+    ref << is.rdbuf();
+    CPPUNIT_ASSERT( os.str() == ref.str() );
+  }
+
+  void testUndefined(){
+    // The following lines should throw an instance of mc::FFGraph::Exceptions
+    const FFVar G = sin( X[0] ) + X[1];
+    FFCodeGen gen( DAG, 1, &G, 2, X );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::FFCodeGenTest );
+
+} // end namespace mc
+
+#endif
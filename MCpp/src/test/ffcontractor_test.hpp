@@ -0,0 +1,152 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__FFCONTRACTOR_TEST_HPP
+#define MC__FFCONTRACTOR_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <limits>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "ffunc.hpp"
+#include "ffcontractor.hpp"
+
+namespace mc
+{
+//! @brief C++ class for test of mc::FFContractor class using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! FFContractorTest is a C++ class for testing the reduction of boxes
+//! by forward-backward constraint propagation with mc::FFContractor in
+//! interval arithmetic, using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class FFContractorTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( FFContractorTest );
+CPPUNIT_TEST( testDisk );
+CPPUNIT_TEST( testProduct );
+CPPUNIT_TEST( testExpression );
+CPPUNIT_TEST( testInfeasible );
+CPPUNIT_TEST( testFixpoint );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef FFContractor<Interval> HC4;
+
+  FFGraph DAG;
+  FFVar X[3];
+  //! @brief Infinite bound of the one-sided constraints
+  double INF;
+
+  bool Eq( const Interval&I1, const Interval&I2 ) const
+  {
+    return isequal( I1.l(), I2.l(), 1e3*machprec(), 1e3*machprec() )
+        && isequal( I1.u(), I2.u(), 1e3*machprec(), 1e3*machprec() );
+  }
+
+public:
+
+  void setUp(){
+    DAG.clear();
+    for( unsigned int i=0; i<3; i++ ) X[i] = DAG.var();
+    INF = std::numeric_limits<double>::infinity();
+  }
+
+  void tearDown(){}
+
+  void testDisk(){
+    // Projections through squares and sums, with either queue policy
+    const FFVar G[2] = { sqr(X[0])+sqr(X[1]), exp(X[0])-X[1] };
+    HC4 CP( DAG, 2, G, 2, X );
+    const Interval C[2] = { Interval( -INF, 1. ), Interval( -INF, 0. ) };
+    Interval IX[2] = { Interval( -10., 10. ), Interval( -10., 10. ) };
+    CPPUNIT_ASSERT( CP.contract( IX, C ) );
+    CPPUNIT_ASSERT( IX[0].l() >= -1.-1e-12 && IX[0].u() <= 0.+1e-12 );
+    CPPUNIT_ASSERT( IX[1].l() >= std::exp(-1.)-1e-12 && IX[1].u() <= 1.+1e-12 );
+    CPPUNIT_ASSERT( CP.nrev() <= CP.options.MAXREV*2 );
+
+    Interval IY[2] = { Interval( -10., 10. ), Interval( -10., 10. ) };
+    CP.options.QUEUE = HC4::Options::LIFO;
+    CPPUNIT_ASSERT( CP.contract( IY, C ) );
+    CPPUNIT_ASSERT( IY[0].l() >= -1.-1e-12 && IY[0].u() <= 0.+1e-12 );
+  }
+
+  void testProduct(){
+    // x*y = 1 and x-y = 0 with x,y in [0.5,4]: hull consistency reached with [0.5,2] for both variables
+    const FFVar G[2] = { X[0]*X[1], X[0]-X[1] };
+    HC4 CP( DAG, 2, G, 2, X );
+    CP.options.RTOL = 0.;
+    CP.options.MAXREV = 100;
+    const Interval C[2] = { Interval( 1. ), Interval( 0. ) };
+    Interval IX[2] = { Interval( 0.5, 4. ), Interval( 0.5, 4. ) };
+    CPPUNIT_ASSERT( CP.contract( IX, C ) );
+    CPPUNIT_ASSERT( Eq( IX[0], Interval( 0.5, 2. ) ) && Eq( IX[1], Interval( 0.5, 2. ) ) );
+  }
+
+  void testExpression(){
+    // Reduced box contains all the feasible points on a grid, including those on its boundary
+    const FFVar G[2] = { X[0]*exp(X[1]) + pow(X[2],3) - log(X[0]+2.), sqrt(X[2]+1.) - X[0]/(1.+sqr(X[1])) };
+    HC4 CP( DAG, 2, G, 3, X );
+    CP.options.RTOL = 1e-3;
+    const Interval X0[3] = { Interval( -1., 2. ), Interval( -1., 1. ), Interval( -0.5, 1.5 ) };
+    const Interval C[2] = { Interval( -0.5, 0.5 ), Interval( -INF, 0. ) };
+    Interval IX[3] = { X0[0], X0[1], X0[2] };
+    { Interval::Verified scope;
+      CPPUNIT_ASSERT( CP.contract( IX, C ) ); }
+    CPPUNIT_ASSERT( diam(IX[0])+diam(IX[1])+diam(IX[2]) < diam(X0[0])+diam(X0[1])+diam(X0[2]) );
+
+    FFProgram prog( DAG, 2, G, 3, X );
+    const unsigned int NS = 16;
+    for( unsigned int i=0; i<=NS; i++ )
+      for( unsigned int j=0; j<=NS; j++ )
+        for( unsigned int k=0; k<=NS; k++ ){
+          const double x[3] = { X0[0].l()+diam(X0[0])*i/NS, X0[1].l()+diam(X0[1])*j/NS, X0[2].l()+diam(X0[2])*k/NS };
+          double g[2] = { 0., 0. };
+          prog.eval( x, g );
+          if( g[0] < C[0].l() || g[0] > C[0].u() || g[1] > C[1].u() ) continue;
+          for( unsigned int l=0; l<3; l++ )
+            CPPUNIT_ASSERT( x[l] >= IX[l].l() && x[l] <= IX[l].u() );
+        }
+  }
+
+  void testInfeasible(){
+    // Infeasibility detected in the first revision
+    const FFVar G = sqr(X[0]) + 1.;
+    HC4 CP( DAG, 1, &G, 1, X );
+    const Interval C( -INF, 0. );
+    Interval IX( -2., 3. );
+    CPPUNIT_ASSERT( !CP.contract( &IX, &C ) && CP.nrev() == 1 );
+  }
+
+  void testFixpoint(){
+    // x = y and y = x/2 with x in [1,10]: infeasibility detected after several revisions,
+    // unless the cutoff on relative improvement stops the propagation first
+    const FFVar G[2] = { X[0]-X[1], X[1]-0.5*X[0] };
+    HC4 CP( DAG, 2, G, 2, X );
+    const Interval C[2] = { Interval( 0. ), Interval( 0. ) };
+    Interval IX[2] = { Interval( 1., 10. ), Interval( -INF, INF ) };
+    CPPUNIT_ASSERT( !CP.contract( IX, C ) && CP.nrev() > 2 );
+
+    CP.options.RTOL = 0.6;
+    Interval IY[2] = { Interval( 1., 10. ), Interval( -INF, INF ) };
+    CPPUNIT_ASSERT( CP.contract( IY, C ) && CP.nrev() == 2 );
+    CPPUNIT_ASSERT( Eq( IY[0], Interval( 2., 10. ) ) && Eq( IY[1], Interval( 1., 5. ) ) );
+
+    CP.options.RTOL = 0.;
+    CP.options.MAXREV = 1;
+    Interval IZ[2] = { Interval( 1., 10. ), Interval( -INF, INF ) };
+    CPPUNIT_ASSERT( CP.contract( IZ, C ) && CP.nrev() == 2 );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::FFContractorTest );
+
+} // end namespace mc
+
+#endif
@@ -0,0 +1,323 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__FFUNC_TEST_HPP
+#define MC__FFUNC_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "mccormick.hpp"
+#include "tmodel.hpp"
+#include "affine.hpp"
+#include "ffunc.hpp"
+
+struct FFfct{ template <typename U> U operator()( const U&x, const U&y ) const
+  { return x*y*exp(x) - 2.*sqr(y)/(1.+sqr(x)) + sqrt(x+2.)*log(3.-y) - pow(x-y,3)
+         + sin(x*y)/(y-2.) + atan(y)*x; } };
+
+struct FFfct2{ template <typename U> U operator()( const U&x, const U&y ) const
+  { return xlog(x+1.) + max(x,y)*cos(y) - min(x,y+0.2) + erf(y)*fabs(x-y)
+         + arh(x+1.,0.5) + pow(y,4)/(2.+inv(x+1.)); } };
+
+namespace mc
+{
+//! @brief C++ class for test of mc::FFGraph and mc::FFProgram classes using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! FFGraphTest is a C++ class for testing the recording of factorable
+//! functions in mc::FFGraph and their evaluation with mc::FFProgram in
+//! the real, interval, McCormick, Taylor model and affine arithmetics,
+//! against the direct evaluation of these functions, using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class FFGraphTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( FFGraphTest );
+CPPUNIT_TEST( testInterval );
+CPPUNIT_TEST( testPoint );
+CPPUNIT_TEST( testMcCormick );
+CPPUNIT_TEST( testArh );
+CPPUNIT_TEST( testTModel );
+CPPUNIT_TEST( testAffine );
+CPPUNIT_TEST( testProgram );
+CPPUNIT_TEST( testCSE );
+CPPUNIT_TEST( testFold );
+CPPUNIT_TEST( testSlots );
+CPPUNIT_TEST( testLevels );
+CPPUNIT_TEST_EXCEPTION( testGraphs, mc::FFGraph::Exceptions );
+CPPUNIT_TEST_EXCEPTION( testMissingVar, mc::FFGraph::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  const Interval X0, Y0;
+
+  FFGraph DAG;
+  FFVar X[2], F[2];
+
+  bool Eq( const double x1, const double x2 ) const
+  {
+    return isequal( x1, x2, 1e2*machprec(), 1e2*machprec() );
+  }
+
+  bool Eq( const Interval&I1, const Interval&I2 ) const
+  {
+    return Eq( I1.l(), I2.l() ) && Eq( I1.u(), I2.u() );
+  }
+
+public:
+
+  FFGraphTest():
+    X0( 0.2, 0.7 ), Y0( -0.3, 0.1 )
+    {}
+
+  void setUp(){
+    DAG.clear();
+    DAG.options = FFGraph::Options();
+    X[0] = DAG.var(); X[1] = DAG.var();
+    F[0] = FFfct()( X[0], X[1] );
+    F[1] = FFfct2()( X[0], X[1] );
+  }
+
+  void tearDown(){}
+
+  void testInterval(){
+    const FFProgram prog( DAG, 2, F, 2, X );
+    const Interval IX[2] = { X0, Y0 };
+    Interval IF[2];
+    prog.eval( IX, IF );
+    CPPUNIT_ASSERT( Eq( IF[0], FFfct()( X0, Y0 ) ) );
+    CPPUNIT_ASSERT( Eq( IF[1], FFfct2()( X0, Y0 ) ) );
+  }
+
+  void testPoint(){
+    // Real arithmetic, against interval arithmetic with degenerate intervals
+    const FFProgram prog( DAG, 2, F, 2, X );
+    std::vector<double> work;
+    for( unsigned int i=0; i<5; i++ ){
+      const double x[2] = { X0.l()+0.1*i, Y0.l()+0.1*i };
+      double f[2];
+      prog.eval( x, f, work );
+      CPPUNIT_ASSERT( Eq( f[0], FFfct()( Interval( x[0] ), Interval( x[1] ) ).l() ) );
+      CPPUNIT_ASSERT( Eq( f[1], FFfct2()( Interval( x[0] ), Interval( x[1] ) ).l() ) );
+    }
+  }
+
+  void testMcCormick(){
+    typedef McCormick<Interval> MCI;
+    MCI::options.MVCOMP_USE = false;
+    const FFProgram prog( DAG, 2, F, 2, X );
+    const MCI MX[2] = { MCI( X0, 0.4 ).sub( 2, 0 ), MCI( Y0, -0.1 ).sub( 2, 1 ) };
+    MCI MF[2];
+    std::vector<MCI> work;
+    prog.eval( MX, MF, work );
+    const MCI MF0[2] = { FFfct()( MX[0], MX[1] ), FFfct2()( MX[0], MX[1] ) };
+    for( unsigned int k=0; k<2; k++ ){
+      CPPUNIT_ASSERT( Eq( MF[k].cv(), MF0[k].cv() ) && Eq( MF[k].cc(), MF0[k].cc() ) );
+      CPPUNIT_ASSERT( Eq( MF[k].cvsub(0), MF0[k].cvsub(0) ) && Eq( MF[k].ccsub(1), MF0[k].ccsub(1) ) );
+      CPPUNIT_ASSERT( Eq( MF[k].I(), MF0[k].I() ) );
+    }
+  }
+
+  void testArh(){
+    // Range straddling the inflection point 0.5*k of arh(x,k)=exp(-k/x)
+    typedef McCormick<Interval> MCI;
+    const double k = 2.;
+    const FFVar G = arh( X[0], k );
+    const FFProgram prog( DAG, 1, &G, 1, X );
+    const Interval XI( 0.5, 2. );
+    for( unsigned int i=0; i<=4; i++ ){
+      const double xref = 0.5 + 0.375*i;
+      const MCI MX = MCI( XI, xref ).sub( 1, 0 );
+      MCI MG;
+      prog.eval( &MX, &MG );
+      const MCI MG0 = arh( MX, k );
+      CPPUNIT_ASSERT( Eq( MG.cv(), MG0.cv() ) && Eq( MG.cc(), MG0.cc() ) );
+      CPPUNIT_ASSERT( Eq( MG.cvsub(0), MG0.cvsub(0) ) && Eq( MG.ccsub(0), MG0.ccsub(0) ) );
+      const double g = std::exp( -k/xref );
+      CPPUNIT_ASSERT( MG.cv() <= g+1e3*machprec() && g <= MG.cc()+1e3*machprec() );
+      CPPUNIT_ASSERT( MG.l() <= g && g <= MG.u() );
+    }
+  }
+
+  void testTModel(){
+    TModel<Interval> TM( 2, 3 );
+    const FFProgram prog( DAG, 1, F, 2, X );
+    const TVar<Interval> TX[2] = { TVar<Interval>( &TM, 0, X0 ), TVar<Interval>( &TM, 1, Y0 ) };
+    TVar<Interval> TF;
+    prog.eval( TX, &TF );
+    const TVar<Interval> TF0 = FFfct()( TX[0], TX[1] );
+    CPPUNIT_ASSERT( Eq( TF.B(), TF0.B() ) );
+    CPPUNIT_ASSERT( Eq( TF.R(), TF0.R() ) );
+  }
+
+  void testAffine(){
+    const FFProgram prog( DAG, 1, F, 2, X );
+    const Affine AX[2] = { Affine( X0 ), Affine( Y0 ) };
+    Affine AF;
+    prog.eval( AX, &AF );
+    const Affine AF0 = FFfct()( AX[0], AX[1] );
+    CPPUNIT_ASSERT( Eq( AF.I(), AF0.I() ) );
+  }
+
+  void testProgram(){
+    // Only the nodes needed by the dependents are compiled, once for the subexpressions they share,
+    // and repeated evaluations keep the workspace
+    const FFProgram prog0( DAG, 1, F, 2, X ), prog1( DAG, 1, F+1, 2, X );
+    CPPUNIT_ASSERT( prog0.size() < DAG.size()-2 && prog1.size() < DAG.size()-2 );
+    const FFProgram prog( DAG, 2, F, 2, X );
+    CPPUNIT_ASSERT( prog.size() < prog0.size()+prog1.size() && prog.nslot() < 2+prog.size() );
+    std::vector<Interval> work;
+    const Interval IX[2] = { X0, Y0 };
+    Interval IF[2];
+    prog.eval( IX, IF, work );
+    const Interval* data = &work[0];
+    CPPUNIT_ASSERT( work.size() == prog.nslot() );
+    prog.eval( IX, IF, work );
+    CPPUNIT_ASSERT( &work[0] == data && work.size() == prog.nslot() );
+
+    // Passive constants and independent variables as dependents, and independents in any order
+    const FFVar G[4] = { 3., X[0], X[0]*X[1], min( 4., X[0] ) };
+    const FFVar Z[2] = { X[1], X[0] };
+    const FFProgram progG( DAG, 4, G, 2, Z );
+    const double z[2] = { 2., 5. };
+    double g[4];
+    progG.eval( z, g );
+    CPPUNIT_ASSERT( progG.size() == 4 && g[0] == 3. && g[1] == 5. && g[2] == 10. && g[3] == 4. );
+  }
+
+  void testCSE(){
+    // Shared Arrhenius term and commuted operands recorded once, with the same values as without merging
+    FFGraph DAG2;
+    DAG2.options.CSE = false;
+    const FFVar T = DAG.var(), T2 = DAG2.var();
+    const FFVar G[3] = { X[0]*exp(-2.5/(8.314*T)), exp(-2.5/(8.314*T))*X[1], X[1]*X[0] - X[0]*X[1] };
+    CPPUNIT_ASSERT( G[1].index() == DAG.size()-1 && G[2].dag() == 0 && G[2].cst() == 0. );
+    const FFVar Y[2] = { DAG2.var(), DAG2.var() };
+    const FFVar G2[2] = { Y[0]*exp(-2.5/(8.314*T2)), exp(-2.5/(8.314*T2))*Y[1] };
+    const FFVar V[3] = { X[0], X[1], T }, V2[3] = { T2, Y[0], Y[1] };
+    const FFProgram prog( DAG, 2, G, 3, V ), prog2( DAG2, 2, G2, 3, V2 );
+    CPPUNIT_ASSERT( prog.size() == 5 && prog2.size() == 8 );
+
+    typedef McCormick<Interval> MCI;
+    MCI::options.MVCOMP_USE = false;
+    const MCI MV[3] = { MCI( X0, 0.4 ).sub( 3, 0 ), MCI( Y0, -0.1 ).sub( 3, 1 ), MCI( Interval( 300., 400. ), 350. ).sub( 3, 2 ) };
+    const MCI MV2[3] = { MV[2], MV[0], MV[1] };
+    MCI MG[2], MG2[2];
+    prog.eval( MV, MG );
+    prog2.eval( MV2, MG2 );
+    for( unsigned int k=0; k<2; k++ ){
+      CPPUNIT_ASSERT( Eq( MG[k].cv(), MG2[k].cv() ) && Eq( MG[k].cc(), MG2[k].cc() ) );
+      CPPUNIT_ASSERT( Eq( MG[k].I(), MG2[k].I() ) );
+    }
+  }
+
+  void testFold(){
+    // Operations with a known result are not recorded, unless folding is disabled
+    const unsigned int n = DAG.size();
+    CPPUNIT_ASSERT( (X[0]+0.).index() == X[0].index() && (1.*X[0]).index() == X[0].index() );
+    CPPUNIT_ASSERT( (X[0]/1.).index() == X[0].index() && (-(-X[0])).index() == X[0].index() );
+    CPPUNIT_ASSERT( max(X[0],X[0]).index() == X[0].index() && (0.*X[1]).dag() == 0 );
+    CPPUNIT_ASSERT( DAG.size() == n+1 );
+    DAG.options.FOLD = false;
+    CPPUNIT_ASSERT( (X[0]+0.).index() == n+1 && (0.*X[1]).index() == n+2 );
+  }
+
+  void testSlots(){
+    // Long sum of products evaluated in a handful of slots, with the same Taylor models as without reuse
+    const unsigned int NX = 10, NT = 200;
+    FFGraph DAG2;
+    std::vector<FFVar> Z( NX );
+    for( unsigned int i=0; i<NX; i++ ) Z[i] = DAG2.var();
+    FFVar S = 0.;
+    for( unsigned int k=0; k<NT; k++ )
+      S += exp( Z[k%NX]/(k+1.) ) * Z[(3*k+1)%NX];
+    FFProgram prog( DAG2, 1, &S, NX, &Z[0] ), prog0;
+    prog0.options.REUSE_SLOTS = false;
+    prog0.compile( DAG2, 1, &S, NX, &Z[0] );
+    CPPUNIT_ASSERT( prog.size() == prog0.size() && prog0.nslot() == NX+prog0.size() );
+    CPPUNIT_ASSERT( prog.nslot() <= NX+3 );
+
+    TModel<Interval> TM( NX, 5 );
+    std::vector< TVar<Interval> > TZ( NX ), work;
+    for( unsigned int i=0; i<NX; i++ ) TZ[i] = TVar<Interval>( &TM, i, Interval( -0.1*i, 0.5 ) );
+    TVar<Interval> TS, TS0;
+    prog.eval( &TZ[0], &TS, work );
+    prog0.eval( &TZ[0], &TS0 );
+    CPPUNIT_ASSERT( work.size() == prog.nslot() );
+    CPPUNIT_ASSERT( Eq( TS.B(), TS0.B() ) && Eq( TS.R(), TS0.R() ) );
+  }
+
+  void testLevels(){
+    // Wide graph evaluated by level, with the same bounds and relaxations as the sequential evaluation
+    const unsigned int NX = 10, NF = 100;
+    FFGraph DAG2;
+    std::vector<FFVar> Z( NX ), G( NF );
+    for( unsigned int i=0; i<NX; i++ ) Z[i] = DAG2.var();
+    for( unsigned int k=0; k<NF; k++ )
+      G[k] = exp( Z[k%NX]/(k+1.) ) * Z[(3*k+1)%NX] - sqr( Z[(7*k+2)%NX]+k );
+    FFProgram prog( DAG2, NF, &G[0], NX, &Z[0] ), progL;
+    progL.options.LEVEL_SCHEDULE = true;
+    progL.options.NTHREADS = 4;
+    progL.options.MINWIDTH = 8;
+    progL.compile( DAG2, NF, &G[0], NX, &Z[0] );
+    CPPUNIT_ASSERT( prog.nlevel() == 0 && progL.nlevel() == 4 && progL.size() == prog.size() );
+
+    typedef McCormick<Interval> MCI;
+    std::vector<MCI> MZ( NX ), MG( NF ), MGL( NF );
+    for( unsigned int i=0; i<NX; i++ )
+      MZ[i] = MCI( Interval( -0.1*i, 0.5 ), 0.2 ).sub( NX, i );
+    prog.eval( &MZ[0], &MG[0] );
+    progL.eval( &MZ[0], &MGL[0] );
+    for( unsigned int k=0; k<NF; k++ ){
+      CPPUNIT_ASSERT( MG[k].l() == MGL[k].l() && MG[k].u() == MGL[k].u() );
+      CPPUNIT_ASSERT( MG[k].cv() == MGL[k].cv() && MG[k].cc() == MGL[k].cc() );
+      for( unsigned int i=0; i<NX; i++ )
+        CPPUNIT_ASSERT( MG[k].cvsub(i) == MGL[k].cvsub(i) && MG[k].ccsub(i) == MGL[k].ccsub(i) );
+    }
+
+    // Taylor models, sharing the work arrays of their environment, evaluated sequentially
+    CPPUNIT_ASSERT( FFThreadSafe<MCI>::value && !FFThreadSafe< TVar<Interval> >::value );
+    CPPUNIT_ASSERT( !FFThreadSafe< McCormick< TVar<Interval> > >::value );
+    TModel<Interval> TM( NX, 2 );
+    std::vector< TVar<Interval> > TZ( NX ), TG( NF ), TGL( NF );
+    for( unsigned int i=0; i<NX; i++ )
+      TZ[i] = TVar<Interval>( &TM, i, Interval( -0.1*i, 0.5 ) );
+    prog.eval( &TZ[0], &TG[0] );
+    progL.eval( &TZ[0], &TGL[0] );
+    for( unsigned int k=0; k<NF; k++ )
+      CPPUNIT_ASSERT( Eq( TG[k].B(), TGL[k].B() ) && Eq( TG[k].R(), TGL[k].R() ) );
+
+    // Exceptions of the arithmetic thrown in the calling thread
+    std::vector<Interval> IZ( NX, Interval( -1., 1. ) ), IG( NF, Interval( 0. ) );
+    FFVar L = log( Z[0] );
+    progL.compile( DAG2, 1, &L, NX, &Z[0] );
+    bool thrown = false;
+    try{ progL.eval( &IZ[0], &IG[0] ); }
+    catch( Interval::Exceptions& ){ thrown = true; }
+    CPPUNIT_ASSERT( thrown );
+  }
+
+  void testGraphs(){
+    // The following line should throw an instance of mc::FFGraph::Exceptions
+    FFGraph DAG2;
+    X[0] + DAG2.var();
+  }
+
+  void testMissingVar(){
+    // The following line should throw an instance of mc::FFGraph::Exceptions
+    FFProgram( DAG, 1, F, 1, X );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::FFGraphTest );
+
+} // end namespace mc
+
+#endif
@@ -0,0 +1,176 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__HESSPATTERN_TEST_HPP
+#define MC__HESSPATTERN_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "specbnd.hpp"
+#include "mcfadbad.hpp"
+#include "hesspattern.hpp"
+
+namespace mc
+{
+//! @brief C++ class for test of mc::HessPattern / mc::HessColoring classes using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! HessPatternTest is a C++ class for testing the Hessian sparsity
+//! detection class mc::HessPattern and the coloring class
+//! mc::HessColoring using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class HessPatternTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( HessPatternTest );
+CPPUNIT_TEST( testPattern );
+CPPUNIT_TEST( testColoring );
+CPPUNIT_TEST( testCompressed );
+CPPUNIT_TEST_EXCEPTION( testSize, HessPattern::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef fadbad::F<Interval> FI;
+  typedef fadbad::F<FI> FFI;
+  typedef fadbad::B<FI> BFI;
+  typedef HessPattern::t_entry t_entry;
+
+  bool Eq( const double&D1, const double&D2,
+           const double atol=1e2*machprec(), const double rtol=1e2*machprec() ) const
+  {
+    return isequal( D1, D2, atol, rtol );
+  }
+
+  //! @brief Arrow-shaped test function, with x0 interacting with all variables
+  template <typename U> static U arrow( const unsigned int n, const U*x )
+  {
+    U f = 0.;
+    for( unsigned int i=1; i<n; i++ ) f += sqr( x[i] - x[0] ) + sin( x[i-1]*x[i] );
+    return f;
+  }
+
+  //! @brief Check that the coloring of <tt>P</tt> is a star coloring
+  bool Star( const HessPattern&P, const HessColoring&HC ) const
+  {
+    const unsigned int n = P.dep();
+    std::vector< std::set<unsigned int> > adj( n );
+    std::set<t_entry>::const_iterator it = P.hess().begin();
+    for( ; it != P.hess().end(); ++it ){
+      if( it->first == it->second ) continue;
+      adj[it->first].insert( it->second );
+      adj[it->second].insert( it->first );
+    }
+    // Paths a-b-c-d must use at least three colors
+    for( unsigned int b=0; b<n; b++ )
+      for( std::set<unsigned int>::const_iterator ia=adj[b].begin(); ia!=adj[b].end(); ++ia ){
+        if( HC.color(*ia) == HC.color(b) ) return false;
+        for( std::set<unsigned int>::const_iterator ic=adj[b].begin(); ic!=adj[b].end(); ++ic ){
+          if( *ic == *ia ) continue;
+          for( std::set<unsigned int>::const_iterator id=adj[*ic].begin(); id!=adj[*ic].end(); ++id ){
+            if( *id == b || *id == *ia ) continue;
+            if( HC.color(*ia) == HC.color(*ic) && HC.color(b) == HC.color(*id) ) return false;
+          }
+        }
+      }
+    return true;
+  }
+
+public:
+
+  void setUp(){}
+
+  void tearDown(){}
+
+  void testPattern(){
+    HessPattern X[4], F;
+    for( unsigned int i=0; i<4; i++ ) X[i].set( i, 4 );
+    F = exp( X[0]*X[1] ) + 2.*X[2] - pow( X[3], 2 );
+    CPPUNIT_ASSERT( F.grad().size() == 4 );
+    CPPUNIT_ASSERT( F.hess().size() == 4 );
+    CPPUNIT_ASSERT( F.hess().count( t_entry(0,0) ) && F.hess().count( t_entry(0,1) )
+                 && F.hess().count( t_entry(1,1) ) && F.hess().count( t_entry(3,3) ) );
+
+    // Bilinear term without diagonal entries
+    F = X[0]*X[1] + X[2]/3.;
+    CPPUNIT_ASSERT( F.hess().size() == 1 && F.hess().count( t_entry(0,1) ) );
+  }
+
+  void testColoring(){
+    // Tridiagonal pattern needs three colors
+    const unsigned int NX = 50;
+    HessPattern X[NX], F = 0.;
+    for( unsigned int i=0; i<NX; i++ ) X[i].set( i, NX );
+    for( unsigned int i=0; i<NX-1; i++ ) F += exp( X[i]*X[i+1] );
+    HessColoring HC( F );
+    CPPUNIT_ASSERT( HC.ncolor() == 3 );
+    CPPUNIT_ASSERT( HC.nnz() == 2*NX-1 );
+    CPPUNIT_ASSERT( Star( F, HC ) );
+
+    // Arrow pattern with tridiagonal part
+    F = arrow( NX, X );
+    HessColoring HC2( F );
+    CPPUNIT_ASSERT( HC2.ncolor() <= 4 );
+    CPPUNIT_ASSERT( Star( F, HC2 ) );
+  }
+
+  void testCompressed(){
+    const unsigned int NX = 8;
+    Interval X[NX];
+    for( unsigned int i=0; i<NX; i++ ) X[i] = Interval( -0.5+0.1*i, 0.2*i );
+    HessPattern PX[NX];
+    for( unsigned int i=0; i<NX; i++ ) PX[i].set( i, NX );
+    HessColoring HC( arrow( NX, PX ) );
+
+    // Full and compressed interval Hessians, forward-forward
+    FFI FFX[NX], FFXC[NX];
+    for( unsigned int i=0; i<NX; i++ ){
+      FI FX = X[i]; FX.diff( i, NX );
+      FFX[i] = FX; FFX[i].diff( i, NX );
+      FI FXC = X[i]; FXC.diff( HC.color(i), HC.ncolor() );
+      FFXC[i] = FXC; FFXC[i].diff( i, NX );
+    }
+    FFI FFF = arrow( NX, FFX ), FFFC = arrow( NX, FFXC );
+
+    // Compressed interval Hessian, forward-reverse
+    BFI BFXC[NX];
+    for( unsigned int i=0; i<NX; i++ ){
+      FI FXC = X[i]; FXC.diff( HC.color(i), HC.ncolor() );
+      BFXC[i] = FXC;
+    }
+    BFI BFFC = arrow( NX, BFXC );
+    BFFC.diff( 0, 1 );
+
+    const Specbnd<Interval>::Options::HESSBND_STRATEGY strat[3] = {
+      Specbnd<Interval>::Options::GERSHGORIN, Specbnd<Interval>::Options::ROHN,
+      Specbnd<Interval>::Options::HERTZROHN };
+    for( unsigned int s=0; s<3; s++ ){
+      Specbnd<Interval>::options.HESSBND = strat[s];
+      std::pair<double,double> spbnd  = Specbnd<Interval>::spectral_bound( FFF );
+      std::pair<double,double> spbndF = Specbnd<Interval>::spectral_bound( FFFC, HC );
+      std::pair<double,double> spbndB = Specbnd<Interval>::spectral_bound( BFXC, HC );
+      CPPUNIT_ASSERT( Eq( spbnd.first,  spbndF.first ) );
+      CPPUNIT_ASSERT( Eq( spbnd.second, spbndF.second ) );
+      CPPUNIT_ASSERT( Eq( spbnd.first,  spbndB.first ) );
+      CPPUNIT_ASSERT( Eq( spbnd.second, spbndB.second ) );
+    }
+    Specbnd<Interval>::options.HESSBND = Specbnd<Interval>::Options::GERSHGORIN;
+  }
+
+  void testSize(){
+    // The following line should throw an instance of HessPattern::Exceptions
+    HessPattern X1( 0, 1 ), X2( 1, 3 );
+    X1 + X2;
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::HessPatternTest );
+
+} // end namespace mc
+
+#endif
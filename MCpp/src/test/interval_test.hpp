@@ -9,6 +9,7 @@
 #include <iomanip>
 #include <string>
 #include <cppunit/extensions/HelperMacros.h>
+#include <fenv.h>
 #include "interval.hpp"
 
 
@@ -30,6 +31,7 @@ CPPUNIT_TEST( testProduct );
 CPPUNIT_TEST( testDivision );
 CPPUNIT_TEST( testFunction );
 CPPUNIT_TEST( testExpression );
+CPPUNIT_TEST( testVerified );
 CPPUNIT_TEST_EXCEPTION( testDivisionByZero, mc::Interval::Exceptions );
 CPPUNIT_TEST_EXCEPTION( testNegativeLog,    mc::Interval::Exceptions );
 CPPUNIT_TEST_EXCEPTION( testNegativeSqrt,   mc::Interval::Exceptions );
@@ -122,6 +124,37 @@ public:
                     Interval( -1.431462803165178e+00, 2.017883770237767e+00 ) ));
   }
 
+  void testVerified(){
+    // Enclosures of real numbers that are not representable in double precision
+    const long double third = 1.L/3.L, sum = (long double)0.1+(long double)0.2;
+    {
+      Interval::Verified scope;
+      CPPUNIT_ASSERT( fegetround() == FE_UPWARD );
+      const Interval Vthird = Interval( 1. )/3., Vsum = Interval( 0.1 )+0.2,
+                     Vprod = Interval( 0.1 )*Interval( -3. ), Vexp = exp( Interval( 1. ) ),
+                     Vsin = sin( Interval( PI ) ), Vlog = log( Interval( 10. ) );
+      CPPUNIT_ASSERT( Vthird.l() <= third && third <= Vthird.u() && Vthird.l() < Vthird.u() );
+      CPPUNIT_ASSERT( Vsum.l() <= sum && sum <= Vsum.u() && Vsum.l() < Vsum.u() );
+      CPPUNIT_ASSERT( Vprod.l() <= -3.L*0.1 && -3.L*0.1 <= Vprod.u() );
+      CPPUNIT_ASSERT( Vexp.l() <= std::exp(1.L) && std::exp(1.L) <= Vexp.u() );
+      CPPUNIT_ASSERT( Vsin.l() <= std::sin((long double)PI) && std::sin((long double)PI) <= Vsin.u() );
+      CPPUNIT_ASSERT( Vlog.l() <= std::log(10.L) && std::log(10.L) <= Vlog.u() );
+      {
+        Interval::Verified nested;
+        const Interval Vthird2 = Interval( 1. )/3.;
+        CPPUNIT_ASSERT( Vthird2 == Vthird );
+      }
+      CPPUNIT_ASSERT( fegetround() == FE_UPWARD );
+      // Same expression as testExpression, enclosing the non-verified bounds
+      const Interval F = X*exp(-pow(X,2));
+      CPPUNIT_ASSERT( F.l() <= 1.831563888873418e-02 && F.u() >= 7.357588823428847e-01 );
+    }
+    CPPUNIT_ASSERT( fegetround() == FE_TONEAREST );
+    // Outside of a verified scope, the bounds are rounded to nearest
+    const Interval Ithird = Interval( 2. )/6., Isum = Interval( 0.3 )+0.4;
+    CPPUNIT_ASSERT( Ithird.l() == Ithird.u() && Isum.l() == Isum.u() );
+  }
+
   void testDivisionByZero(){
     // The following line should throw an instance of mc::Interval::Exceptions
     1. / Interval( -1, 2 );
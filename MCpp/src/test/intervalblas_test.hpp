@@ -0,0 +1,161 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__INTERVALBLAS_TEST_HPP
+#define MC__INTERVALBLAS_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "intervalblas.hpp"
+
+namespace mc
+{
+//! @brief C++ class for test of mc::IntervalBLAS class using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! IntervalBLASTest is a C++ class for testing the products of interval
+//! vectors and matrices in mc::IntervalBLAS with the infimum-supremum
+//! and midpoint-radius algorithms, using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class IntervalBLASTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( IntervalBLASTest );
+CPPUNIT_TEST( testInfSup );
+CPPUNIT_TEST( testMidRad );
+CPPUNIT_TEST( testPoint );
+CPPUNIT_TEST( testUnbounded );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef IntervalBLAS<Interval> IBLAS;
+
+  static const unsigned int M = 13;
+  static const unsigned int N = 7;
+  static const unsigned int K = 11;
+
+  std::vector<Interval> A, B;
+  std::vector<double> P;
+
+  //! @brief Whether <tt>I1</tt> is included in <tt>I2</tt>
+  static bool In( const Interval&I1, const Interval&I2 )
+  {
+    return I1.l() >= I2.l() && I1.u() <= I2.u();
+  }
+
+  //! @brief Whether <tt>I1</tt> is no wider than <tt>fac</tt> times <tt>I2</tt>, plus round-off
+  static bool Wider( const Interval&I1, const Interval&I2, const double fac )
+  {
+    return diam(I1) <= fac*diam(I2) + 1e2*machprec()*(1.+Op<Interval>::abs(I2));
+  }
+
+  //! @brief Product of the <tt>m</tt>-by-<tt>k</tt> matrix <tt>A</tt> and <tt>k</tt>-by-<tt>n</tt> matrix <tt>B</tt> with scalar operations
+  template <typename U> static std::vector<Interval> Product
+    ( const unsigned int m, const unsigned int n, const unsigned int k,
+      const U*A, const Interval*B )
+  {
+    std::vector<Interval> C( m*n, Interval(0.) );
+    for( unsigned int i=0; i<m; i++ )
+      for( unsigned int j=0; j<n; j++ )
+        for( unsigned int l=0; l<k; l++ )
+          C[i+j*m] += A[i+l*m] * B[l+j*k];
+    return C;
+  }
+
+public:
+
+  void setUp(){
+    // Intervals of various widths and sign combinations, and a few degenerate ones
+    A.resize( M*K, Interval( 0. ) ); B.resize( K*N, Interval( 0. ) ); P.resize( M*K );
+    for( unsigned int i=0; i<M*K; i++ ){
+      const double c = std::sin( 1.+i ), r = 0.1*std::fabs( std::cos( 3.*i ) );
+      A[i] = i%5? Interval( c-r, c+r ): Interval( c );
+      P[i] = std::cos( 0.7*i );
+    }
+    for( unsigned int i=0; i<K*N; i++ ){
+      const double c = 2.*std::cos( 2.+i ), r = 0.05*(i%4);
+      B[i] = Interval( c-r, c+2.*r );
+    }
+    IBLAS::options = IBLAS::Options();
+  }
+
+  void tearDown(){
+    IBLAS::options = IBLAS::Options();
+  }
+
+  void testInfSup(){
+    // Same bounds as the scalar operations
+    IBLAS::options.MIDRAD = false;
+    std::vector<Interval> C( M*N, Interval( 0. ) ), y( M, Interval( 0. ) );
+    IBLAS::gemm( M, N, K, &A[0], &B[0], &C[0] );
+    IBLAS::gemv( M, K, &A[0], &B[0], &y[0] );
+    const std::vector<Interval> C0 = Product( M, N, K, &A[0], &B[0] );
+    for( unsigned int i=0; i<M*N; i++ )
+      CPPUNIT_ASSERT( C[i] == C0[i] );
+    for( unsigned int i=0; i<M; i++ )
+      CPPUNIT_ASSERT( y[i] == C0[i] );
+  }
+
+  void testMidRad(){
+    // Enclosure of the infimum-supremum bounds, at most 1.5 times wider
+    IBLAS::options.MIDRAD_MIN = 0;
+    std::vector<Interval> C( M*N, Interval( 0. ) ), y( M, Interval( 0. ) );
+    IBLAS::gemm( M, N, K, &A[0], &B[0], &C[0] );
+    IBLAS::gemv( M, K, &A[0], &B[0], &y[0] );
+    const std::vector<Interval> C0 = Product( M, N, K, &A[0], &B[0] );
+    for( unsigned int i=0; i<M*N; i++ ){
+      CPPUNIT_ASSERT( In( C0[i], C[i] ) );
+      CPPUNIT_ASSERT( Wider( C[i], C0[i], 1.5 ) );
+    }
+    for( unsigned int i=0; i<M; i++ )
+      CPPUNIT_ASSERT( In( C0[i], y[i] ) && Wider( y[i], C0[i], 1.5 ) );
+
+    const Interval d = IBLAS::dot( K, &A[0], &B[0] ), d0 = Product( 1, 1, K, &A[0], &B[0] )[0];
+    CPPUNIT_ASSERT( In( d0, d ) && Wider( d, d0, 1.5 ) );
+
+    // Verified enclosure of a point product: 0.1*3 + 0.2*3 + ... is not exact in double
+    Interval x[3] = { 0.1, 0.2, 0.7 }, z[3] = { 3., 3., -3. };
+    const Interval p = IBLAS::dot( 3, x, z );
+    const long double p0 = 3.L*( 0.1L + 0.2L - 0.7L );
+    CPPUNIT_ASSERT( p.l() <= p0 && p.u() >= p0 && p.l() < p.u() );
+  }
+
+  void testPoint(){
+    // Real matrix times interval matrix, with both algorithms
+    std::vector<Interval> C( M*N, Interval( 0. ) ), C1( M*N, Interval( 0. ) );
+    IBLAS::options.MIDRAD = false;
+    IBLAS::gemm( M, N, K, &P[0], &B[0], &C[0] );
+    IBLAS::options.MIDRAD = true;
+    IBLAS::options.MIDRAD_MIN = 0;
+    IBLAS::gemm( M, N, K, &P[0], &B[0], &C1[0] );
+    const std::vector<Interval> C0 = Product( M, N, K, &P[0], &B[0] );
+    for( unsigned int i=0; i<M*N; i++ ){
+      CPPUNIT_ASSERT( C[i] == C0[i] );
+      CPPUNIT_ASSERT( In( C0[i], C1[i] ) && Wider( C1[i], C0[i], 1.5 ) );
+    }
+  }
+
+  void testUnbounded(){
+    // Infimum-supremum algorithm used for unbounded intervals
+    IBLAS::options.MIDRAD_MIN = 0;
+    A[0] = Interval( 1., std::numeric_limits<double>::infinity() );
+    std::vector<Interval> C( M*N, Interval( 0. ) );
+    IBLAS::gemm( M, N, K, &A[0], &B[0], &C[0] );
+    const std::vector<Interval> C0 = Product( M, N, K, &A[0], &B[0] );
+    for( unsigned int i=0; i<M*N; i++ )
+      CPPUNIT_ASSERT( C[i] == C0[i] );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::IntervalBLASTest );
+
+} // end namespace mc
+
+#endif
@@ -0,0 +1,141 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__INTERVALPACK_TEST_HPP
+#define MC__INTERVALPACK_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "intervalpack.hpp"
+#include "mccormick.hpp"
+#include "tmodel.hpp"
+
+struct IPfct{ template <typename U> U operator()( const U&x, const U&y ) const
+  { return x*y*exp(x) - 2.*sqr(y)/(1.+sqr(x)) + sqrt(x+2.)*log(3.-y) - pow(x-y,3)
+         + sin(x*y)/(y-2.) + atan(y)*x; } };
+
+namespace mc
+{
+//! @brief C++ class for test of mc::IntervalPack class using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! IntervalPackTest is a C++ class for testing the packed interval
+//! arithmetic class mc::IntervalPack against mc::Interval, as well as
+//! its use as template parameter of mc::McCormick and mc::TModel,
+//! using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class IntervalPackTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( IntervalPackTest );
+CPPUNIT_TEST( testProduct );
+CPPUNIT_TEST( testExpression );
+CPPUNIT_TEST( testMcCormick );
+CPPUNIT_TEST( testTModel );
+CPPUNIT_TEST_EXCEPTION( testDivisionByZero, mc::Interval::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  static const unsigned int NP = 11;
+  typedef IntervalPack<NP> IP;
+
+  bool Eq( const Interval&I1, const Interval&I2,
+           const double atol=1e2*machprec(), const double rtol=1e2*machprec() ) const
+  {
+    return( isequal( I1.l(), I2.l(), atol, rtol )
+         && isequal( I1.u(), I2.u(), atol, rtol ) );
+  }
+
+  IP X;
+  IP Y;
+
+public:
+
+  void setUp(){
+    // Lanes with all the sign combinations of the bounds, and an odd width to exercise the remainder loops
+    for( unsigned int i=0; i<NP; i++ ){
+      X.set( i, Interval( -1.5+0.3*i, -1.+0.4*i ) );
+      Y.set( i, Interval( -1.2+0.25*i, 0.1+0.1*i ) );
+    }
+  }
+
+  void tearDown(){}
+
+  void testProduct(){
+    const IP Z = X*Y, W = X/(Y+3.), S = sqr(X);
+    for( unsigned int i=0; i<NP; i++ ){
+      CPPUNIT_ASSERT( Z[i] == X[i]*Y[i] );
+      CPPUNIT_ASSERT( Eq( W[i], X[i]/(Y[i]+3.) ) );
+      CPPUNIT_ASSERT( S[i] == sqr(X[i]) );
+    }
+  }
+
+  void testExpression(){
+    const IP F = IPfct()( X, Y ), G = fabs( X ) + cos( Y ) * pow( X, 4 ) / exp( Y );
+    for( unsigned int i=0; i<NP; i++ ){
+      CPPUNIT_ASSERT( Eq( F[i], IPfct()( X[i], Y[i] ) ) );
+      CPPUNIT_ASSERT( Eq( G[i], fabs( X[i] ) + cos( Y[i] ) * pow( X[i], 4 ) / exp( Y[i] ) ) );
+    }
+  }
+
+  void testMcCormick(){
+    // Lane-wise interval bounds, and relaxations valid on the hull of the lanes
+    typedef McCormick<IP> MCIP;
+    typedef McCormick<Interval> MCI;
+    MCIP::options.MVCOMP_USE = MCI::options.MVCOMP_USE = false;
+    const double x = 0.2, y = -0.1;
+    const MCIP F = IPfct()( MCIP( X, x ), MCIP( Y, y ) );
+    const MCI FH = IPfct()( MCI( Interval( X.l(), X.u() ), x ), MCI( Interval( Y.l(), Y.u() ), y ) );
+    const Interval f = IPfct()( Interval( x ), Interval( y ) );
+    CPPUNIT_ASSERT( F.cv() <= f.l() && F.cc() >= f.u() );
+    CPPUNIT_ASSERT( F.cv() >= FH.cv()-1e2*machprec() && F.cc() <= FH.cc()+1e2*machprec() );
+    const IP FI = IPfct()( X, Y );
+    for( unsigned int i=0; i<NP; i++ )
+      CPPUNIT_ASSERT( Eq( F.I()[i], FI[i] ) );
+  }
+
+  void testTModel(){
+    // Lane-wise remainder bounds of a Taylor model expanded at the midpoint of the hull
+    typedef TModel<IP> TMIP;
+    typedef TVar<IP> TVIP;
+    TMIP TM( 2, 3 );
+    const TVIP F = IPfct()( TVIP( &TM, 0, X ), TVIP( &TM, 1, Y ) );
+    const IP FB = F.B();
+
+    // Same expansion in scalar Taylor arithmetic on the hull of the lanes
+    TModel<Interval> TMI( 2, 3 );
+    const Interval XH( X.l(), X.u() ), YH( Y.l(), Y.u() );
+    const Interval FH = IPfct()( TVar<Interval>( &TMI, 0, XH ), TVar<Interval>( &TMI, 1, YH ) ).B();
+
+    const unsigned int NS = 6;
+    for( unsigned int i=0; i<NP; i++ ){
+      // Enclosure of the function values in each lane box
+      for( unsigned int a=0; a<=NS; a++ )
+        for( unsigned int b=0; b<=NS; b++ ){
+          const Interval FP = IPfct()( Interval( X.l(i)+a*(X.u(i)-X.l(i))/NS ),
+                                       Interval( Y.l(i)+b*(Y.u(i)-Y.l(i))/NS ) );
+          CPPUNIT_ASSERT( FB.l(i) <= FP.l() && FB.u(i) >= FP.u() );
+        }
+      // Each lane at least as tight as the scalar bound on the hull
+      CPPUNIT_ASSERT( FB.l(i) >= FH.l()-1e-8*std::fabs(FH.l()) && FB.u(i) <= FH.u()+1e-8*std::fabs(FH.u()) );
+      CPPUNIT_ASSERT( FB.u(i)-FB.l(i) <= diam( FH ) );
+    }
+  }
+
+  void testDivisionByZero(){
+    // The following line should throw an instance of mc::Interval::Exceptions
+    X/Y;
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::IntervalPackTest );
+
+} // end namespace mc
+
+#endif
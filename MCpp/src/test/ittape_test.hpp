@@ -0,0 +1,180 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__ITTAPE_TEST_HPP
+#define MC__ITTAPE_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "mcfadbad.hpp"
+#include "ittape.hpp"
+
+struct ITfct{ template <typename U> U operator()( const U*x ) const
+  { return x[0]*x[1]*exp(x[0]) + sin(x[0]-x[1]) - 2.*sqr(x[1])/(1.+sqr(x[0]))
+         + sqrt(x[0]+2.)*log(3.-x[1]) - atan(x[1])/x[0] + cos(x[0]*x[1]) + asin(0.5*x[1]); } };
+
+struct ITode{ template <typename U> void operator()( const U*x, U*f ) const
+  { f[0] = x[0]*(1.-x[1]); f[1] = -x[1]*(1.-x[0]) + 0.1*sin(x[0]); } };
+
+typedef mc::ITTape<mc::Interval> ITI;
+
+namespace mc
+{
+//! @brief C++ class for test of mc::ITTape / mc::ITVar classes using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! ITTapeTest is a C++ class for testing the interval Taylor
+//! coefficient classes mc::ITTape and mc::ITVar against
+//! <tt>fadbad::T</tt> using CppUnit.
+////////////////////////////////////////////////////////////////////////
+class ITTapeTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( ITTapeTest );
+CPPUNIT_TEST( testFunction );
+CPPUNIT_TEST( testODE );
+CPPUNIT_TEST( testReset );
+CPPUNIT_TEST( testVerified );
+CPPUNIT_TEST_EXCEPTION( testOrder, ITI::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef fadbad::T<Interval,21> TI; // Coefficients up to order 20, as in testODE
+
+  bool Eq( const double&D1, const double&D2,
+           const double atol=1e4*machprec(), const double rtol=1e4*machprec() ) const
+  {
+    return isequal( D1, D2, atol, rtol );
+  }
+
+  bool Eq( const Interval&I1, const Interval&I2 ) const
+  {
+    return Eq( I1.l(), I2.l() ) && Eq( I1.u(), I2.u() );
+  }
+
+  //! @brief Compare the Taylor coefficients of ITfct from mc::ITTape and fadbad::T up to order <a>NORD</a>
+  bool Compare( const Interval*X, const unsigned int NORD ) const
+  {
+    ITTape<Interval> tape( NORD );
+    ITVar<Interval> ITX[2] = { tape.var( X[0] ), tape.var( X[1] ) };
+    tape.set( ITX[0], 1, 1. );
+    tape.set( ITX[1], 1, Interval( -0.5, 0.5 ) );
+    ITVar<Interval> ITF = ITfct()( ITX );
+    tape.eval( NORD );
+
+    TI TX[2] = { X[0], X[1] };
+    TX[0][1] = 1.;
+    TX[1][1] = Interval( -0.5, 0.5 );
+    TI TF = ITfct()( TX );
+    TF.eval( NORD );
+
+    for( unsigned int k=0; k<=NORD; k++ )
+      if( !Eq( ITF[k], TF[k] ) ) return false;
+    return true;
+  }
+
+public:
+
+  void setUp(){}
+
+  void tearDown(){}
+
+  void testFunction(){
+    const Interval X[2] = { Interval( 1., 1.2 ), Interval( -0.2, 0. ) };
+    CPPUNIT_ASSERT( Compare( X, 8 ) );
+  }
+
+  void testODE(){
+    // Taylor coefficients of order 20 of the ODE solutions
+    const unsigned int NORD = 20;
+    const Interval X0[2] = { Interval( 0.9, 1. ), Interval( 1., 1.1 ) };
+
+    ITTape<Interval> tape( NORD );
+    ITVar<Interval> ITX[2] = { tape.var( X0[0] ), tape.var( X0[1] ) }, ITF[2];
+    ITode()( ITX, ITF );
+    for( unsigned int k=0; k<NORD; k++ ){
+      tape.eval( k );
+      for( unsigned int i=0; i<2; i++ )
+        tape.set( ITX[i], k+1, tape.coef( ITF[i], k ) / (k+1.) );
+    }
+
+    TI TX[2] = { X0[0], X0[1] }, TF[2];
+    ITode()( TX, TF );
+    for( unsigned int k=0; k<NORD; k++ ){
+      for( unsigned int i=0; i<2; i++ ) TF[i].eval( k );
+      for( unsigned int i=0; i<2; i++ ) TX[i][k+1] = TF[i][k] / (k+1.);
+    }
+
+    for( unsigned int k=0; k<=NORD; k++ )
+      for( unsigned int i=0; i<2; i++ )
+        CPPUNIT_ASSERT( Eq( ITX[i][k], TX[i][k] ) );
+  }
+
+  void testReset(){
+    // Reusing a recorded function for another box, then recording it again on a reset tape
+    ITTape<Interval> tape( 6 );
+    ITVar<Interval> ITX[2] = { tape.var( 0. ), tape.var( 0. ) };
+    ITVar<Interval> ITF = ITfct()( ITX );
+    const unsigned int size = tape.size();
+    for( unsigned int k=0; k<4; k++ ){
+      const Interval X[2] = { Interval( 1.+0.1*k, 1.5 ), Interval( -0.3, 0.1*k ) };
+      tape.set( ITX[0], 0, X[0] ); tape.set( ITX[0], 1, 1. );
+      tape.set( ITX[1], 0, X[1] ); tape.set( ITX[1], 1, Interval( -0.5, 0.5 ) );
+      tape.eval( 6 );
+      CPPUNIT_ASSERT( Compare( X, 6 ) );
+
+      TI TX[2] = { X[0], X[1] };
+      TX[0][1] = 1.;
+      TX[1][1] = Interval( -0.5, 0.5 );
+      TI TF = ITfct()( TX );
+      TF.eval( 6 );
+      for( unsigned int j=0; j<=6; j++ )
+        CPPUNIT_ASSERT( Eq( ITF[j], TF[j] ) );
+
+      tape.reset();
+      ITX[0] = tape.var( 0. ); ITX[1] = tape.var( 0. );
+      ITF = ITfct()( ITX );
+      CPPUNIT_ASSERT( tape.size() == size );
+    }
+  }
+
+  void testVerified(){
+    // Coefficients of a product, which are Cauchy sums, in a verified scope
+    // enclosing those rounded to nearest
+    ITTape<Interval> tape( 8 ), vtape( 8 );
+    ITVar<Interval> ITX[2] = { tape.var( 0.1 ), tape.var( 0.3 ) },
+                    VTX[2] = { vtape.var( 0.1 ), vtape.var( 0.3 ) };
+    for( unsigned int j=1; j<=8; j++ ){
+      tape.set( ITX[0], j, Interval( -0.1, 0.1*j ) ); tape.set( ITX[1], j, 0.3/(j+1.) );
+      vtape.set( VTX[0], j, Interval( -0.1, 0.1*j ) ); vtape.set( VTX[1], j, 0.3/(j+1.) );
+    }
+    ITVar<Interval> ITF = ITX[0]*ITX[1], VTF = VTX[0]*VTX[1];
+    tape.eval( 8 );
+    {
+      Interval::Verified scope;
+      vtape.eval( 8 );
+    }
+    for( unsigned int k=1; k<=8; k++ )
+      CPPUNIT_ASSERT( VTF[k].l() <= ITF[k].l() && ITF[k].u() <= VTF[k].u() );
+  }
+
+  void testOrder(){
+    // The following line should throw an instance of ITI::Exceptions
+    ITI tape( 4 );
+    ITVar<Interval> X = tape.var( 1. ), F = exp( X );
+    tape.eval( 2 );
+    tape.coef( F, 3 );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::ITTapeTest );
+
+} // end namespace mc
+
+#endif
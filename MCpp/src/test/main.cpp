@@ -1,7 +1,21 @@
 #include "interval_test.hpp"
 #include "mccormick_test.hpp"
 #include "tmodel_test.hpp"
+#include "cmodel_test.hpp"
 #include "specbnd_test.hpp"
+#include "spspecbnd_test.hpp"
+#include "alphabb_test.hpp"
+#include "hesspattern_test.hpp"
+#include "btape_test.hpp"
+#include "ittape_test.hpp"
+#include "intervalpack_test.hpp"
+#include "intervalblas_test.hpp"
+#include "affine_test.hpp"
+#include "ffunc_test.hpp"
+#include "ffcontractor_test.hpp"
+#include "ffcodegen_test.hpp"
+#include "ffbranchbound_test.hpp"
+#include "mcthread_test.hpp"
 
 #include <cppunit/CompilerOutputter.h>
 #include <cppunit/extensions/TestFactoryRegistry.h>
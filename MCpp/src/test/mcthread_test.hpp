@@ -0,0 +1,184 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__MCTHREAD_TEST_HPP
+#define MC__MCTHREAD_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <pthread.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "mccormick.hpp"
+#include "mcfadbad.hpp"
+#include "affine.hpp"
+
+namespace mc
+{
+//! @brief C++ class for test of concurrent derivative evaluations with FADBAD++ types using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! ThreadTest is a C++ class for testing the evaluation of
+//! <tt>fadbad::B</tt> and <tt>fadbad::F</tt> derivatives in interval
+//! and McCormick arithmetic from several threads at once, using
+//! CppUnit.
+////////////////////////////////////////////////////////////////////////
+class ThreadTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( ThreadTest );
+CPPUNIT_TEST( testInterval );
+CPPUNIT_TEST( testMcCormick );
+CPPUNIT_TEST( testZero );
+CPPUNIT_TEST( testAffine );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef McCormick<Interval> MC;
+
+  static const unsigned int NTHREAD = 4;
+  static const unsigned int NREPEAT = 300;
+
+  //! @brief Test function, involving McCormick envelopes computed iteratively
+  template <typename U> static U fct( const U*x )
+  {
+    return x[0]*cos(x[1]) + atan(x[0]-x[1]) + pow(x[1],3)*exp(x[0]) + asin(0.5*x[2]);
+  }
+
+  //! @brief Data of a thread: variable bounds and McCormick reference point, and results
+  struct t_data{
+    Interval X[3];
+    double x[3];
+    Interval FI, DFI[3];
+    double cv, DFcv[3], D0;
+  };
+
+  //! @brief Reverse-mode derivatives in interval arithmetic, repeated <tt>NREPEAT</tt> times
+  static void* _interval( void*arg )
+  {
+    t_data& d = *static_cast<t_data*>( arg );
+    for( unsigned int k=0; k<NREPEAT; k++ ){
+      fadbad::B<Interval> BX[3] = { d.X[0], d.X[1], d.X[2] };
+      fadbad::B<Interval> BF = fct( BX );
+      BF.diff( 0, 1 );
+      d.FI = BF.x();
+      for( unsigned int i=0; i<3; i++ ) d.DFI[i] = BX[i].d(0);
+    }
+    return 0;
+  }
+
+  //! @brief Reverse-mode and forward-mode derivatives in McCormick arithmetic, repeated <tt>NREPEAT</tt> times
+  static void* _mccormick( void*arg )
+  {
+    t_data& d = *static_cast<t_data*>( arg );
+    for( unsigned int k=0; k<NREPEAT; k++ ){
+      MC X[3];
+      for( unsigned int i=0; i<3; i++ ) X[i] = MC( d.X[i], d.x[i] ).sub( 3, i );
+      fadbad::B<MC> BX[3] = { X[0], X[1], X[2] };
+      fadbad::B<MC> BF = fct( BX );
+      BF.diff( 0, 1 );
+      fadbad::F<MC> FX[3] = { X[0], X[1], X[2] };
+      FX[0].diff( 0, 1 );
+      fadbad::F<MC> FF = fct( FX );
+      d.cv = BF.x().cv();
+      for( unsigned int i=0; i<3; i++ ) d.DFcv[i] = BX[i].d(0).cv();
+      d.D0 = FF.d(0).cv() + FF.d(1).cv();
+    }
+    return 0;
+  }
+
+  //! @brief Affine form of <tt>sqr(X)-X</tt>, for an affine form <tt>X</tt> created by another thread
+  static void* _affine( void*arg )
+  {
+    std::pair<const Affine*,Affine>& d = *static_cast< std::pair<const Affine*,Affine>* >( arg );
+    d.second = sqr( *d.first ) - *d.first;
+    return 0;
+  }
+
+  //! @brief Bitwise comparison of intervals <tt>I1</tt> and <tt>I2</tt>
+  static bool Eq( const Interval&I1, const Interval&I2 )
+  {
+    return I1.l() == I2.l() && I1.u() == I2.u();
+  }
+
+  //! @brief Run <tt>fct</tt> on <tt>NTHREAD</tt> threads at once, then again on a single thread, and compare
+  bool Compare( void* (*fct)( void* ) ) const
+  {
+    t_data data[NTHREAD], ref[NTHREAD];
+    for( unsigned int t=0; t<NTHREAD; t++ ){
+      for( unsigned int i=0; i<3; i++ ){
+        data[t].X[i] = Interval( -0.8+0.1*t+0.2*i, 0.5+0.05*t );
+        data[t].x[i] = Op<Interval>::mid( data[t].X[i] );
+        data[t].DFI[i] = 0.; data[t].DFcv[i] = 0.;
+      }
+      data[t].FI = 0.; data[t].cv = data[t].D0 = 0.;
+      ref[t] = data[t];
+    }
+
+    pthread_t thread[NTHREAD];
+    for( unsigned int t=0; t<NTHREAD; t++ )
+      if( pthread_create( thread+t, 0, fct, data+t ) ) return false;
+    for( unsigned int t=0; t<NTHREAD; t++ )
+      pthread_join( thread[t], 0 );
+
+    for( unsigned int t=0; t<NTHREAD; t++ ){
+      fct( ref+t );
+      if( !Eq( data[t].FI, ref[t].FI ) || data[t].cv != ref[t].cv || data[t].D0 != ref[t].D0 ) return false;
+      for( unsigned int i=0; i<3; i++ )
+        if( !Eq( data[t].DFI[i], ref[t].DFI[i] ) || data[t].DFcv[i] != ref[t].DFcv[i] ) return false;
+    }
+    return true;
+  }
+
+public:
+
+  void setUp(){}
+
+  void tearDown(){}
+
+  void testInterval(){
+    CPPUNIT_ASSERT( Compare( _interval ) );
+  }
+
+  void testMcCormick(){
+    MC::options.MVCOMP_USE = false;
+    CPPUNIT_ASSERT( Compare( _mccormick ) );
+  }
+
+  void testZero(){
+    // Writing to the derivative of a constant does not change the zero derivatives of other constants
+    fadbad::F<Interval,3> F1( Interval(1.) ), F2( Interval(2.) );
+    F1.d(1) = Interval(5.);
+    CPPUNIT_ASSERT( Eq( F2.d(1), Interval(0.) ) && Eq( F2.deriv(1), Interval(0.) ) );
+    fadbad::F<Interval> FD1( Interval(1.) ), FD2( Interval(2.) );
+    FD1.d(0) += Interval(3.);
+    CPPUNIT_ASSERT( Eq( FD2.d(0), Interval(0.) ) && Eq( FD2.deriv(0), Interval(0.) ) );
+    fadbad::B<Interval> B1( Interval(1.) ), B2( Interval(2.) );
+    B1.d(0) = Interval(7.);
+    const fadbad::B<Interval>& B3( B2 );
+    CPPUNIT_ASSERT( Eq( B2.d(0), Interval(0.) ) );
+    CPPUNIT_ASSERT( Eq( B3.deriv(0), Interval(0.) ) );
+  }
+
+  void testAffine(){
+    // Noise symbols of the forms created in different threads are distinct
+    const Affine X( -1., 1. );
+    std::pair<const Affine*,Affine> data( &X, Affine( 0. ) );
+    pthread_t thread;
+    CPPUNIT_ASSERT( !pthread_create( &thread, 0, _affine, &data ) );
+    pthread_join( thread, 0 );
+    const Affine Z = sqr( X ) - X;
+    CPPUNIT_ASSERT( data.second.l() == Z.l() && data.second.u() == Z.u() );
+    CPPUNIT_ASSERT( Z.l() <= -0.25 && Z.u() >= 2. );
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::ThreadTest );
+
+} // end namespace mc
+
+#endif
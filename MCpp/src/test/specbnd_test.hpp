@@ -35,6 +35,10 @@ CPPUNIT_TEST( testExpression2 );
 CPPUNIT_TEST( testExpression3 );
 CPPUNIT_TEST( testExpression4 );
 CPPUNIT_TEST( testExpression5 );
+CPPUNIT_TEST( testHertzRohnStop );
+CPPUNIT_TEST( testBounders );
+CPPUNIT_TEST( testFixedDimension );
+CPPUNIT_TEST( testEigenSolver );
 CPPUNIT_TEST_EXCEPTION( testSize, SB::Exceptions );
 CPPUNIT_TEST_SUITE_END();
 
@@ -241,7 +245,137 @@ public:
     CPPUNIT_ASSERT( Eq( spbndHR.second,  1.268372788753369e+01 ) );
   }
  
-  void testSize(){
+  void testHertzRohnStop(){
+    FI FX1 = I(-0.3,0.2); FX1.diff(0,3);
+    FI FX2 = I(-0.1,0.6); FX2.diff(1,3);
+    FI FX3 = I(-0.4,0.5); FX3.diff(2,3);
+    FFI FFX1 = FX1; FFX1.diff(0,3);
+    FFI FFX2 = FX2; FFX2.diff(1,3);
+    FFI FFX3 = FX3; FFX3.diff(2,3);
+    FFI FFF = exp( FFX1 - 2*pow(FFX2,2) + 3*pow(FFX3,3) );
+
+    // Nonconvexity certified without enumerating all vertex matrices
+    SB::options.HESSBND = SB::Options::HERTZROHN;
+    SB::options.HERTZROHN_STOPL = 0.;
+    std::pair<double,double> spbndHR = SB::spectral_bound( FFF );
+    SB::options.HERTZROHN_STOPL = -std::numeric_limits<double>::max();
+    CPPUNIT_ASSERT( spbndHR.first < 0. );
+    CPPUNIT_ASSERT( spbndHR.first >= -2.119728596072178e+01-1e2*machprec() );
+  }
+
+  void testBounders(){
+    FI FX1 = I(-0.3,0.2); FX1.diff(0,3);
+    FI FX2 = I(-0.1,0.6); FX2.diff(1,3);
+    FI FX3 = I(-0.4,0.5); FX3.diff(2,3);
+    FFI FFX1 = FX1; FFX1.diff(0,3);
+    FFI FFX2 = FX2; FFX2.diff(1,3);
+    FFI FFX3 = FX3; FFX3.diff(2,3);
+    FFI FFF[2] = { exp( FFX1 - 2*pow(FFX2,2) + 3*pow(FFX3,3) ),
+                   1.+FFX1*sin(2.*FFX1+3.*FFX2)-cos(3.*FFX1-5.*FFX2) };
+
+    const double tol = 1e2*machprec();
+    for( unsigned int k=0; k<2; k++ ){
+      SB::options.HESSBND = SB::Options::GERSHGORIN;
+      std::pair<double,double> spbndG = SB::spectral_bound( FFF[k] );
+      SB::options.HESSBND = SB::Options::HERTZROHN;
+      std::pair<double,double> spbndHR = SB::spectral_bound( FFF[k] );
+
+      // All bounders enclose the exact bounds from Hertz & Rohn's method
+      const SB::Options::HESSBND_STRATEGY strat[3] = { SB::Options::GERSHGORIN_SCALED,
+        SB::Options::ROHN, SB::Options::EMATRIX };
+      for( unsigned int i=0; i<3; i++ ){
+        SB::options.HESSBND = strat[i];
+        std::pair<double,double> spbnd = SB::spectral_bound( FFF[k] );
+        //std::cout << I(spbnd.first,spbnd.second) << std::endl;
+        CPPUNIT_ASSERT( spbnd.first  <= spbndHR.first+tol );
+        CPPUNIT_ASSERT( spbnd.second >= spbndHR.second-tol );
+        // Optimal scaling never does worse than plain Gershgorin
+        if( strat[i] != SB::Options::GERSHGORIN_SCALED ) continue;
+        CPPUNIT_ASSERT( spbnd.first  >= spbndG.first-tol );
+        CPPUNIT_ASSERT( spbnd.second <= spbndG.second+tol );
+      }
+    }
+    SB::options.HESSBND = SB::Options::GERSHGORIN;
+  }
+
+  void testFixedDimension(){
+    // Stack-based derivatives with 3 directions fixed at compile time
+    typedef fadbad::F<I,3> FI3;
+    typedef fadbad::F<FI3,3> FFI3;
+    typedef fadbad::B<FI3> BFI3;
+    typedef fadbad::B<FI> BFI;
+    const I X[3] = { I(-0.3,0.2), I(-0.1,0.6), I(-0.4,0.5) };
+    FI FX[3]; FFI FFX[3]; BFI BFX[3];
+    FI3 FX3[3]; FFI3 FFX3[3]; BFI3 BFX3[3];
+    for( unsigned int i=0; i<3; i++ ){
+      FX[i] = X[i]; FX[i].diff(i,3); FFX[i] = FX[i]; FFX[i].diff(i,3); BFX[i] = FX[i];
+      FX3[i] = X[i]; FX3[i].diff(i); FFX3[i] = FX3[i]; FFX3[i].diff(i); BFX3[i] = FX3[i];
+    }
+    FFI FFF = exp( FFX[0] - 2*pow(FFX[1],2) + 3*pow(FFX[2],3) );
+    FFI3 FFF3 = exp( FFX3[0] - 2*pow(FFX3[1],2) + 3*pow(FFX3[2],3) );
+    BFI BFF = exp( BFX[0] - 2*pow(BFX[1],2) + 3*pow(BFX[2],3) );
+    BFI3 BFF3 = exp( BFX3[0] - 2*pow(BFX3[1],2) + 3*pow(BFX3[2],3) );
+    BFF.diff(0,1); BFF3.diff(0,1);
+
+    for( unsigned int i=0; i<3; i++ )
+      for( unsigned int j=0; j<3; j++ ){
+        CPPUNIT_ASSERT( Eq( FFF.deriv(i).deriv(j), FFF3.deriv(i).deriv(j) ) );
+        CPPUNIT_ASSERT( Eq( BFX[i].deriv(0).deriv(j), BFX3[i].deriv(0).deriv(j) ) );
+      }
+
+    const SB::Options::HESSBND_STRATEGY strat[3] = { SB::Options::GERSHGORIN,
+      SB::Options::HERTZROHN, SB::Options::ROHN };
+    for( unsigned int k=0; k<3; k++ ){
+      SB::options.HESSBND = strat[k];
+      std::pair<double,double> spbndF  = SB::spectral_bound( FFF );
+      std::pair<double,double> spbndF3 = SB::spectral_bound( FFF3 );
+      std::pair<double,double> spbndB3 = SB::spectral_bound( BFX3 );
+      CPPUNIT_ASSERT( Eq( spbndF.first,  spbndF3.first ) );
+      CPPUNIT_ASSERT( Eq( spbndF.second, spbndF3.second ) );
+      CPPUNIT_ASSERT( Eq( spbndF.first,  spbndB3.first ) );
+      CPPUNIT_ASSERT( Eq( spbndF.second, spbndB3.second ) );
+    }
+    SB::options.HESSBND = SB::Options::GERSHGORIN;
+  }
+
+  void testEigenSolver(){
+    // Tridiagonal matrices with eigenvalues 2-2cos(k*pi/(N+1)), k=1,...,N,
+    // below and above the size for partial eigenvalue computations
+    EigenSolver ES;
+    const unsigned int NN[3] = { 6, 20, 6 };
+    for( unsigned int s=0; s<3; s++ ){
+      const unsigned int N = NN[s];
+      std::vector<double> A( N*N ), D( N );
+      double lmin, lmax;
+      for( unsigned int k=0; k<4; k++ ){
+        for( unsigned int j=0; j<N; j++ )
+          for( unsigned int i=0; i<N; i++ )
+            A[j*N+i] = ( i==j? 2.: ( i==j+1 || j==i+1? -1.: 0. ) );
+        switch( k ){
+        case 0:
+          CPPUNIT_ASSERT( ES.dsyev( N, &A[0], &D[0] ) );
+          for( unsigned int i=0; i<N; i++ )
+            CPPUNIT_ASSERT( Eq( D[i], 2.-2.*std::cos((i+1)*PI/(N+1)) ) );
+          break;
+        case 1:
+          CPPUNIT_ASSERT( ES.dsyevr( N, &A[0], 2, 3, &D[0] ) );
+          CPPUNIT_ASSERT( Eq( D[0], 2.-2.*std::cos(2.*PI/(N+1)) ) );
+          CPPUNIT_ASSERT( Eq( D[1], 2.-2.*std::cos(3.*PI/(N+1)) ) );
+          break;
+        case 2:
+          CPPUNIT_ASSERT( ES.extremes( N, &A[0], lmin, lmax ) );
+          CPPUNIT_ASSERT( Eq( lmin, 2.-2.*std::cos(PI/(N+1)) ) );
+          CPPUNIT_ASSERT( Eq( lmax, 2.-2.*std::cos(N*PI/(N+1)) ) );
+          break;
+        default:
+          CPPUNIT_ASSERT( !ES.dsyevr( N, &A[0], 3, 2, &D[0] ) );
+          break;
+        }
+      }
+    }
+  }
+
+    void testSize(){
     // The following line should throw an instance of SB::Exceptions
     SBX1.set( I(0., 1.), 0, 1 );
     SBX2.set( I(0., 1.), 1, 3 );
@@ -0,0 +1,130 @@
+// Copyright (C) 2009-2013 Benoit Chachuat, Imperial College London.
+// All Rights Reserved.
+
+
+#ifndef MC__SPSPECBND_TEST_HPP
+#define MC__SPSPECBND_TEST_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include "interval.hpp"
+#include "specbnd.hpp"
+#include "spspecbnd.hpp"
+#include "mcfadbad.hpp"
+
+namespace mc
+{
+//! @brief C++ class for test of mc::SpSpecbnd class using CppUnit
+////////////////////////////////////////////////////////////////////////
+//! SpSpecbndTest is a C++ class for testing the eigenvalue arithmetic
+//! class with sparse gradients mc::SpSpecbnd against mc::Specbnd using
+//! CppUnit.
+////////////////////////////////////////////////////////////////////////
+class SpSpecbndTest : public CppUnit::TestFixture
+////////////////////////////////////////////////////////////////////////
+{
+// Implementation of: static CppUnit::TestSuite *suite();
+CPPUNIT_TEST_SUITE( SpSpecbndTest );
+CPPUNIT_TEST( testExpression1 );
+CPPUNIT_TEST( testExpression2 );
+CPPUNIT_TEST( testExpression3 );
+CPPUNIT_TEST( testSparse );
+CPPUNIT_TEST_EXCEPTION( testSize, SpSpecbnd<Interval>::Exceptions );
+CPPUNIT_TEST_SUITE_END();
+
+private:
+
+  typedef Specbnd<Interval> SB;
+  typedef SpSpecbnd<Interval> SSB;
+
+  bool Eq( const Interval&I1, const Interval&I2,
+           const double atol=1e2*machprec(), const double rtol=1e2*machprec() ) const
+  {
+    return( isequal( I1.l(), I2.l(), atol, rtol )
+         && isequal( I1.u(), I2.u(), atol, rtol ) );
+  }
+
+  bool Eq( const SSB&SSB1, const SB&SB2,
+           const double atol=1e2*machprec(), const double rtol=1e2*machprec() ) const
+  {
+    if( SSB1.dep() != SB2.dep() ) return false;
+    for( unsigned int i=0; i<SB2.dep(); i++ )
+      if( !Eq( SSB1.D(i), SB2.FI().deriv(i), atol, rtol ) )
+        return false;
+    return( Eq( SSB1.I(),  SB2.I(),  atol, rtol )
+         && Eq( SSB1.SI(), SB2.SI(), atol, rtol ) );
+  }
+
+  template <typename U> static U fct1( const U*x )
+    { return exp( x[0] - 2*sqr(x[1]) + 3*pow(x[2],3) ); }
+  template <typename U> static U fct2( const U*x )
+    { return -1./(pow(x[0]-4.,2)+pow(x[1]-4.,2)+0.1)
+             -1./(pow(x[0]-1.,2)+pow(x[1]-1.,2)+0.2)
+             -1./(pow(x[0]-8.,2)+pow(x[1]-8.,2)+0.2); }
+  template <typename U> static U fct3( const U*x )
+    { return tan(x[0]*x[1]) + asin(x[0])*acos(x[1]) + sqrt(pow(x[0],2)+pow(x[1],2)+1.)
+             + x[0]*sin(2.*x[0]+3.*x[1])-cos(3.*x[0]-5.*x[1]) + atan(x[0]/(x[1]+2.)); }
+
+public:
+
+  void setUp(){}
+
+  void tearDown(){}
+
+  void testExpression1(){
+    const Interval X[3] = { Interval(-0.3,0.2), Interval(-0.1,0.6), Interval(-0.4,0.5) };
+    SB SBX[3]; SSB SSBX[3];
+    for( unsigned int i=0; i<3; i++ ){ SBX[i].set( X[i], i, 3 ); SSBX[i].set( X[i], i, 3 ); }
+    CPPUNIT_ASSERT( Eq( fct1(SSBX), fct1(SBX) ) );
+  }
+
+  void testExpression2(){
+    const Interval X[2] = { Interval(-2., 0.), Interval( 1., 3.) };
+    SB SBX[2]; SSB SSBX[2];
+    for( unsigned int i=0; i<2; i++ ){ SBX[i].set( X[i], i, 2 ); SSBX[i].set( X[i], i, 2 ); }
+    CPPUNIT_ASSERT( Eq( fct2(SSBX), fct2(SBX) ) );
+  }
+
+  void testExpression3(){
+    const Interval X[2] = { Interval(-.5, .5), Interval(-.5, .5) };
+    SB SBX[2]; SSB SSBX[2];
+    for( unsigned int i=0; i<2; i++ ){ SBX[i].set( X[i], i, 2 ); SSBX[i].set( X[i], i, 2 ); }
+    CPPUNIT_ASSERT( Eq( fct3(SSBX), fct3(SBX) ) );
+  }
+
+  void testSparse(){
+    // Chain function whose intermediate terms depend on two variables only
+    const unsigned int NX = 50;
+    SB SBX[NX], SBF = 0.;
+    SSB SSBX[NX], SSBF = 0.;
+    for( unsigned int i=0; i<NX; i++ ){
+      SBX[i].set( Interval(-1.,1.), i, NX );
+      SSBX[i].set( Interval(-1.,1.), i, NX );
+    }
+    for( unsigned int i=0; i<NX-1; i++ ){
+      SSB SSBT = exp( SSBX[i]*SSBX[i+1] );
+      CPPUNIT_ASSERT( SSBT.nnz() == 2 );
+      SSBF += SSBT;
+      SBF += exp( SBX[i]*SBX[i+1] );
+    }
+    CPPUNIT_ASSERT( SSBF.nnz() == NX );
+    CPPUNIT_ASSERT( Eq( SSBF, SBF ) );
+    CPPUNIT_ASSERT( Eq( SSBF.FI().deriv(NX-1), SBF.FI().deriv(NX-1) ) );
+  }
+
+  void testSize(){
+    // The following line should throw an instance of SpSpecbnd<Interval>::Exceptions
+    SSB SSBX1( Interval(0., 1.), 0, 1 );
+    SSB SSBX2( Interval(0., 1.), 1, 3 );
+    SSBX1 + SSBX2;
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( mc::SpSpecbndTest );
+
+} // end namespace mc
+
+#endif
@@ -1,9 +1,11 @@
 # Executable name
 EXE = TEST
+EXE_NOROUND = TEST_NOROUND
 
 PATH_MC = $(shell cd ../../ ; pwd)
 INC_MC = -I$(PATH_MC)/include
 OBJS = main.o
+OBJS_NOROUND = main_noround.o
 
 # Compilation options
 include $(PATH_MC)/src/makeoptions.mk
@@ -13,18 +15,31 @@ include $(PATH_MC)/src/makeoptions.mk
 test : $(EXE) dispTest
 	./$(EXE)
 
+# Same tests built without -frounding-math, for the verified scopes of mc::Interval
+test_noround : $(EXE_NOROUND)
+	./$(EXE_NOROUND)
+
 dispTest:
 	@echo
 	@(echo '***Testing MC++ library (ver.' $(version)')***')
 	@echo
 
 $(EXE) : $(OBJS)
-	$(LINK) $(PROF) $(FLAGS_LINK) -o $(EXE) $(OBJS) $(LIB_MC) $(LIB_PROFIL) $(LIB_FILIB) $(LIB_LAPACK) $(LIB_CPPUNIT)
+	$(LINK) $(PROF) $(FLAGS_LINK) -o $(EXE) $(OBJS) $(LIB_MC) $(LIB_PROFIL) $(LIB_FILIB) $(LIB_LAPACK) $(LIB_CPPUNIT) $(LIB_PTHREAD)
       
-main.o: main.cpp interval_test.hpp mccormick_test.hpp tmodel_test.hpp specbnd_test.hpp
+$(EXE_NOROUND) : $(OBJS_NOROUND)
+	$(LINK) $(PROF) $(FLAGS_LINK) -o $(EXE_NOROUND) $(OBJS_NOROUND) $(LIB_MC) $(LIB_PROFIL) $(LIB_FILIB) $(LIB_LAPACK) $(LIB_CPPUNIT) $(LIB_PTHREAD)
+
+SRCS = main.cpp interval_test.hpp mccormick_test.hpp tmodel_test.hpp cmodel_test.hpp specbnd_test.hpp \
+        spspecbnd_test.hpp alphabb_test.hpp hesspattern_test.hpp btape_test.hpp ittape_test.hpp intervalpack_test.hpp intervalblas_test.hpp affine_test.hpp ffunc_test.hpp ffcontractor_test.hpp ffcodegen_test.hpp ffcodegen_fct.hpp ffbranchbound_test.hpp mcthread_test.hpp
+
+main.o: $(SRCS)
 	$(CPP) -c $(PROF) $(FLAGS_CPP) $(INC_MC) $(INC_PROFIL) $(INC_FILIB) -o main.o main.cpp
 
+main_noround.o: $(SRCS)
+	$(CPP) -c $(PROF) $(filter-out -frounding-math,$(FLAGS_CPP)) $(INC_MC) $(INC_PROFIL) $(INC_FILIB) -o main_noround.o main.cpp
+
 #####
 
 clean :
-	rm -f $(EXE) $(OBJS)
+	rm -f $(EXE) $(OBJS) $(EXE_NOROUND) $(OBJS_NOROUND)
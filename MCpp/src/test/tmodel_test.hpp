@@ -29,6 +29,9 @@ CPPUNIT_TEST( testExpression2 );
 CPPUNIT_TEST( testExpression3 );
 CPPUNIT_TEST( testExpression4 );
 CPPUNIT_TEST( testExpression5 );
+CPPUNIT_TEST( testSweep );
+CPPUNIT_TEST( testOrder );
+CPPUNIT_TEST( testPolynomial );
 CPPUNIT_TEST_EXCEPTION( testDivisionByZero, TModel<Interval>::Exceptions );
 CPPUNIT_TEST_EXCEPTION( testTMEnv, TModel<Interval>::Exceptions );
 CPPUNIT_TEST_SUITE_END();
@@ -301,6 +304,112 @@ public:
                         Interval(-1.399820173693825e+00,8.172209419853024e-01) ) );
   }
 
+  void testSweep(){
+    TM_2d->options.BERNSTEIN_USE = false;
+    TM_2d->options.BOUNDER_TYPE = TModel<Interval>::Options::LSB;
+    TVX1 = TVar<Interval>( TM_2d, 0, Interval(-2., 0.) );
+    TVX2 = TVar<Interval>( TM_2d, 1, Interval( 1., 3.) );
+    TVar<Interval> TVF = exp(TVX1)*sin(TVX2);
+
+    TM_2d->options.SWEEP_TOL = 5e-2;
+    TVar<Interval> TVFS = exp(TVX1)*sin(TVX2);
+    TM_2d->options.SWEEP_TOL = 0.;
+    //std::cout << TVF << TVFS << std::endl;
+
+    // Swept coefficients are zero and their bounds moved to the remainder
+    unsigned int nzero = 0;
+    for( unsigned int imon=1; imon<TM_2d->nmon(); imon++ ){
+      const double a = TVFS.coefmon().second[imon];
+      if( a == 0. ){ nzero++; continue; }
+      CPPUNIT_ASSERT( std::fabs(a) * abs(TM_2d->bndmon()[imon]) >= 5e-2 );
+    }
+    CPPUNIT_ASSERT( nzero > 0 );
+    CPPUNIT_ASSERT( diam(TVFS.R()) > diam(TVF.R()) );
+
+    // Swept Taylor model remains an enclosure
+    double x[2];
+    for( unsigned int i=0; i<=10; i++ ){
+      for( unsigned int j=0; j<=10; j++ ){
+        x[0] = -2. + 0.2*i; x[1] = 1. + 0.2*j;
+        const double err = std::exp(x[0])*std::sin(x[1]) - TVFS.P(x);
+        CPPUNIT_ASSERT( err >= TVFS.R().l()-1e2*machprec()
+                     && err <= TVFS.R().u()+1e2*machprec() );
+      }
+    }
+  }
+
+  void testOrder(){
+    const Interval X1(-2., 0.), X2( 1., 3.);
+    TVX1 = TVar<Interval>( TM_2d, 0, X1 );
+    TVX2 = TVar<Interval>( TM_2d, 1, X2 );
+    TVar<Interval> TVF = exp(TVX1)*sin(TVX2);
+    CPPUNIT_ASSERT( TVF.degree() == 4 );
+
+    // Truncation to 2nd order in the same environment
+    TVar<Interval> TVT = TVF;
+    TVT.truncate( 2 );
+    CPPUNIT_ASSERT( TVT.degree() == 2 );
+    CPPUNIT_ASSERT( Eq( TVT.R(), TVF.R()+TVF.B(3)+TVF.B(4) ) );
+
+    // Truncation into, and embedding from, a 2nd-order environment
+    TModel<Interval>* TM_2d2 = new TModel<Interval>( 2, 2 );
+    TVar<Interval> TVX1_2( TM_2d2, 0, X1 ), TVX2_2( TM_2d2, 1, X2 );
+    TVar<Interval> TVF2( TM_2d2, TVF );
+    CPPUNIT_ASSERT( Eq( TVF2.R(), TVT.R() ) );
+    TVar<Interval> TVE( TM_2d, TVF2 );
+    CPPUNIT_ASSERT( TVE.degree() == 2 );
+    for( unsigned int imon=0; imon<TM_2d->nmon(); imon++ )
+      CPPUNIT_ASSERT( TVE.coefmon().second[imon] == TVT.coefmon().second[imon] );
+    CPPUNIT_ASSERT( Eq( TVE.R(), TVT.R() ) );
+    delete TM_2d2;
+
+    // Products of low-degree Taylor models are exact up to order 4
+    TVar<Interval> TVP = TVT*TVT;
+    TVar<Interval> TVS = sqr(TVT);
+    CPPUNIT_ASSERT( TVP.degree() == 4 );
+    for( unsigned int imon=0; imon<TM_2d->nmon(); imon++ )
+      CPPUNIT_ASSERT( Eq( TVP.coefmon().second[imon], TVS.coefmon().second[imon] ) );
+
+    // Adaptive order reduction retains an enclosure
+    TM_2d->options.ADAPT_ORDER_TOL = 1.5;
+    TVX1 = TVar<Interval>( TM_2d, 0, X1 );
+    TVX2 = TVar<Interval>( TM_2d, 1, X2 );
+    TVar<Interval> TVA = exp(TVX1)*sin(TVX2);
+    TM_2d->options.ADAPT_ORDER_TOL = 0.;
+    CPPUNIT_ASSERT( TVA.degree() < 4 );
+    double x[2];
+    for( unsigned int i=0; i<=10; i++ ){
+      for( unsigned int j=0; j<=10; j++ ){
+        x[0] = -2. + 0.2*i; x[1] = 1. + 0.2*j;
+        const double err = std::exp(x[0])*std::sin(x[1]) - TVA.P(x);
+        CPPUNIT_ASSERT( err >= TVA.R().l()-1e2*machprec()
+                     && err <= TVA.R().u()+1e2*machprec() );
+      }
+    }
+  }
+
+  void testPolynomial(){
+    TModel<Interval> TM( 3, 5 );
+    TVar<Interval> TVX1( &TM, 0, Interval(-2., 0.) );
+    TVar<Interval> TVX2( &TM, 1, Interval( 1., 3.) );
+    TVar<Interval> TVX3( &TM, 2, Interval( 0., 1.) );
+    TVar<Interval> TVF = exp(TVX1)*sin(TVX2)+TVX1*pow(TVX3,3);
+
+    // Batched evaluation at 101 points - more than one block
+    const unsigned int NPTS = 101;
+    double x[3*NPTS], Pval[NPTS], xi[3];
+    for( unsigned int ipt=0; ipt<NPTS; ipt++ ){
+      x[ipt]        = -2.+0.02*ipt;
+      x[NPTS+ipt]   =  3.-0.02*ipt;
+      x[2*NPTS+ipt] =  0.01*ipt;
+    }
+    TVF.P( NPTS, x, Pval );
+    for( unsigned int ipt=0; ipt<NPTS; ipt++ ){
+      for( unsigned int k=0; k<3; k++ ) xi[k] = x[k*NPTS+ipt];
+      CPPUNIT_ASSERT( Eq( Pval[ipt], TVF.P( xi ) ) );
+    }
+  }
+
   void testDivisionByZero(){
     // The following line should throw an instance of TModel<Interval>::Exceptions
     TVX1/0.;